@@ -302,7 +302,8 @@ public class HoudiniEngine : ModuleRules
             new string[]
             {
                 "Landscape",
-                "PhysicsCore"
+                "PhysicsCore",
+                "Json"
             }
        );
 
@@ -0,0 +1,324 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniDetailsLayoutCache.h"
+
+#include "HoudiniAssetComponent.h"
+#include "HoudiniInput.h"
+#include "HoudiniOutput.h"
+#include "HoudiniPDGAssetLink.h"
+#include "HoudiniParameter.h"
+#include "HoudiniParameterButtonStrip.h"
+#include "HoudiniParameterChoice.h"
+#include "HoudiniParameterFolder.h"
+#include "HoudiniParameterFolderList.h"
+#include "HoudiniParameterLabel.h"
+#include "HoudiniParameterMultiParm.h"
+#include "HoudiniParameterRamp.h"
+#include "HoudiniParameterString.h"
+
+#include "Engine/StaticMesh.h"
+
+FHoudiniDetailsLayoutCache&
+FHoudiniDetailsLayoutCache::Get()
+{
+	static FHoudiniDetailsLayoutCache Instance;
+	return Instance;
+}
+
+void
+FHoudiniDetailsLayoutCache::NotifyDetailsBuilt(UHoudiniAssetComponent* InHAC)
+{
+	if (!IsValid(InHAC))
+		return;
+
+	// Remove the entries of destroyed components while we're at it
+	for (auto It = LayoutHashes.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+			It.RemoveCurrent();
+	}
+
+	LayoutHashes.Add(InHAC, ComputeLayoutHash(InHAC));
+}
+
+bool
+FHoudiniDetailsLayoutCache::HasLayoutChanged(UHoudiniAssetComponent* InHAC) const
+{
+	if (!IsValid(InHAC))
+		return true;
+
+	const uint32* BuiltHash = LayoutHashes.Find(InHAC);
+	if (!BuiltHash)
+		return true;
+
+	return *BuiltHash != ComputeLayoutHash(InHAC);
+}
+
+static uint32
+HashParameterLayout(UHoudiniParameter* InParam, uint32 InHash)
+{
+	InHash = HashCombine(InHash, GetTypeHash(InParam->GetParameterType()));
+	InHash = HashCombine(InHash, GetTypeHash(InParam->GetParameterName()));
+	InHash = HashCombine(InHash, GetTypeHash(InParam->GetParameterLabel()));
+	InHash = HashCombine(InHash, GetTypeHash(InParam->GetTupleSize()));
+	InHash = HashCombine(InHash, GetTypeHash(InParam->GetParentParmId()));
+	InHash = HashCombine(InHash, GetTypeHash(InParam->GetChildIndex()));
+	InHash = HashCombine(InHash, (uint32)InParam->IsVisible());
+	InHash = HashCombine(InHash, (uint32)InParam->IsDisabled());
+	InHash = HashCombine(InHash, (uint32)InParam->GetJoinNext());
+	InHash = HashCombine(InHash, (uint32)InParam->HasExpression());
+	InHash = HashCombine(InHash, (uint32)InParam->IsShowingExpression());
+
+	// Values of the rows that are built from a snapshot of the parameter
+	switch (InParam->GetParameterType())
+	{
+		case EHoudiniParameterType::Label:
+		{
+			UHoudiniParameterLabel* LabelParam = Cast<UHoudiniParameterLabel>(InParam);
+			if (!IsValid(LabelParam))
+				break;
+			for (const FString& LabelString : LabelParam->LabelStrings)
+				InHash = HashCombine(InHash, GetTypeHash(LabelString));
+		}
+		break;
+
+		case EHoudiniParameterType::ButtonStrip:
+		{
+			UHoudiniParameterButtonStrip* ButtonStripParam = Cast<UHoudiniParameterButtonStrip>(InParam);
+			if (!IsValid(ButtonStripParam))
+				break;
+			for (const FString& Label : ButtonStripParam->Labels)
+				InHash = HashCombine(InHash, GetTypeHash(Label));
+			for (const int32& Value : ButtonStripParam->Values)
+				InHash = HashCombine(InHash, GetTypeHash(Value));
+		}
+		break;
+
+		case EHoudiniParameterType::IntChoice:
+		case EHoudiniParameterType::StringChoice:
+		{
+			UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(InParam);
+			if (!IsValid(ChoiceParam))
+				break;
+			InHash = HashCombine(InHash, GetTypeHash(ChoiceParam->GetNumChoices()));
+			for (int32 Idx = 0; Idx < ChoiceParam->GetNumChoices(); Idx++)
+			{
+				if (const FString* Label = ChoiceParam->GetStringChoiceLabelAt(Idx))
+					InHash = HashCombine(InHash, GetTypeHash(*Label));
+			}
+		}
+		break;
+
+		case EHoudiniParameterType::String:
+		case EHoudiniParameterType::StringAssetRef:
+		{
+			// Asset references display a thumbnail of the referenced asset
+			UHoudiniParameterString* StringParam = Cast<UHoudiniParameterString>(InParam);
+			if (!IsValid(StringParam) || !StringParam->IsAssetRef())
+				break;
+			for (int32 Idx = 0; Idx < StringParam->GetTupleSize(); Idx++)
+				InHash = HashCombine(InHash, GetTypeHash(StringParam->GetValueAt(Idx)));
+		}
+		break;
+
+		case EHoudiniParameterType::Folder:
+		{
+			UHoudiniParameterFolder* FolderParam = Cast<UHoudiniParameterFolder>(InParam);
+			if (!IsValid(FolderParam))
+				break;
+			InHash = HashCombine(InHash, GetTypeHash(FolderParam->GetFolderType()));
+			InHash = HashCombine(InHash, (uint32)FolderParam->IsExpanded());
+			InHash = HashCombine(InHash, (uint32)FolderParam->IsChosen());
+			InHash = HashCombine(InHash, (uint32)FolderParam->IsContentShown());
+		}
+		break;
+
+		case EHoudiniParameterType::FolderList:
+		{
+			UHoudiniParameterFolderList* FolderListParam = Cast<UHoudiniParameterFolderList>(InParam);
+			if (!IsValid(FolderListParam))
+				break;
+			InHash = HashCombine(InHash, (uint32)FolderListParam->IsTabMenu());
+			InHash = HashCombine(InHash, (uint32)FolderListParam->IsTabsShown());
+		}
+		break;
+
+		case EHoudiniParameterType::FloatRamp:
+		{
+			UHoudiniParameterRampFloat* RampParam = Cast<UHoudiniParameterRampFloat>(InParam);
+			if (!IsValid(RampParam))
+				break;
+			InHash = HashCombine(InHash, GetTypeHash(RampParam->GetInstanceCount()));
+			InHash = HashCombine(InHash, (uint32)RampParam->IsCaching());
+			for (UHoudiniParameterRampFloatPoint* Point : RampParam->IsCaching() ? RampParam->CachedPoints : RampParam->Points)
+			{
+				if (!IsValid(Point))
+					continue;
+				InHash = HashCombine(InHash, GetTypeHash(Point->GetPosition()));
+				InHash = HashCombine(InHash, GetTypeHash(Point->GetValue()));
+				InHash = HashCombine(InHash, GetTypeHash(Point->GetInterpolation()));
+			}
+		}
+		break;
+
+		case EHoudiniParameterType::ColorRamp:
+		{
+			UHoudiniParameterRampColor* RampParam = Cast<UHoudiniParameterRampColor>(InParam);
+			if (!IsValid(RampParam))
+				break;
+			InHash = HashCombine(InHash, GetTypeHash(RampParam->GetInstanceCount()));
+			InHash = HashCombine(InHash, (uint32)RampParam->IsCaching());
+			for (UHoudiniParameterRampColorPoint* Point : RampParam->IsCaching() ? RampParam->CachedPoints : RampParam->Points)
+			{
+				if (!IsValid(Point))
+					continue;
+				InHash = HashCombine(InHash, GetTypeHash(Point->GetPosition()));
+				InHash = HashCombine(InHash, GetTypeHash(Point->GetValue()));
+				InHash = HashCombine(InHash, GetTypeHash(Point->GetInterpolation()));
+			}
+		}
+		break;
+
+		case EHoudiniParameterType::MultiParm:
+		{
+			UHoudiniParameterMultiParm* MultiParam = Cast<UHoudiniParameterMultiParm>(InParam);
+			if (!IsValid(MultiParam))
+				break;
+			InHash = HashCombine(InHash, GetTypeHash(MultiParam->GetInstanceCount()));
+		}
+		break;
+
+		default:
+			break;
+	}
+
+	return InHash;
+}
+
+// Hashes what the output details copy from an output object: its name and, for meshes, their material slots
+static uint32
+HashOutputObjectLayout(UObject* InObject, uint32 InHash)
+{
+	InHash = HashCombine(InHash, GetTypeHash(InObject));
+	if (!IsValid(InObject))
+		return InHash;
+
+	InHash = HashCombine(InHash, GetTypeHash(InObject->GetFName()));
+
+	UStaticMesh* StaticMesh = Cast<UStaticMesh>(InObject);
+	if (!IsValid(StaticMesh))
+		return InHash;
+
+	const TArray<FStaticMaterial>& StaticMaterials = StaticMesh->GetStaticMaterials();
+	InHash = HashCombine(InHash, GetTypeHash(StaticMaterials.Num()));
+	for (const FStaticMaterial& StaticMaterial : StaticMaterials)
+	{
+		InHash = HashCombine(InHash, GetTypeHash(StaticMaterial.MaterialInterface));
+		if (IsValid(StaticMaterial.MaterialInterface))
+			InHash = HashCombine(InHash, GetTypeHash(StaticMaterial.MaterialInterface->GetFName()));
+	}
+
+	return InHash;
+}
+
+uint32
+FHoudiniDetailsLayoutCache::ComputeLayoutHash(UHoudiniAssetComponent* InHAC)
+{
+	if (!IsValid(InHAC))
+		return 0;
+
+	// Parameters
+	uint32 Hash = GetTypeHash(InHAC->GetNumParameters());
+	for (int32 ParamIdx = 0; ParamIdx < InHAC->GetNumParameters(); ParamIdx++)
+	{
+		UHoudiniParameter* Param = InHAC->GetParameterAt(ParamIdx);
+		if (!IsValid(Param))
+			continue;
+
+		Hash = HashParameterLayout(Param, Hash);
+	}
+
+	// Inputs
+	Hash = HashCombine(Hash, GetTypeHash(InHAC->GetNumInputs()));
+	for (int32 InputIdx = 0; InputIdx < InHAC->GetNumInputs(); InputIdx++)
+	{
+		UHoudiniInput* Input = InHAC->GetInputAt(InputIdx);
+		if (!IsValid(Input))
+			continue;
+
+		Hash = HashCombine(Hash, GetTypeHash(Input->GetInputType()));
+		const int32 NumInputObjects = Input->GetNumberOfInputObjects();
+		Hash = HashCombine(Hash, GetTypeHash(NumInputObjects));
+		for (int32 ObjIdx = 0; ObjIdx < NumInputObjects; ObjIdx++)
+			Hash = HashCombine(Hash, GetTypeHash(Input->GetInputObjectAt(ObjIdx)));
+	}
+
+	// Outputs
+	Hash = HashCombine(Hash, GetTypeHash(InHAC->GetNumOutputs()));
+	for (int32 OutputIdx = 0; OutputIdx < InHAC->GetNumOutputs(); OutputIdx++)
+	{
+		UHoudiniOutput* Output = InHAC->GetOutputAt(OutputIdx);
+		if (!IsValid(Output))
+			continue;
+
+		Hash = HashCombine(Hash, GetTypeHash(Output->GetType()));
+		Hash = HashCombine(Hash, GetTypeHash(Output->GetInstancedOutputs().Num()));
+		for (const auto& Pair : Output->GetInstancedOutputs())
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Pair.Key));
+			Hash = HashCombine(Hash, GetTypeHash(Pair.Value.VariationObjects.Num()));
+			for (const TSoftObjectPtr<UObject>& VariationObject : Pair.Value.VariationObjects)
+				Hash = HashOutputObjectLayout(VariationObject.Get(), Hash);
+		}
+		for (const auto& Pair : Output->GetOutputObjects())
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Pair.Key));
+			Hash = HashCombine(Hash, GetTypeHash(Pair.Value.BakeName));
+			Hash = HashOutputObjectLayout(Pair.Value.OutputObject, Hash);
+			Hash = HashCombine(Hash, GetTypeHash(Pair.Value.OutputComponent));
+			Hash = HashOutputObjectLayout(Pair.Value.ProxyObject, Hash);
+		}
+	}
+
+	// PDG asset link: the TOP node tree updates itself, only the networks affect the layout
+	UHoudiniPDGAssetLink* PDGAssetLink = InHAC->GetPDGAssetLink();
+	Hash = HashCombine(Hash, GetTypeHash(PDGAssetLink));
+	if (IsValid(PDGAssetLink))
+	{
+		Hash = HashCombine(Hash, GetTypeHash(PDGAssetLink->LinkState));
+		Hash = HashCombine(Hash, GetTypeHash(PDGAssetLink->SelectedTOPNetworkIndex));
+		Hash = HashCombine(Hash, GetTypeHash(PDGAssetLink->AllTOPNetworks.Num()));
+		for (UTOPNetwork* TOPNetwork : PDGAssetLink->AllTOPNetworks)
+		{
+			if (!IsValid(TOPNetwork))
+				continue;
+			Hash = HashCombine(Hash, GetTypeHash(TOPNetwork->AllTOPNodes.Num()));
+		}
+	}
+
+	return Hash;
+}
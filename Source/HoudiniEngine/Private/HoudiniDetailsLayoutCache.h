@@ -0,0 +1,62 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UHoudiniAssetComponent;
+
+// Keeps track of the layout the details panel was last built with for each Houdini Asset Component.
+// After a cook, the details panel only needs to be rebuilt when that layout changed (parameters,
+// inputs or outputs added/removed, folders/multiparms changed...). When it didn't, the rows bound
+// to the component's values are simply redrawn, which keeps the scroll position, the expansion
+// state and the keyboard focus of the panel.
+class HOUDINIENGINE_API FHoudiniDetailsLayoutCache
+{
+public:
+
+	static FHoudiniDetailsLayoutCache& Get();
+
+	// Must be called by the details customization when it builds the widgets of a component
+	void NotifyDetailsBuilt(UHoudiniAssetComponent* InHAC);
+
+	// Indicates if the component's layout differs from the one its details were last built with.
+	// Components whose details have never been built are considered changed.
+	bool HasLayoutChanged(UHoudiniAssetComponent* InHAC) const;
+
+	void Reset() { LayoutHashes.Empty(); };
+
+	// Hashes everything that is baked in the details panel's layout: the structure of the
+	// parameters/inputs/outputs, and the values displayed by rows that aren't bound to attributes.
+	static uint32 ComputeLayoutHash(UHoudiniAssetComponent* InHAC);
+
+protected:
+
+	// Layout hash of each component, when its details were last built
+	TMap<TWeakObjectPtr<UHoudiniAssetComponent>, uint32> LayoutHashes;
+};
@@ -36,6 +36,10 @@
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniPackageNameAllocator.h"
+#include "HoudiniTempPackageTracker.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniEngineMockAPI.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -129,6 +133,9 @@ FHoudiniEngine::StartupModule()
 		if ( HAPILibraryHandle )
 		{
 			FHoudiniApi::InitializeHAPI( HAPILibraryHandle );
+
+			// Record the size of the data transferred to/from HAPI in the cook report
+			FHoudiniEngineCookReport::InstallTransferCounters();
 		}
 		else
 		{
@@ -244,6 +251,10 @@ FHoudiniEngine::ShutdownModule()
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Shutting down the Houdini Engine module."));
 
+	// Stop tracking the package names used in our output folders
+	FHoudiniPackageNameAllocator::Get().Shutdown();
+	FHoudiniTempPackageTracker::Get().Reset();
+
 	// We no longer need the Houdini logo static mesh.
 	if (HoudiniLogoStaticMesh.IsValid())
 	{
@@ -350,6 +361,13 @@ FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
 }
 
+void
+FHoudiniEngine::InterruptTask(const FGuid& InHapiGUID)
+{
+	if (HoudiniEngineScheduler)
+		HoudiniEngineScheduler->InterruptTask(InHapiGUID);
+}
+
 void
 FHoudiniEngine::AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo)
 {
@@ -842,6 +860,24 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	return true;
 }
 
+bool
+FHoudiniEngine::StartMockSession(const FString& InCaptureFilePath)
+{
+	// Stop the current session first, the mock replaces the HAPI functions
+	if (FHoudiniApi::IsHAPIInitialized() && !FHoudiniEngineMockAPI::IsInstalled())
+		StopSession();
+
+	if (!FHoudiniEngineMockAPI::Install(InCaptureFilePath))
+		return false;
+
+	Session.type = FHoudiniEngineMockAPI::MockSessionType;
+	Session.id = 0;
+	bFirstSessionCreated = true;
+	SessionStatus = EHoudiniSessionStatus::Connected;
+
+	return true;
+}
+
 bool
 FHoudiniEngine::RestartSession()
 {
@@ -108,6 +108,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Stops the current session
 		bool StopSession();
+		// Binds HAPI to the mock backend serving the given capture file, and starts a session on it
+		bool StartMockSession(const FString& InCaptureFilePath);
 		// Stops, then creates a new session
 		bool RestartSession();
 		// Creates a session, start HARS
@@ -148,6 +150,8 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		// Register task for execution.
 		virtual void AddTask(const FHoudiniEngineTask & InTask);
+		// Request the interruption of a cook task.
+		virtual void InterruptTask(const FGuid& InHapiGUID);
 		// Register task info.
 		virtual void AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo);
 		// Remove task info.
@@ -0,0 +1,227 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineBenchmarkCommandlet.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngineMockAPI.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniGeoImporter.h"
+#include "HoudiniOutput.h"
+#include "HoudiniPackageParams.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+
+UHoudiniEngineBenchmarkCommandlet::UHoudiniEngineBenchmarkCommandlet()
+{
+	HelpDescription = TEXT("Benchmark the Houdini Engine output translators on a captured cook, without requiring a Houdini session.");
+
+	HelpUsage = TEXT("HoudiniEngineBenchmark Usage: HoudiniEngineBenchmark -record=capture.hmock [filename.bgeo] | -capture=capture.hmock {options}");
+
+	HelpParamNames = {
+		"help",
+		"record",
+		"capture",
+		"iterations",
+		"report",
+		"bake"
+	};
+
+	HelpParamDescriptions = {
+		"Displays this help.",
+		"Load the given .bgeo file in a live Houdini Engine session and save its cooked results to the capture file.",
+		"Replay the given capture file with the mock HAPI backend.",
+		"Number of times the outputs of the capture are built (defaults to 1).",
+		"Path of the cook report to write, as JSON (.json) or CSV (any other extension).",
+		"Bake the outputs instead of cooking them to the temporary folder."
+	};
+
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowProgress = false;
+	ShowErrorCount = false;
+
+	bBakeOutputs = false;
+}
+
+void UHoudiniEngineBenchmarkCommandlet::PrintUsage() const
+{
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpDescription);
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpUsage);
+	const int32 NumOptions = HelpParamNames.Num();
+	for (int32 Idx = 0; Idx < NumOptions; ++Idx)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("-%s\t%s"), *HelpParamNames[Idx], *HelpParamDescriptions[Idx]);
+	}
+}
+
+void UHoudiniEngineBenchmarkCommandlet::PopulatePackageParams(const FString& InName, FHoudiniPackageParams& OutPackageParams)
+{
+	OutPackageParams.PackageMode = bBakeOutputs ? EPackageMode::Bake : EPackageMode::CookToTemp;
+	OutPackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+
+	OutPackageParams.TempCookFolder = FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder();
+	OutPackageParams.BakeFolder = FHoudiniEngineRuntime::Get().GetDefaultBakeFolder();
+
+	OutPackageParams.HoudiniAssetName = InName;
+	OutPackageParams.HoudiniAssetActorName = FString();
+	OutPackageParams.ObjectName = InName;
+	OutPackageParams.OuterPackage = this;
+
+	// Keep the same GUID for all iterations, so each iteration cooks the same package names
+	OutPackageParams.ComponentGUID = FGuid(0x48424E43, 0x484D524B, 0, 0);
+}
+
+int32 UHoudiniEngineBenchmarkCommandlet::Main(const FString& InParams)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*InParams, Tokens, Switches, Params);
+
+	if (Switches.Contains(TEXT("help")) || Switches.Contains(TEXT("?")))
+	{
+		PrintUsage();
+		return 0;
+	}
+
+	bBakeOutputs = Switches.Contains(TEXT("bake"));
+
+	if (Params.Contains(TEXT("record")))
+	{
+		if (Tokens.Num() <= 0)
+		{
+			HOUDINI_LOG_ERROR(TEXT("A .bgeo file is required when in -record mode."));
+			return 1;
+		}
+
+		const FString Filename = FPaths::IsRelative(Tokens[0]) ? FPaths::ConvertRelativePathToFull(Tokens[0]) : Tokens[0];
+		return Record(Filename, Params.FindChecked(TEXT("record")));
+	}
+	else if (Params.Contains(TEXT("capture")))
+	{
+		int32 Iterations = 1;
+		if (Params.Contains(TEXT("iterations")))
+			Iterations = FMath::Max(1, FCString::Atoi(*Params.FindChecked(TEXT("iterations"))));
+
+		const FString* ReportFilename = Params.Find(TEXT("report"));
+		return Replay(Params.FindChecked(TEXT("capture")), Iterations, ReportFilename ? *ReportFilename : FString());
+	}
+
+	PrintUsage();
+	return 1;
+}
+
+int32 UHoudiniEngineBenchmarkCommandlet::Record(const FString& InBGEOFilename, const FString& InCaptureFilename)
+{
+	HOUDINI_LOG_DISPLAY(TEXT("Starting Houdini Engine session..."));
+	if (!FHoudiniEngine::Get().CreateSession(EHoudiniRuntimeSettingsSessionType::HRSST_NamedPipe, "hapi_benchmark_cmdlet"))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to start Houdini Engine session."));
+		return 2;
+	}
+
+	HAPI_NodeId NodeId = -1;
+	if (!UHoudiniGeoImporter::OpenBGEOFile(InBGEOFilename, NodeId))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to load %s."), *InBGEOFilename);
+		return 1;
+	}
+
+	const bool bCaptured = FHoudiniEngineMockAPI::CaptureNode(NodeId, InCaptureFilename);
+	UHoudiniGeoImporter::CloseBGEOFile(NodeId);
+
+	return bCaptured ? 0 : 1;
+}
+
+int32 UHoudiniEngineBenchmarkCommandlet::Replay(const FString& InCaptureFilename, const int32& InIterations, const FString& InReportFilename)
+{
+	if (!FHoudiniEngine::Get().StartMockSession(InCaptureFilename))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to start the mock session for %s."), *InCaptureFilename);
+		return 2;
+	}
+
+	const FString Name = FPaths::GetBaseFilename(InCaptureFilename);
+	FHoudiniPackageParams PackageParams;
+	PopulatePackageParams(Name, PackageParams);
+
+	FHoudiniEngineCookReport& CookReport = FHoudiniEngineCookReport::Get();
+	CookReport.Reset();
+
+	const HAPI_NodeId NodeId = FHoudiniEngineMockAPI::GetRootNodeId();
+	for (int32 Iteration = 0; Iteration < InIterations; Iteration++)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		{
+			FHoudiniCookReportHDAScope HDAScope(Name);
+			CookReport.BeginCook(Name);
+			if (!ReplayIteration(NodeId, PackageParams))
+			{
+				HOUDINI_LOG_ERROR(TEXT("Iteration %d of %s failed."), Iteration, *Name);
+				return 1;
+			}
+		}
+
+		HOUDINI_LOG_DISPLAY(TEXT("Iteration %d: %.3fs"), Iteration, FPlatformTime::Seconds() - StartTime);
+
+		// Release the outputs of this iteration before the next one
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	CookReport.LogReport();
+	if (!InReportFilename.IsEmpty() && !CookReport.DumpToFile(InReportFilename))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to write the cook report to %s."), *InReportFilename);
+		return 1;
+	}
+
+	return 0;
+}
+
+bool UHoudiniEngineBenchmarkCommandlet::ReplayIteration(const HAPI_NodeId& InNodeId, const FHoudiniPackageParams& InPackageParams)
+{
+	UHoudiniGeoImporter* GeoImporter = NewObject<UHoudiniGeoImporter>(this);
+
+	TArray<UHoudiniOutput*> OldOutputs;
+	TArray<UHoudiniOutput*> NewOutputs;
+	if (!UHoudiniGeoImporter::BuildAllOutputsForNode(InNodeId, this, OldOutputs, NewOutputs))
+		return false;
+
+	if (!GeoImporter->CreateStaticMeshes(NewOutputs, this, InPackageParams))
+		return false;
+
+	if (!GeoImporter->CreateInstancers(NewOutputs, this, InPackageParams))
+		return false;
+
+	return true;
+}
@@ -0,0 +1,72 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+
+#include "HoudiniEngine.h"
+
+#include "HoudiniEngineBenchmarkCommandlet.generated.h"
+
+struct FHoudiniPackageParams;
+
+// Benchmarks the output translators without Houdini.
+// Record mode captures the cooked results of a BGEO file from a live session, replay mode serves
+// that capture with the mock HAPI backend, and times the creation of the outputs with the cook report.
+UCLASS()
+class HOUDINIENGINE_API UHoudiniEngineBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UHoudiniEngineBenchmarkCommandlet();
+
+	void PrintUsage() const;
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+
+	// Loads a BGEO file in a live session and captures its cooked results
+	int32 Record(const FString& InBGEOFilename, const FString& InCaptureFilename);
+
+	// Builds the outputs of the capture InIterations times, and writes the cook report
+	int32 Replay(const FString& InCaptureFilename, const int32& InIterations, const FString& InReportFilename);
+
+	// Runs a single replay iteration
+	bool ReplayIteration(const HAPI_NodeId& InNodeId, const FHoudiniPackageParams& InPackageParams);
+
+	void PopulatePackageParams(const FString& InName, FHoudiniPackageParams& OutPackageParams);
+
+private:
+
+	// Bake the outputs instead of cooking them to the temp folder
+	bool bBakeOutputs;
+};
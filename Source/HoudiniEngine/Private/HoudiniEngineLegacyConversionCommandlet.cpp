@@ -0,0 +1,262 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineLegacyConversionCommandlet.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HoudiniAsset.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniRuntimeSettings.h"
+
+#include "AssetRegistryModule.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "Engine/World.h"
+
+// Number of packages loaded between garbage collections
+static const int32 LegacyConversionGCInterval = 16;
+
+UHoudiniEngineLegacyConversionCommandlet::UHoudiniEngineLegacyConversionCommandlet()
+{
+	HelpDescription = TEXT("Convert the legacy (v1) Houdini Asset Components of a content directory to v2, and save them.");
+
+	HelpUsage = TEXT("HoudiniEngineLegacyConversion Usage: HoudiniEngineLegacyConversion [-path=/Game/Maps] {options}");
+
+	HelpParamNames = {
+		"help",
+		"path",
+		"dryrun",
+		"report"
+	};
+
+	HelpParamDescriptions = {
+		"Displays this help.",
+		"Content directory to convert, recursively (defaults to /Game).",
+		"Load and convert the components without saving any package.",
+		"Path of the CSV report listing every converted component."
+	};
+
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowProgress = true;
+	ShowErrorCount = true;
+}
+
+void UHoudiniEngineLegacyConversionCommandlet::PrintUsage() const
+{
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpDescription);
+	HOUDINI_LOG_DISPLAY(TEXT("%s"), *HelpUsage);
+	const int32 NumOptions = HelpParamNames.Num();
+	for (int32 Idx = 0; Idx < NumOptions; ++Idx)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("-%s\t%s"), *HelpParamNames[Idx], *HelpParamDescriptions[Idx]);
+	}
+}
+
+int32 UHoudiniEngineLegacyConversionCommandlet::Main(const FString& InParams)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*InParams, Tokens, Switches, Params);
+
+	if (Switches.Contains(TEXT("help")) || Switches.Contains(TEXT("?")))
+	{
+		PrintUsage();
+		return 0;
+	}
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bEnableBackwardCompatibility)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Backward compatibility is disabled in the Houdini Engine runtime settings, legacy components can't be converted."));
+		return 1;
+	}
+
+	const bool bDryRun = Switches.Contains(TEXT("dryrun"));
+
+	FString ContentPath = TEXT("/Game");
+	if (Params.Contains(TEXT("path")))
+		ContentPath = Params.FindChecked(TEXT("path"));
+	ContentPath.RemoveFromEnd(TEXT("/"));
+
+	TArray<FName> PackageNames;
+	FindCandidatePackages(ContentPath, PackageNames);
+
+	HOUDINI_LOG_DISPLAY(TEXT("Found %d package(s) referencing Houdini Assets in %s%s."),
+		PackageNames.Num(), *ContentPath, bDryRun ? TEXT(" (dry run)") : TEXT(""));
+
+	Entries.Empty();
+	int32 NumFailedPackages = 0;
+	for (int32 PackageIdx = 0; PackageIdx < PackageNames.Num(); PackageIdx++)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("[%d/%d] %s"), PackageIdx + 1, PackageNames.Num(), *PackageNames[PackageIdx].ToString());
+
+		if (!ConvertPackage(PackageNames[PackageIdx], bDryRun))
+			NumFailedPackages++;
+
+		// Release the loaded packages regularly, converting large directories would run out of memory otherwise
+		if ((PackageIdx + 1) % LegacyConversionGCInterval == 0)
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	int32 NumConverted = 0;
+	for (const FConversionEntry& Entry : Entries)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("%s: %s (%s) - %d parameter(s), %d input(s), %d output(s)"),
+			*Entry.Status, *Entry.ComponentPath, *Entry.HoudiniAssetName, Entry.NumParameters, Entry.NumInputs, Entry.NumOutputs);
+
+		if (Entry.Status != TEXT("SaveFailed"))
+			NumConverted++;
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("%s %d legacy component(s) in %d package(s), %d package(s) failed."),
+		bDryRun ? TEXT("Would convert") : TEXT("Converted"), NumConverted, PackageNames.Num(), NumFailedPackages);
+
+	if (Params.Contains(TEXT("report")))
+		WriteReport(Params.FindChecked(TEXT("report")));
+
+	return NumFailedPackages > 0 ? 1 : 0;
+}
+
+void UHoudiniEngineLegacyConversionCommandlet::FindCandidatePackages(const FString& InContentPath, TArray<FName>& OutPackageNames) const
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	// Legacy components import their Houdini Asset, so only the packages referencing one need to be loaded
+	TArray<FAssetData> HoudiniAssets;
+	AssetRegistry.GetAssetsByClass(UHoudiniAsset::StaticClass()->GetFName(), HoudiniAssets, true);
+
+	TSet<FName> PackageNames;
+	for (const FAssetData& HoudiniAsset : HoudiniAssets)
+	{
+		TArray<FName> Referencers;
+		AssetRegistry.GetReferencers(HoudiniAsset.PackageName, Referencers);
+		for (const FName& Referencer : Referencers)
+		{
+			const FString ReferencerName = Referencer.ToString();
+			if (ReferencerName == InContentPath || ReferencerName.StartsWith(InContentPath + TEXT("/")))
+				PackageNames.Add(Referencer);
+		}
+	}
+
+	OutPackageNames = PackageNames.Array();
+	OutPackageNames.Sort([](const FName& A, const FName& B) { return A.LexicalLess(B); });
+}
+
+bool UHoudiniEngineLegacyConversionCommandlet::ConvertPackage(const FName& InPackageName, const bool& bInDryRun)
+{
+	const FString PackageName = InPackageName.ToString();
+	UPackage* Package = LoadPackage(nullptr, *PackageName, LOAD_None);
+	if (!Package)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not load package %s."), *PackageName);
+		return false;
+	}
+
+	// The legacy components have been converted in PostLoad()
+	TArray<UObject*> Objects;
+	GetObjectsWithOuter(Package, Objects, true);
+
+	const int32 FirstEntry = Entries.Num();
+	for (UObject* Object : Objects)
+	{
+		UHoudiniAssetComponent* HAC = Cast<UHoudiniAssetComponent>(Object);
+		if (!IsValid(HAC))
+			continue;
+
+		// Components still pending (if any) are converted now
+		if (HAC->HasPendingLegacyConversion())
+			HAC->ConvertPendingLegacyData();
+
+		if (!HAC->WasConvertedFromLegacyData())
+			continue;
+
+		FConversionEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.PackageName = PackageName;
+		Entry.ComponentPath = HAC->GetPathName();
+		Entry.HoudiniAssetName = IsValid(HAC->GetHoudiniAsset()) ? HAC->GetHoudiniAsset()->GetName() : FString();
+		Entry.NumParameters = HAC->GetNumParameters();
+		Entry.NumInputs = HAC->GetNumInputs();
+		Entry.NumOutputs = HAC->GetNumOutputs();
+		Entry.Status = bInDryRun ? TEXT("DryRun") : TEXT("Converted");
+	}
+
+	// Nothing to save if the package didn't have legacy components
+	if (bInDryRun || Entries.Num() == FirstEntry)
+		return true;
+
+	const FString Extension = Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension();
+	const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, Extension);
+
+	bool bSaved = false;
+	if (IFileManager::Get().IsReadOnly(*Filename))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not save %s, the file is read-only (is it checked out?)."), *Filename);
+	}
+	else
+	{
+		UWorld* World = UWorld::FindWorldInPackage(Package);
+		bSaved = UPackage::SavePackage(Package, World, RF_Standalone, *Filename, GError, nullptr, false, true, SAVE_NoError);
+		if (!bSaved)
+			HOUDINI_LOG_ERROR(TEXT("Could not save %s."), *Filename);
+	}
+
+	if (!bSaved)
+	{
+		for (int32 EntryIdx = FirstEntry; EntryIdx < Entries.Num(); EntryIdx++)
+			Entries[EntryIdx].Status = TEXT("SaveFailed");
+	}
+
+	return bSaved;
+}
+
+bool UHoudiniEngineLegacyConversionCommandlet::WriteReport(const FString& InFilename) const
+{
+	FString Content = TEXT("Package,Component,HoudiniAsset,Parameters,Inputs,Outputs,Status\n");
+	for (const FConversionEntry& Entry : Entries)
+	{
+		Content += FString::Printf(TEXT("%s,%s,%s,%d,%d,%d,%s\n"),
+			*Entry.PackageName, *Entry.ComponentPath, *Entry.HoudiniAssetName,
+			Entry.NumParameters, Entry.NumInputs, Entry.NumOutputs, *Entry.Status);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Content, *InFilename))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not write the legacy conversion report to %s."), *InFilename);
+		return false;
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("Legacy conversion report written to %s."), *InFilename);
+	return true;
+}
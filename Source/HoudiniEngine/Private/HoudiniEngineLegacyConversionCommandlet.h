@@ -0,0 +1,77 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+
+#include "HoudiniEngineLegacyConversionCommandlet.generated.h"
+
+// Converts the legacy (v1) Houdini Asset Components of a content directory offline.
+// Packages referencing Houdini Assets are loaded (which converts their v1 components), and saved back in the v2 format.
+// In dry-run mode, nothing is saved and a report of what would be converted is produced.
+UCLASS()
+class HOUDINIENGINE_API UHoudiniEngineLegacyConversionCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UHoudiniEngineLegacyConversionCommandlet();
+
+	void PrintUsage() const;
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+
+	// Result of the conversion of a single component
+	struct FConversionEntry
+	{
+		FString PackageName;
+		FString ComponentPath;
+		FString HoudiniAssetName;
+		int32 NumParameters = 0;
+		int32 NumInputs = 0;
+		int32 NumOutputs = 0;
+		FString Status;
+	};
+
+	// Returns the packages in InContentPath that reference a Houdini Asset
+	void FindCandidatePackages(const FString& InContentPath, TArray<FName>& OutPackageNames) const;
+
+	// Loads (and converts) a package, and saves it if needed. Returns false if the package couldn't be converted.
+	bool ConvertPackage(const FName& InPackageName, const bool& bInDryRun);
+
+	// Writes the conversion report as CSV
+	bool WriteReport(const FString& InFilename) const;
+
+private:
+
+	TArray<FConversionEntry> Entries;
+};
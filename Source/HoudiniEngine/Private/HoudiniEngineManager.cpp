@@ -31,13 +31,18 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniInput.h"
+#include "HoudiniParameter.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
 #include "HoudiniInputTranslator.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
 #include "HoudiniSplineTranslator.h"
+#include "HoudiniTempPackageTracker.h"
 
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
@@ -63,6 +68,14 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
 	TEXT("1.0: Default\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineLegacyConversionsPerTick(
+	TEXT("HoudiniEngine.LegacyConversionsPerTick"),
+	8,
+	TEXT("Maximum number of loaded legacy (v1) Houdini Asset Components converted to v2 per tick of the Houdini Engine Manager.\n")
+	TEXT("<= 0: No Limit\n")
+	TEXT("8: Default\n")
+);
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -76,11 +89,23 @@ FHoudiniEngineManager::FHoudiniEngineManager()
 	, ZeroOffsetValue(0.f)
 	, bOffsetZeroed(false)
 {
-
+	// Legacy components are converted by their own ticker, as they must be converted
+	// even when there is no Houdini Engine session and the manager isn't ticking
+	if (GIsEditor && !IsRunningCommandlet())
+	{
+		LegacyConversionTickerHandle = FTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FHoudiniEngineManager::TickLegacyConversion));
+	}
 }
 
 FHoudiniEngineManager::~FHoudiniEngineManager()
 {
+	if (LegacyConversionTickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(LegacyConversionTickerHandle);
+		LegacyConversionTickerHandle.Reset();
+	}
+
 	PDGManager.StopBGEOCommandletAndEndpoint();
 }
 
@@ -185,6 +210,12 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 				continue;
 			}
 
+			if (CurrentComponent->HasPendingLegacyConversion())
+			{
+				// The component's v1 data needs to be converted (by TickLegacyConversion) before it can be processed
+				continue;
+			}
+
 			AActor* Owner = CurrentComponent->GetOwner();
 			if (Owner && Owner->IsSelectedInEditor())
 			{
@@ -391,6 +422,70 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 	return true;
 }
 
+bool
+FHoudiniEngineManager::TickLegacyConversion(float DeltaTime)
+{
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return true;
+
+	TArray<UHoudiniAssetComponent*> LegacyComponentsToConvert;
+	const int32 NumComponents = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentCount();
+	for (int32 nIdx = 0; nIdx < NumComponents; nIdx++)
+	{
+		UHoudiniAssetComponent * CurrentComponent = FHoudiniEngineRuntime::Get().GetRegisteredHoudiniComponentAt(nIdx);
+		if (!CurrentComponent || !CurrentComponent->IsValidLowLevelFast() || CurrentComponent->IsPendingKill())
+			continue;
+
+		if (CurrentComponent->HasPendingLegacyConversion())
+			LegacyComponentsToConvert.Add(CurrentComponent);
+	}
+
+	// Convert some of the loaded legacy components, they'll be processed by the manager once converted
+	if (LegacyComponentsToConvert.Num() > 0)
+		ConvertPendingLegacyComponents(LegacyComponentsToConvert);
+
+	return true;
+}
+
+void
+FHoudiniEngineManager::ConvertPendingLegacyComponents(TArray<UHoudiniAssetComponent*>& InComponents)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::ConvertPendingLegacyComponents);
+
+	// Convert the selected components first so their details are available as soon as possible
+	InComponents.StableSort([](const UHoudiniAssetComponent& A, const UHoudiniAssetComponent& B)
+	{
+		return A.IsOwnerSelected() && !B.IsOwnerSelected();
+	});
+
+	int32 MaxConversions = CVarHoudiniEngineLegacyConversionsPerTick.GetValueOnAnyThread();
+	if (MaxConversions <= 0)
+		MaxConversions = InComponents.Num();
+
+	int32 NumConverted = 0;
+	for (UHoudiniAssetComponent* CurrentComponent : InComponents)
+	{
+		if (NumConverted >= MaxConversions)
+			break;
+
+		if (!IsValid(CurrentComponent) || !CurrentComponent->HasPendingLegacyConversion())
+			continue;
+
+		CurrentComponent->ConvertPendingLegacyData();
+		NumConverted++;
+
+		// The converted parameters/inputs need to be displayed
+		if (CurrentComponent->IsOwnerSelected())
+			FHoudiniEngineUtils::UpdateEditorProperties(CurrentComponent, true);
+	}
+
+	if (NumConverted < InComponents.Num())
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Manager: Converted %d legacy Houdini Asset Components, %d remaining."),
+			NumConverted, InComponents.Num() - NumConverted);
+	}
+}
+
 void
 FHoudiniEngineManager::AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC)
 {
@@ -460,7 +555,7 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		{
 			// Trigger a details panel update if the Houdini asset actor is selected
 			if (HAC->IsOwnerSelected())
-				FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+				FHoudiniEngineUtils::UpdateEditorPropertiesAfterCook(HAC);
 
 			// Finished refreshing UI of one HDA.
 			FHoudiniEngine::Get().RefreshUIDisplayedWhenPauseCooking();
@@ -470,6 +565,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		return;
 	}
 
+	// Record the cook phases of this component to its HDA in the cook report
+	FHoudiniCookReportHDAScope CookReportScope(HAC->GetHoudiniAsset()->GetName());
+
 	switch (HAC->GetAssetState())
 	{
 		case EHoudiniAssetState::NeedInstantiation:
@@ -543,6 +641,8 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 				break;
 
 			HAC->OnPrePreCook();
+			FHoudiniEngineCookReport::Get().BeginCook(HAC->GetHoudiniAsset()->GetName());
+			FHoudiniEngineTrace::BookmarkCookStart(HAC->GetHoudiniAsset()->GetName());
 			// Update all the HAPI nodes, parameters, inputs etc...
 			PreCook(HAC);
 			HAC->OnPostPreCook();
@@ -558,13 +658,14 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 					HAC->AssetState = EHoudiniAssetState::Cooking;
 					HAC->HapiGUID = TaskGUID;
 					bCookStarted = true;
+					FHoudiniEngineCookReport::Get().BeginCookWait(HAC->GetPathName());
 				}
 			}
 			
 			if(!bCookStarted)
 			{
 				// Just refresh editor properties?
-				FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+				FHoudiniEngineUtils::UpdateEditorPropertiesAfterCook(HAC);
 
 				// TODO: Check! update state?
 				HAC->AssetState = EHoudiniAssetState::None;
@@ -574,10 +675,16 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::Cooking:
 		{
+			// If the HAC has been modified since the cook started,
+			// interrupt the cook so we can cook the latest changes instead
+			InterruptCookIfNeeded(HAC);
+
 			EHoudiniAssetState NewState = EHoudiniAssetState::Cooking;
 			bool state = UpdateCooking(HAC, NewState);
 			if (state)
 			{
+				FHoudiniEngineCookReport::Get().EndCookWait(HAC->GetPathName());
+
 				// We need to update the HAC's state
 				HAC->AssetState = NewState;
 				EnableEditorAutoSave(HAC);
@@ -632,9 +739,13 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			// Do nothing unless the HAC has been updated
 			if (HAC->NeedUpdate())
 			{
-				HAC->bForceNeedUpdate = false;
-				// Update the HAC's state
-				HAC->AssetState = EHoudiniAssetState::PreCook;
+				// Wait for the debounce delay so successive changes are cooked together
+				if (!ShouldDebounceCook(HAC))
+				{
+					HAC->bForceNeedUpdate = false;
+					// Update the HAC's state
+					HAC->AssetState = EHoudiniAssetState::PreCook;
+				}
 			}
 			else if (HAC->NeedTransformUpdate())
 			{
@@ -944,6 +1055,8 @@ FHoudiniEngineManager::StartTaskAssetCooking(const HAPI_NodeId& AssetId, const F
 	Task.AssetId = AssetId;
 	FHoudiniEngine::Get().AddTask(Task);
 
+	CookTaskStartTimes.Add(OutTaskGUID, FPlatformTime::Seconds());
+
 	return true;
 }
 
@@ -959,6 +1072,9 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 	// Get the HAC display name for the logs
 	FString DisplayName = HAC->GetDisplayName();
 
+	// Keep the task's GUID, as it is invalidated when the task is finished
+	const FGuid CookTaskGUID = HAC->HapiGUID;
+
 	// Get the current task's progress
 	FHoudiniEngineTaskInfo TaskInfo;
 	if (!UpdateTaskStatus(HAC->HapiGUID, TaskInfo)
@@ -966,6 +1082,8 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 	{
 		// Couldnt get a valid task info
 		HOUDINI_LOG_ERROR(TEXT("    %s Failed to cook - invalid task"), *DisplayName);
+		CookTaskStartTimes.Remove(CookTaskGUID);
+		InterruptedCookTasks.Remove(CookTaskGUID);
 		NewState = EHoudiniAssetState::None;
 		bUpdateState = true;
 		return bUpdateState;
@@ -1013,6 +1131,16 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 	// If the task is still in progress, return now
 	if (!bUpdateState)
 		return false;
+
+	CookTaskStartTimes.Remove(CookTaskGUID);
+	if (InterruptedCookTasks.Remove(CookTaskGUID) > 0 && TaskInfo.TaskState == EHoudiniEngineTaskState::Aborted)
+	{
+		// We've interrupted this cook because the HAC was modified:
+		// discard its results and cook the latest changes right away
+		HOUDINI_LOG_MESSAGE(TEXT("   %s Cook interrupted - cooking the latest changes."), *DisplayName);
+		NewState = EHoudiniAssetState::PreCook;
+		return true;
+	}
 	   
 	// Handle PostCook
 	NewState = EHoudiniAssetState::PostCook;
@@ -1033,6 +1161,89 @@ FHoudiniEngineManager::UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetS
 	return true;
 }
 
+bool
+FHoudiniEngineManager::InterruptCookIfNeeded(UHoudiniAssetComponent* HAC)
+{
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bInterruptCookOnChange)
+		return false;
+
+	if (!HAC->HapiGUID.IsValid() || InterruptedCookTasks.Contains(HAC->HapiGUID))
+		return false;
+
+	// Leave short cooks a chance to finish
+	const double* CookStartTime = CookTaskStartTimes.Find(HAC->HapiGUID);
+	if (CookStartTime && (FPlatformTime::Seconds() - *CookStartTime) < HoudiniRuntimeSettings->CookInterruptMinDuration)
+		return false;
+
+	// Only interrupt the cook if parameters or inputs have changed since they were uploaded
+	if (!HAC->NeedUpdateParameters() && !HAC->NeedUpdateInputs())
+		return false;
+
+	HOUDINI_LOG_MESSAGE(TEXT("   %s was modified while cooking - interrupting the current cook."), *HAC->GetDisplayName());
+
+	FHoudiniEngine::Get().InterruptTask(HAC->HapiGUID);
+	InterruptedCookTasks.Add(HAC->HapiGUID);
+
+	return true;
+}
+
+// Returns a value that changes every time one of the HAC's parameters or inputs is marked as changed
+static uint64
+GetLatestChangeStamp(UHoudiniAssetComponent* HAC)
+{
+	// Stamps only grow: the sum of the latest parameter and input stamps changes with any new change
+	uint64 LatestParameterStamp = 0;
+	for (int32 ParamIdx = 0; ParamIdx < HAC->GetNumParameters(); ParamIdx++)
+	{
+		const UHoudiniParameter* Param = HAC->GetParameterAt(ParamIdx);
+		if (IsValid(Param))
+			LatestParameterStamp = FMath::Max(LatestParameterStamp, Param->GetChangeStamp());
+	}
+
+	uint64 LatestInputStamp = 0;
+	for (int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); InputIdx++)
+	{
+		const UHoudiniInput* Input = HAC->GetInputAt(InputIdx);
+		if (IsValid(Input))
+			LatestInputStamp = FMath::Max(LatestInputStamp, Input->GetChangeStamp());
+	}
+
+	return LatestParameterStamp + LatestInputStamp;
+}
+
+bool
+FHoudiniEngineManager::ShouldDebounceCook(UHoudiniAssetComponent* HAC)
+{
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const float DebounceDelay = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->CookDebounceDelay : 0.0f;
+
+	// Forced updates (recook, rebuild...) are never delayed
+	if (DebounceDelay <= 0.0f || HAC->bForceNeedUpdate)
+	{
+		PendingCooks.Remove(HAC);
+		return false;
+	}
+
+	// Every new change restarts the delay
+	const double CurrentTime = FPlatformTime::Seconds();
+	const uint64 ChangeStamp = GetLatestChangeStamp(HAC);
+	FPendingCook* PendingCook = PendingCooks.Find(HAC);
+	if (!PendingCook || PendingCook->ChangeStamp != ChangeStamp)
+	{
+		FPendingCook& NewPendingCook = PendingCooks.FindOrAdd(HAC);
+		NewPendingCook.LastChangeTime = CurrentTime;
+		NewPendingCook.ChangeStamp = ChangeStamp;
+		return true;
+	}
+
+	if ((CurrentTime - PendingCook->LastChangeTime) < DebounceDelay)
+		return true;
+
+	PendingCooks.Remove(HAC);
+	return false;
+}
+
 bool
 FHoudiniEngineManager::PreCook(UHoudiniAssetComponent* HAC)
 {
@@ -1064,10 +1275,16 @@ FHoudiniEngineManager::PreCook(UHoudiniAssetComponent* HAC)
 	}
 
 	// Try to upload changed parameters
-	FHoudiniParameterTranslator::UploadChangedParameters(HAC);
+	{
+		FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::ParameterSync);
+		FHoudiniParameterTranslator::UploadChangedParameters(HAC);
+	}
 
 	// Try to upload changed inputs
-	FHoudiniInputTranslator::UploadChangedInputs(HAC);
+	{
+		FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::InputUpload);
+		FHoudiniInputTranslator::UploadChangedInputs(HAC);
+	}
 
 	// Try to upload changed editable nodes
 	FHoudiniOutputTranslator::UploadChangedEditableOutput(HAC, false);
@@ -1113,7 +1330,10 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 		// Set new asset id.
 		HAC->AssetId = TaskAssetId;
 
-		FHoudiniParameterTranslator::UpdateParameters(HAC);
+		{
+			FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::ParameterSync);
+			FHoudiniParameterTranslator::UpdateParameters(HAC);
+		}
 
 		FHoudiniInputTranslator::UpdateInputs(HAC);
 
@@ -1122,6 +1342,9 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 		FHoudiniOutputTranslator::UpdateOutputs(HAC, ForceUpdate, bHasHoudiniStaticMeshOutput);
 		HAC->SetNoProxyMeshNextCookRequested(false);
 
+		// The temporary packages of the previous cook that weren't recreated can now be reclaimed
+		FHoudiniTempPackageTracker::Get().OnCookFinished(HAC->GetComponentGUID());
+
 		// Handles have to be updated after parameters
 		FHoudiniHandleTranslator::UpdateHandles(HAC);  
 
@@ -1142,8 +1365,8 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 
 		FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString("Finished processing outputs"), true);
 
-		// Trigger a details panel update
-		FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+		// Trigger a details panel update, rebuilding it only if the outputs changed its layout
+		FHoudiniEngineUtils::UpdateEditorPropertiesAfterCook(HAC);
 
 		// If any outputs have HoudiniStaticMeshes, and if timer based refinement is enabled on the HAC,
 		// set the RefineMeshesTimer and ensure BuildStaticMeshesForAllHoudiniStaticMeshes is bound to
@@ -1207,6 +1430,9 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 
 	//HAC->SyncToBlueprintGeneratedClass();
 
+	if (IsValid(HAC->GetHoudiniAsset()))
+		FHoudiniEngineTrace::BookmarkCookEnd(HAC->GetHoudiniAsset()->GetName(), bCookSuccess);
+
 	return bCookSuccess;
 }
 
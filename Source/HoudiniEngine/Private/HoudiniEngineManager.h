@@ -104,6 +104,14 @@ protected:
 	// Returns true if a state change should be made
 	bool UpdateCooking(UHoudiniAssetComponent* HAC, EHoudiniAssetState& NewState);
 
+	// Interrupts the HAC's cook if its parameters or inputs have been modified since the cook started
+	// Returns true if the cook has been interrupted
+	bool InterruptCookIfNeeded(UHoudiniAssetComponent* HAC);
+
+	// Returns true if the HAC's cook should be delayed to wait for more changes (see CookDebounceDelay).
+	// The delay restarts every time the HAC's parameters or inputs change again.
+	bool ShouldDebounceCook(UHoudiniAssetComponent* HAC);
+
 	// Called to update template components. 
 	bool PreCookTemplate(UHoudiniAssetComponent* HAC);
 
@@ -143,11 +151,22 @@ protected:
 	// Automatically try to start the First HE session if needed
 	void AutoStartFirstSessionIfNeeded(UHoudiniAssetComponent* InCurrentHAC);
 
+	// Ticker converting the registered legacy (v1) components. It runs independently of the manager's Tick(),
+	// so that legacy components get converted without a Houdini Engine session.
+	bool TickLegacyConversion(float DeltaTime);
+
+	// Converts the legacy (v1) data of some of the components in InComponents, selected components first.
+	// The number of conversions per tick is limited by HoudiniEngine.LegacyConversionsPerTick.
+	void ConvertPendingLegacyComponents(TArray<UHoudiniAssetComponent*>& InComponents);
+
 private:
 
 	// Ticker handle, used for processing HAC.
 	FDelegateHandle TickerHandle;
 
+	// Ticker handle, used for converting legacy HACs.
+	FDelegateHandle LegacyConversionTickerHandle;
+
 	// Current position in the array
 	uint32 CurrentIndex;
 
@@ -179,4 +198,22 @@ private:
 
 	// Indicates which HACs disable auto-saving
 	TSet<const UHoudiniAssetComponent*> DisableAutoSavingHACs;
+
+	// Start time of the cook tasks in progress
+	TMap<FGuid, double> CookTaskStartTimes;
+
+	// Cook tasks that have been interrupted because their HAC was modified
+	TSet<FGuid> InterruptedCookTasks;
+
+	// A HAC waiting for its debounce delay
+	struct FPendingCook
+	{
+		// Time at which the last change of the HAC was seen
+		double LastChangeTime;
+		// Change stamps of the HAC's parameters and inputs at that time
+		uint64 ChangeStamp;
+	};
+
+	// The HACs waiting for their debounce delay
+	TMap<const UHoudiniAssetComponent*, FPendingCook> PendingCooks;
 };
\ No newline at end of file
@@ -0,0 +1,1137 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineMockAPI.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HoudiniApi.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
+#include "HoudiniEngineOutputStats.h"
+
+#include "HAPI/HAPI_Version.h"
+#include "HAL/FileManager.h"
+#include "Serialization/Archive.h"
+
+// Identifies capture files, and their layout version
+#define HOUDINI_MOCK_CAPTURE_MAGIC 0x4B434D48
+#define HOUDINI_MOCK_CAPTURE_VERSION 1
+
+//
+// Capture serialization
+//
+
+// HAPI structs are plain C structs: they're serialized as is, which is why captures are tied to a HAPI version
+template<typename T>
+static void
+SerializeHapiStruct(FArchive& Ar, T& InOutStruct)
+{
+	Ar.Serialize(&InOutStruct, sizeof(T));
+}
+
+FArchive&
+operator<<(FArchive& Ar, HAPI_Transform& InOutTransform)
+{
+	SerializeHapiStruct(Ar, InOutTransform);
+	return Ar;
+}
+
+FArchive&
+operator<<(FArchive& Ar, FHoudiniMockAttribute& InOutAttribute)
+{
+	Ar << InOutAttribute.Name;
+	SerializeHapiStruct(Ar, InOutAttribute.Info);
+	Ar << InOutAttribute.FloatData;
+	Ar << InOutAttribute.IntData;
+	Ar << InOutAttribute.StringData;
+	return Ar;
+}
+
+FArchive&
+operator<<(FArchive& Ar, FHoudiniMockGroup& InOutGroup)
+{
+	Ar << InOutGroup.Name;
+	Ar << InOutGroup.GroupType;
+	Ar << InOutGroup.Membership;
+	return Ar;
+}
+
+FArchive&
+operator<<(FArchive& Ar, FHoudiniMockPart& InOutPart)
+{
+	SerializeHapiStruct(Ar, InOutPart.Info);
+	Ar << InOutPart.Name;
+	Ar << InOutPart.FaceCounts;
+	Ar << InOutPart.VertexList;
+	Ar << InOutPart.Attributes;
+	Ar << InOutPart.Groups;
+	Ar << InOutPart.InstancedPartIds;
+	Ar << InOutPart.InstanceTransforms;
+	return Ar;
+}
+
+FArchive&
+operator<<(FArchive& Ar, FHoudiniMockNode& InOutNode)
+{
+	SerializeHapiStruct(Ar, InOutNode.NodeInfo);
+	Ar << InOutNode.Name;
+	Ar << InOutNode.Path;
+
+	Ar << InOutNode.bHasAssetInfo;
+	if (InOutNode.bHasAssetInfo)
+		SerializeHapiStruct(Ar, InOutNode.AssetInfo);
+
+	Ar << InOutNode.bHasObjectInfo;
+	if (InOutNode.bHasObjectInfo)
+	{
+		SerializeHapiStruct(Ar, InOutNode.ObjectInfo);
+		SerializeHapiStruct(Ar, InOutNode.ObjectTransform);
+	}
+	Ar << InOutNode.DisplayGeoNodeId;
+	Ar << InOutNode.ComposedObjectIds;
+
+	Ar << InOutNode.bHasGeoInfo;
+	if (InOutNode.bHasGeoInfo)
+		SerializeHapiStruct(Ar, InOutNode.GeoInfo);
+	Ar << InOutNode.PointGroupNames;
+	Ar << InOutNode.PrimGroupNames;
+	Ar << InOutNode.Parts;
+	return Ar;
+}
+
+static bool
+SerializeCapture(FArchive& Ar, FHoudiniMockCapture& InOutCapture)
+{
+	uint32 Magic = HOUDINI_MOCK_CAPTURE_MAGIC;
+	int32 Version = HOUDINI_MOCK_CAPTURE_VERSION;
+	int32 HapiMajor = HAPI_VERSION_HOUDINI_ENGINE_MAJOR;
+	int32 HapiMinor = HAPI_VERSION_HOUDINI_ENGINE_MINOR;
+	int32 HapiApi = HAPI_VERSION_HOUDINI_ENGINE_API;
+	Ar << Magic;
+	Ar << Version;
+	Ar << HapiMajor;
+	Ar << HapiMinor;
+	Ar << HapiApi;
+
+	if (Magic != HOUDINI_MOCK_CAPTURE_MAGIC || Version != HOUDINI_MOCK_CAPTURE_VERSION)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Houdini Mock API: invalid or outdated capture file."));
+		return false;
+	}
+
+	if (HapiMajor != HAPI_VERSION_HOUDINI_ENGINE_MAJOR
+		|| HapiMinor != HAPI_VERSION_HOUDINI_ENGINE_MINOR
+		|| HapiApi != HAPI_VERSION_HOUDINI_ENGINE_API)
+	{
+		HOUDINI_LOG_ERROR(
+			TEXT("Houdini Mock API: the capture was made with Houdini Engine %d.%d.%d, expected %d.%d.%d."),
+			HapiMajor, HapiMinor, HapiApi,
+			HAPI_VERSION_HOUDINI_ENGINE_MAJOR, HAPI_VERSION_HOUDINI_ENGINE_MINOR, HAPI_VERSION_HOUDINI_ENGINE_API);
+		return false;
+	}
+
+	Ar << InOutCapture.RootNodeId;
+	Ar << InOutCapture.Nodes;
+	Ar << InOutCapture.Strings;
+
+	return !Ar.IsError();
+}
+
+const FHoudiniMockAttribute*
+FHoudiniMockPart::FindAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner) const
+{
+	for (const FHoudiniMockAttribute& CurAttribute : Attributes)
+	{
+		if (CurAttribute.Info.owner == InOwner && CurAttribute.Name.Equals(InName, ESearchCase::CaseSensitive))
+			return &CurAttribute;
+	}
+
+	return nullptr;
+}
+
+const FHoudiniMockGroup*
+FHoudiniMockPart::FindGroup(const FString& InName, const HAPI_GroupType& InGroupType) const
+{
+	for (const FHoudiniMockGroup& CurGroup : Groups)
+	{
+		if (CurGroup.GroupType == InGroupType && CurGroup.Name.Equals(InName, ESearchCase::CaseSensitive))
+			return &CurGroup;
+	}
+
+	return nullptr;
+}
+
+//
+// Capture of a live session
+//
+
+namespace HoudiniMockCapture
+{
+	static void
+	CaptureString(const HAPI_StringHandle& InHandle, FHoudiniMockCapture& OutCapture)
+	{
+		if (InHandle < 0 || OutCapture.Strings.Contains(InHandle))
+			return;
+
+		FString Value;
+		if (FHoudiniEngineString::ToFString(InHandle, Value))
+			OutCapture.Strings.Add(InHandle, Value);
+	}
+
+	static FHoudiniMockNode&
+	CaptureNodeInfo(const HAPI_NodeId& InNodeId, FHoudiniMockCapture& OutCapture)
+	{
+		FHoudiniMockNode* FoundNode = OutCapture.Nodes.Find(InNodeId);
+		if (FoundNode)
+			return *FoundNode;
+
+		FHoudiniMockNode& Node = OutCapture.Nodes.Add(InNodeId);
+		FHoudiniApi::NodeInfo_Init(&Node.NodeInfo);
+		FHoudiniApi::GetNodeInfo(FHoudiniEngine::Get().GetSession(), InNodeId, &Node.NodeInfo);
+		CaptureString(Node.NodeInfo.nameSH, OutCapture);
+		CaptureString(Node.NodeInfo.internalNodePathSH, OutCapture);
+		FHoudiniEngineString::ToFString(Node.NodeInfo.nameSH, Node.Name);
+
+		// Store the absolute path, relative paths are resolved when serving the capture
+		HAPI_StringHandle PathHandle = -1;
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodePath(FHoudiniEngine::Get().GetSession(), InNodeId, -1, &PathHandle))
+			FHoudiniEngineString::ToFString(PathHandle, Node.Path);
+
+		return Node;
+	}
+
+	static bool
+	CaptureAttributes(const HAPI_NodeId& InGeoId, FHoudiniMockPart& OutPart, FHoudiniMockCapture& OutCapture)
+	{
+		for (int32 Owner = 0; Owner < HAPI_ATTROWNER_MAX; Owner++)
+		{
+			const int32 AttributeCount = OutPart.Info.attributeCounts[Owner];
+			if (AttributeCount <= 0)
+				continue;
+
+			TArray<HAPI_StringHandle> NameHandles;
+			NameHandles.SetNumZeroed(AttributeCount);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
+				FHoudiniEngine::Get().GetSession(), InGeoId, OutPart.Info.id,
+				(HAPI_AttributeOwner)Owner, NameHandles.GetData(), AttributeCount), false);
+
+			for (const HAPI_StringHandle& CurHandle : NameHandles)
+			{
+				FHoudiniMockAttribute& Attribute = OutPart.Attributes.AddDefaulted_GetRef();
+				FHoudiniEngineString::ToFString(CurHandle, Attribute.Name);
+
+				FHoudiniApi::AttributeInfo_Init(&Attribute.Info);
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+					FHoudiniEngine::Get().GetSession(), InGeoId, OutPart.Info.id,
+					TCHAR_TO_UTF8(*Attribute.Name), (HAPI_AttributeOwner)Owner, &Attribute.Info), false);
+
+				const int32 ValueCount = Attribute.Info.count * Attribute.Info.tupleSize;
+				if (!Attribute.Info.exists || ValueCount <= 0)
+					continue;
+
+				switch (Attribute.Info.storage)
+				{
+					case HAPI_STORAGETYPE_FLOAT:
+					case HAPI_STORAGETYPE_FLOAT64:
+					{
+						Attribute.FloatData.SetNumZeroed(ValueCount);
+						HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeFloatData(
+							FHoudiniEngine::Get().GetSession(), InGeoId, OutPart.Info.id,
+							TCHAR_TO_UTF8(*Attribute.Name), &Attribute.Info, -1,
+							Attribute.FloatData.GetData(), 0, Attribute.Info.count), false);
+					}
+					break;
+
+					case HAPI_STORAGETYPE_STRING:
+					{
+						TArray<HAPI_StringHandle> ValueHandles;
+						ValueHandles.SetNumZeroed(ValueCount);
+						HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeStringData(
+							FHoudiniEngine::Get().GetSession(), InGeoId, OutPart.Info.id,
+							TCHAR_TO_UTF8(*Attribute.Name), &Attribute.Info,
+							ValueHandles.GetData(), 0, Attribute.Info.count), false);
+
+						FHoudiniEngineString::SHArrayToFStringArray(ValueHandles, Attribute.StringData);
+					}
+					break;
+
+					default:
+					{
+						// All the integer storages
+						Attribute.IntData.SetNumZeroed(ValueCount);
+						HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeIntData(
+							FHoudiniEngine::Get().GetSession(), InGeoId, OutPart.Info.id,
+							TCHAR_TO_UTF8(*Attribute.Name), &Attribute.Info, -1,
+							Attribute.IntData.GetData(), 0, Attribute.Info.count), false);
+					}
+					break;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	static bool
+	CapturePart(const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FHoudiniMockNode& OutGeoNode, FHoudiniMockCapture& OutCapture)
+	{
+		for (const FHoudiniMockPart& CurPart : OutGeoNode.Parts)
+		{
+			if (CurPart.Info.id == InPartId)
+				return true;
+		}
+
+		FHoudiniMockPart Part;
+		FHoudiniApi::PartInfo_Init(&Part.Info);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(
+			FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, &Part.Info), false);
+
+		CaptureString(Part.Info.nameSH, OutCapture);
+		FHoudiniEngineString::ToFString(Part.Info.nameSH, Part.Name);
+
+		if (Part.Info.faceCount > 0)
+		{
+			Part.FaceCounts.SetNumZeroed(Part.Info.faceCount);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetFaceCounts(
+				FHoudiniEngine::Get().GetSession(), InGeoId, InPartId,
+				Part.FaceCounts.GetData(), 0, Part.Info.faceCount), false);
+		}
+
+		if (Part.Info.vertexCount > 0)
+		{
+			Part.VertexList.SetNumZeroed(Part.Info.vertexCount);
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetVertexList(
+				FHoudiniEngine::Get().GetSession(), InGeoId, InPartId,
+				Part.VertexList.GetData(), 0, Part.Info.vertexCount), false);
+		}
+
+		if (!CaptureAttributes(InGeoId, Part, OutCapture))
+			return false;
+
+		// Group memberships
+		for (int32 GroupType = HAPI_GROUPTYPE_POINT; GroupType < HAPI_GROUPTYPE_MAX; GroupType++)
+		{
+			const TArray<FString>& GroupNames = (GroupType == HAPI_GROUPTYPE_POINT) ? OutGeoNode.PointGroupNames : OutGeoNode.PrimGroupNames;
+			const int32 ElementCount = (GroupType == HAPI_GROUPTYPE_POINT) ? Part.Info.pointCount : Part.Info.faceCount;
+			if (ElementCount <= 0)
+				continue;
+
+			for (const FString& CurGroupName : GroupNames)
+			{
+				FHoudiniMockGroup Group;
+				Group.Name = CurGroupName;
+				Group.GroupType = GroupType;
+				Group.Membership.SetNumZeroed(ElementCount);
+
+				HAPI_Bool AllEqual = false;
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetGroupMembership(
+					FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, (HAPI_GroupType)GroupType,
+					TCHAR_TO_UTF8(*CurGroupName), &AllEqual, Group.Membership.GetData(), 0, ElementCount))
+					continue;
+
+				Part.Groups.Add(Group);
+			}
+		}
+
+		// Packed primitives instancers
+		TArray<HAPI_PartId> InstancedPartIds;
+		if (Part.Info.type == HAPI_PARTTYPE_INSTANCER)
+		{
+			if (Part.Info.instancedPartCount > 0)
+			{
+				Part.InstancedPartIds.SetNumZeroed(Part.Info.instancedPartCount);
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetInstancedPartIds(
+					FHoudiniEngine::Get().GetSession(), InGeoId, InPartId,
+					Part.InstancedPartIds.GetData(), 0, Part.Info.instancedPartCount), false);
+				InstancedPartIds = Part.InstancedPartIds;
+			}
+
+			if (Part.Info.instanceCount > 0)
+			{
+				Part.InstanceTransforms.SetNumZeroed(Part.Info.instanceCount);
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetInstancerPartTransforms(
+					FHoudiniEngine::Get().GetSession(), InGeoId, InPartId, HAPI_SRT,
+					Part.InstanceTransforms.GetData(), 0, Part.Info.instanceCount), false);
+			}
+		}
+
+		OutGeoNode.Parts.Add(Part);
+
+		// The instanced parts are queried by id, they are not part of the geo's part count
+		for (const HAPI_PartId& CurInstancedPartId : InstancedPartIds)
+		{
+			if (!CapturePart(InGeoId, CurInstancedPartId, OutGeoNode, OutCapture))
+				return false;
+		}
+
+		return true;
+	}
+
+	static bool
+	CaptureGeo(const HAPI_GeoInfo& InGeoInfo, FHoudiniMockCapture& OutCapture)
+	{
+		FHoudiniMockNode& GeoNode = CaptureNodeInfo(InGeoInfo.nodeId, OutCapture);
+		if (GeoNode.bHasGeoInfo)
+			return true;
+
+		GeoNode.bHasGeoInfo = true;
+		GeoNode.GeoInfo = InGeoInfo;
+		CaptureString(InGeoInfo.nameSH, OutCapture);
+
+		FHoudiniEngineUtils::HapiGetGroupNames(InGeoInfo.nodeId, 0, HAPI_GROUPTYPE_POINT, false, GeoNode.PointGroupNames);
+		FHoudiniEngineUtils::HapiGetGroupNames(InGeoInfo.nodeId, 0, HAPI_GROUPTYPE_PRIM, false, GeoNode.PrimGroupNames);
+
+		// Copy the geo to avoid holding on to the node reference while the node map grows
+		FHoudiniMockNode CapturedGeo = GeoNode;
+		for (int32 PartId = 0; PartId < InGeoInfo.partCount; PartId++)
+		{
+			if (!CapturePart(InGeoInfo.nodeId, PartId, CapturedGeo, OutCapture))
+				return false;
+		}
+		OutCapture.Nodes.Add(InGeoInfo.nodeId, CapturedGeo);
+
+		return true;
+	}
+
+	static bool
+	CaptureObject(const HAPI_ObjectInfo& InObjectInfo, const HAPI_Transform& InTransform, FHoudiniMockCapture& OutCapture)
+	{
+		FHoudiniMockNode& ObjectNode = CaptureNodeInfo(InObjectInfo.nodeId, OutCapture);
+		ObjectNode.bHasObjectInfo = true;
+		ObjectNode.ObjectInfo = InObjectInfo;
+		ObjectNode.ObjectTransform = InTransform;
+		CaptureString(InObjectInfo.nameSH, OutCapture);
+		CaptureString(InObjectInfo.objectInstancePathSH, OutCapture);
+
+		HAPI_GeoInfo DisplayGeoInfo;
+		FHoudiniApi::GeoInfo_Init(&DisplayGeoInfo);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetDisplayGeoInfo(
+			FHoudiniEngine::Get().GetSession(), InObjectInfo.nodeId, &DisplayGeoInfo))
+			return true;
+
+		ObjectNode.DisplayGeoNodeId = DisplayGeoInfo.nodeId;
+		return CaptureGeo(DisplayGeoInfo, OutCapture);
+	}
+}
+
+bool
+FHoudiniEngineMockAPI::CaptureNode(const HAPI_NodeId& InNodeId, const FString& InCaptureFilePath)
+{
+	using namespace HoudiniMockCapture;
+
+	if (IsInstalled())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Houdini Mock API: captures can only be made from a live session."));
+		return false;
+	}
+
+	FHoudiniMockCapture Capture;
+	Capture.RootNodeId = InNodeId;
+
+	FHoudiniMockNode& RootNode = CaptureNodeInfo(InNodeId, Capture);
+	FHoudiniApi::AssetInfo_Init(&RootNode.AssetInfo);
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAssetInfo(FHoudiniEngine::Get().GetSession(), InNodeId, &RootNode.AssetInfo))
+	{
+		RootNode.bHasAssetInfo = true;
+		for (const HAPI_StringHandle& CurHandle : {
+			RootNode.AssetInfo.nameSH, RootNode.AssetInfo.labelSH, RootNode.AssetInfo.filePathSH,
+			RootNode.AssetInfo.versionSH, RootNode.AssetInfo.fullOpNameSH,
+			RootNode.AssetInfo.helpTextSH, RootNode.AssetInfo.helpURLSH })
+		{
+			CaptureString(CurHandle, Capture);
+		}
+	}
+
+	// Capture the objects the same way the output translator will query them
+	TArray<HAPI_ObjectInfo> ObjectInfos;
+	if (!FHoudiniEngineUtils::HapiGetObjectInfos(InNodeId, ObjectInfos))
+		return false;
+
+	TArray<HAPI_Transform> ObjectTransforms;
+	if (!FHoudiniEngineUtils::HapiGetObjectTransforms(InNodeId, ObjectTransforms))
+		return false;
+
+	if (Capture.Nodes[InNodeId].NodeInfo.type == HAPI_NODETYPE_OBJ && ObjectInfos.Num() > 0 && ObjectInfos[0].nodeId != InNodeId)
+	{
+		for (const HAPI_ObjectInfo& CurObjectInfo : ObjectInfos)
+			Capture.Nodes[InNodeId].ComposedObjectIds.Add(CurObjectInfo.nodeId);
+	}
+
+	for (int32 ObjectIdx = 0; ObjectIdx < ObjectInfos.Num(); ObjectIdx++)
+	{
+		const HAPI_Transform& ObjectTransform = ObjectTransforms.IsValidIndex(ObjectIdx) ? ObjectTransforms[ObjectIdx] : ObjectTransforms[0];
+		if (!CaptureObject(ObjectInfos[ObjectIdx], ObjectTransform, Capture))
+		{
+			HOUDINI_LOG_ERROR(TEXT("Houdini Mock API: failed to capture object %d of node %d."), ObjectIdx, InNodeId);
+			return false;
+		}
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*InCaptureFilePath));
+	if (!Writer.IsValid())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Houdini Mock API: could not write the capture file %s."), *InCaptureFilePath);
+		return false;
+	}
+
+	if (!SerializeCapture(*Writer, Capture))
+		return false;
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Houdini Mock API: captured %d nodes and %d strings from node %d to %s."),
+		Capture.Nodes.Num(), Capture.Strings.Num(), InNodeId, *InCaptureFilePath);
+
+	return Writer->Close();
+}
+
+bool
+FHoudiniEngineMockAPI::LoadCapture(const FString& InCaptureFilePath, FHoudiniMockCapture& OutCapture)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*InCaptureFilePath));
+	if (!Reader.IsValid())
+	{
+		HOUDINI_LOG_ERROR(TEXT("Houdini Mock API: could not read the capture file %s."), *InCaptureFilePath);
+		return false;
+	}
+
+	return SerializeCapture(*Reader, OutCapture);
+}
+
+//
+// Mock implementation of the HAPI functions
+//
+
+namespace HoudiniMockAPI
+{
+	// The capture currently being served
+	static FHoudiniMockCapture Capture;
+	// Strings created while serving the capture (attribute names and values, group names, paths)
+	static TMap<FString, HAPI_StringHandle> StringHandles;
+	static HAPI_StringHandle NextStringHandle = 0;
+	static bool bInstalled = false;
+
+	static HAPI_StringHandle
+	GetStringHandle(const FString& InString)
+	{
+		if (const HAPI_StringHandle* FoundHandle = StringHandles.Find(InString))
+			return *FoundHandle;
+
+		HAPI_StringHandle NewHandle = NextStringHandle++;
+		StringHandles.Add(InString, NewHandle);
+		Capture.Strings.Add(NewHandle, InString);
+		return NewHandle;
+	}
+
+	static const FHoudiniMockNode*
+	FindNode(const HAPI_NodeId& InNodeId)
+	{
+		return Capture.Nodes.Find(InNodeId);
+	}
+
+	static const FHoudiniMockPart*
+	FindPart(const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId)
+	{
+		const FHoudiniMockNode* Node = FindNode(InNodeId);
+		if (!Node)
+			return nullptr;
+
+		for (const FHoudiniMockPart& CurPart : Node->Parts)
+		{
+			if (CurPart.Info.id == InPartId)
+				return &CurPart;
+		}
+
+		return nullptr;
+	}
+
+	// Copies a range of tuples from the captured data, converting storage and tuple size as HAPI does
+	template<typename TOut, typename TIn>
+	static void
+	CopyTuples(const TArray<TIn>& InData, const int32& InTupleSize, TOut* OutData, const int32& InOutTupleSize, const int32& InStart, const int32& InLength)
+	{
+		const int32 CopySize = FMath::Min(InTupleSize, InOutTupleSize);
+		for (int32 Idx = 0; Idx < InLength; Idx++)
+		{
+			for (int32 Component = 0; Component < CopySize; Component++)
+			{
+				const int32 SourceIdx = (InStart + Idx) * InTupleSize + Component;
+				OutData[Idx * InOutTupleSize + Component] = InData.IsValidIndex(SourceIdx) ? (TOut)InData[SourceIdx] : (TOut)0;
+			}
+		}
+	}
+
+	template<typename T>
+	static void
+	InitToZero(T* InStruct)
+	{
+		FMemory::Memzero(InStruct, sizeof(T));
+	}
+
+	static void
+	InitTransform(HAPI_Transform* InTransform)
+	{
+		FMemory::Memzero(InTransform, sizeof(HAPI_Transform));
+		InTransform->rotationQuaternion[3] = 1.0f;
+		InTransform->scale[0] = InTransform->scale[1] = InTransform->scale[2] = 1.0f;
+		InTransform->rstOrder = HAPI_SRT;
+	}
+
+	static HAPI_Result
+	IsSessionValid(const HAPI_Session* Session)
+	{
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	IsInitialized(const HAPI_Session* Session)
+	{
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetStatus(const HAPI_Session* Session, HAPI_StatusType StatusType, int* Status)
+	{
+		if (!Status)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*Status = (StatusType == HAPI_STATUS_COOK_STATE) ? (int)HAPI_STATE_READY : (int)HAPI_RESULT_SUCCESS;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	CookNode(const HAPI_Session* Session, HAPI_NodeId NodeId, const HAPI_CookOptions* CookOptions)
+	{
+		// The capture holds cooked results already
+		return FindNode(NodeId) ? HAPI_RESULT_SUCCESS : HAPI_RESULT_INVALID_ARGUMENT;
+	}
+
+	static HAPI_Result
+	GetStringBufLength(const HAPI_Session* Session, HAPI_StringHandle StringHandle, int* BufferLength)
+	{
+		const FString* FoundString = Capture.Strings.Find(StringHandle);
+		if (!FoundString || !BufferLength)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		// Include the null terminator
+		*BufferLength = FCStringAnsi::Strlen(TCHAR_TO_UTF8(**FoundString)) + 1;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetString(const HAPI_Session* Session, HAPI_StringHandle StringHandle, char* StringValue, int Length)
+	{
+		const FString* FoundString = Capture.Strings.Find(StringHandle);
+		if (!FoundString || !StringValue || Length <= 0)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FCStringAnsi::Strncpy(StringValue, TCHAR_TO_UTF8(**FoundString), Length);
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	IsNodeValid(const HAPI_Session* Session, HAPI_NodeId NodeId, int UniqueNodeId, HAPI_Bool* Answer)
+	{
+		if (!Answer)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*Answer = FindNode(NodeId) != nullptr;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetNodeInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_NodeInfo* NodeInfo)
+	{
+		const FHoudiniMockNode* Node = FindNode(NodeId);
+		if (!Node || !NodeInfo)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*NodeInfo = Node->NodeInfo;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetNodePath(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_NodeId RelativeToNodeId, HAPI_StringHandle* Path)
+	{
+		const FHoudiniMockNode* Node = FindNode(NodeId);
+		if (!Node || !Path)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FString NodePath = Node->Path;
+		const FHoudiniMockNode* RelativeToNode = FindNode(RelativeToNodeId);
+		if (RelativeToNode && NodePath.StartsWith(RelativeToNode->Path + TEXT("/")))
+			NodePath.RightChopInline(RelativeToNode->Path.Len() + 1);
+
+		*Path = GetStringHandle(NodePath);
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetAssetInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_AssetInfo* AssetInfo)
+	{
+		const FHoudiniMockNode* Node = FindNode(NodeId);
+		if (!Node || !Node->bHasAssetInfo || !AssetInfo)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*AssetInfo = Node->AssetInfo;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetObjectInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_ObjectInfo* ObjectInfo)
+	{
+		const FHoudiniMockNode* Node = FindNode(NodeId);
+		if (!Node || !Node->bHasObjectInfo || !ObjectInfo)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*ObjectInfo = Node->ObjectInfo;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetObjectTransform(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_NodeId RelativeToNodeId, HAPI_RSTOrder RSTOrder, HAPI_Transform* Transform)
+	{
+		const FHoudiniMockNode* Node = FindNode(NodeId);
+		if (!Node || !Node->bHasObjectInfo || !Transform)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*Transform = Node->ObjectTransform;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	ComposeObjectList(const HAPI_Session* Session, HAPI_NodeId ParentNodeId, const char* Categories, int* ObjectCount)
+	{
+		const FHoudiniMockNode* Node = FindNode(ParentNodeId);
+		if (!Node || !ObjectCount)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*ObjectCount = Node->ComposedObjectIds.Num();
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetComposedObjectList(const HAPI_Session* Session, HAPI_NodeId ParentNodeId, HAPI_ObjectInfo* ObjectInfos, int Start, int Length)
+	{
+		const FHoudiniMockNode* Node = FindNode(ParentNodeId);
+		if (!Node || !ObjectInfos || Start < 0 || Start + Length > Node->ComposedObjectIds.Num())
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		for (int32 Idx = 0; Idx < Length; Idx++)
+		{
+			if (HAPI_RESULT_SUCCESS != GetObjectInfo(Session, Node->ComposedObjectIds[Start + Idx], &ObjectInfos[Idx]))
+				return HAPI_RESULT_FAILURE;
+		}
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetComposedObjectTransforms(const HAPI_Session* Session, HAPI_NodeId ParentNodeId, HAPI_RSTOrder RSTOrder, HAPI_Transform* Transforms, int Start, int Length)
+	{
+		const FHoudiniMockNode* Node = FindNode(ParentNodeId);
+		if (!Node || !Transforms || Start < 0 || Start + Length > Node->ComposedObjectIds.Num())
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		for (int32 Idx = 0; Idx < Length; Idx++)
+		{
+			if (HAPI_RESULT_SUCCESS != GetObjectTransform(Session, Node->ComposedObjectIds[Start + Idx], -1, RSTOrder, &Transforms[Idx]))
+				return HAPI_RESULT_FAILURE;
+		}
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	ComposeChildNodeList(const HAPI_Session* Session, HAPI_NodeId ParentNodeId, HAPI_NodeTypeBits NodeTypeFilter, HAPI_NodeFlagsBits NodeFlagsFilter, HAPI_Bool bRecursive, int* Count)
+	{
+		if (!Count)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		// Editable and templated nodes are not captured
+		*Count = 0;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetGeoInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_GeoInfo* GeoInfo)
+	{
+		const FHoudiniMockNode* Node = FindNode(NodeId);
+		if (!Node || !Node->bHasGeoInfo || !GeoInfo)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*GeoInfo = Node->GeoInfo;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetDisplayGeoInfo(const HAPI_Session* Session, HAPI_NodeId ObjectNodeId, HAPI_GeoInfo* GeoInfo)
+	{
+		const FHoudiniMockNode* Node = FindNode(ObjectNodeId);
+		if (!Node)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		return GetGeoInfo(Session, Node->DisplayGeoNodeId, GeoInfo);
+	}
+
+	static HAPI_Result
+	GetPartInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, HAPI_PartInfo* PartInfo)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !PartInfo)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		*PartInfo = Part->Info;
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetFaceCounts(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, int* FaceCounts, int Start, int Length)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !FaceCounts || Start < 0 || Start + Length > Part->FaceCounts.Num())
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FMemory::Memcpy(FaceCounts, Part->FaceCounts.GetData() + Start, Length * sizeof(int32));
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetVertexList(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, int* VertexList, int Start, int Length)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !VertexList || Start < 0 || Start + Length > Part->VertexList.Num())
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FMemory::Memcpy(VertexList, Part->VertexList.GetData() + Start, Length * sizeof(int32));
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetAttributeNames(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, HAPI_AttributeOwner Owner, HAPI_StringHandle* AttributeNames, int Count)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !AttributeNames)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		int32 NameIdx = 0;
+		for (const FHoudiniMockAttribute& CurAttribute : Part->Attributes)
+		{
+			if (NameIdx >= Count)
+				break;
+
+			if (CurAttribute.Info.owner == Owner)
+				AttributeNames[NameIdx++] = GetStringHandle(CurAttribute.Name);
+		}
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetAttributeInfo(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, const char* Name, HAPI_AttributeOwner Owner, HAPI_AttributeInfo* AttributeInfo)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !Name || !AttributeInfo)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		const FString AttributeName = UTF8_TO_TCHAR(Name);
+		const FHoudiniMockAttribute* Attribute = nullptr;
+		if (Owner == HAPI_ATTROWNER_INVALID)
+		{
+			// Like HAPI, search the owners by order of precedence
+			for (int32 CurOwner = 0; CurOwner < HAPI_ATTROWNER_MAX && !Attribute; CurOwner++)
+				Attribute = Part->FindAttribute(AttributeName, (HAPI_AttributeOwner)CurOwner);
+		}
+		else
+		{
+			Attribute = Part->FindAttribute(AttributeName, Owner);
+		}
+
+		if (Attribute)
+		{
+			*AttributeInfo = Attribute->Info;
+		}
+		else
+		{
+			// Missing attributes are not an error
+			InitToZero(AttributeInfo);
+			AttributeInfo->exists = false;
+			AttributeInfo->owner = Owner;
+			AttributeInfo->storage = HAPI_STORAGETYPE_INVALID;
+		}
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static const FHoudiniMockAttribute*
+	FindAttributeForData(const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId, const char* InName, const HAPI_AttributeInfo* InAttributeInfo, const int32& InStart, const int32& InLength)
+	{
+		const FHoudiniMockPart* Part = FindPart(InNodeId, InPartId);
+		if (!Part || !InName || !InAttributeInfo || InStart < 0 || InLength < 0)
+			return nullptr;
+
+		const FHoudiniMockAttribute* Attribute = Part->FindAttribute(UTF8_TO_TCHAR(InName), InAttributeInfo->owner);
+		if (!Attribute || InStart + InLength > Attribute->Info.count)
+			return nullptr;
+
+		return Attribute;
+	}
+
+	static HAPI_Result
+	GetAttributeFloatData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, float* Data, int Start, int Length)
+	{
+		const FHoudiniMockAttribute* Attribute = FindAttributeForData(NodeId, PartId, Name, AttributeInfo, Start, Length);
+		if (!Attribute || !Data)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		const int32 OutTupleSize = (Stride > 0) ? Stride : AttributeInfo->tupleSize;
+		if (Attribute->FloatData.Num() > 0)
+			CopyTuples(Attribute->FloatData, Attribute->Info.tupleSize, Data, OutTupleSize, Start, Length);
+		else
+			CopyTuples(Attribute->IntData, Attribute->Info.tupleSize, Data, OutTupleSize, Start, Length);
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetAttributeIntData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, int Stride, int* Data, int Start, int Length)
+	{
+		const FHoudiniMockAttribute* Attribute = FindAttributeForData(NodeId, PartId, Name, AttributeInfo, Start, Length);
+		if (!Attribute || !Data)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		const int32 OutTupleSize = (Stride > 0) ? Stride : AttributeInfo->tupleSize;
+		if (Attribute->IntData.Num() > 0)
+			CopyTuples(Attribute->IntData, Attribute->Info.tupleSize, Data, OutTupleSize, Start, Length);
+		else
+			CopyTuples(Attribute->FloatData, Attribute->Info.tupleSize, Data, OutTupleSize, Start, Length);
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetAttributeStringData(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, const char* Name, HAPI_AttributeInfo* AttributeInfo, HAPI_StringHandle* Data, int Start, int Length)
+	{
+		const FHoudiniMockAttribute* Attribute = FindAttributeForData(NodeId, PartId, Name, AttributeInfo, Start, Length);
+		if (!Attribute || !Data || Attribute->StringData.Num() <= 0)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		const int32 TupleSize = Attribute->Info.tupleSize;
+		for (int32 Idx = Start * TupleSize; Idx < (Start + Length) * TupleSize; Idx++)
+		{
+			Data[Idx - Start * TupleSize] = Attribute->StringData.IsValidIndex(Idx) ? GetStringHandle(Attribute->StringData[Idx]) : GetStringHandle(FString());
+		}
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetGroupNames(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_GroupType GroupType, HAPI_StringHandle* GroupNames, int GroupCount)
+	{
+		const FHoudiniMockNode* Node = FindNode(NodeId);
+		if (!Node || !GroupNames)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		const TArray<FString>& Names = (GroupType == HAPI_GROUPTYPE_POINT) ? Node->PointGroupNames : Node->PrimGroupNames;
+		for (int32 Idx = 0; Idx < GroupCount && Idx < Names.Num(); Idx++)
+			GroupNames[Idx] = GetStringHandle(Names[Idx]);
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetGroupMembership(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, HAPI_GroupType GroupType, const char* GroupName, HAPI_Bool* AllEqual, int* Membership, int Start, int Length)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !GroupName || !Membership)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		const FHoudiniMockGroup* Group = Part->FindGroup(UTF8_TO_TCHAR(GroupName), GroupType);
+		if (!Group || Start < 0 || Start + Length > Group->Membership.Num())
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		bool bAllEqual = true;
+		for (int32 Idx = 0; Idx < Length; Idx++)
+		{
+			Membership[Idx] = Group->Membership[Start + Idx];
+			bAllEqual &= (Membership[Idx] == Membership[0]);
+		}
+
+		if (AllEqual)
+			*AllEqual = bAllEqual;
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetMaterialNodeIdsOnFaces(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, HAPI_Bool* AreAllTheSame, HAPI_NodeId* MaterialIds, int Start, int Length)
+	{
+		if (!MaterialIds)
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		// Materials are not captured
+		if (AreAllTheSame)
+			*AreAllTheSame = true;
+
+		for (int32 Idx = 0; Idx < Length; Idx++)
+			MaterialIds[Idx] = -1;
+
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetInstancedPartIds(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, HAPI_PartId* InstancedParts, int Start, int Length)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !InstancedParts || Start < 0 || Start + Length > Part->InstancedPartIds.Num())
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FMemory::Memcpy(InstancedParts, Part->InstancedPartIds.GetData() + Start, Length * sizeof(HAPI_PartId));
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	GetInstancerPartTransforms(const HAPI_Session* Session, HAPI_NodeId NodeId, HAPI_PartId PartId, HAPI_RSTOrder RSTOrder, HAPI_Transform* Transforms, int Start, int Length)
+	{
+		const FHoudiniMockPart* Part = FindPart(NodeId, PartId);
+		if (!Part || !Transforms || Start < 0 || Start + Length > Part->InstanceTransforms.Num())
+			return HAPI_RESULT_INVALID_ARGUMENT;
+
+		FMemory::Memcpy(Transforms, Part->InstanceTransforms.GetData() + Start, Length * sizeof(HAPI_Transform));
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	// Setters and node edition calls: accepted but ignored, as the capture holds the results
+	static HAPI_Result
+	SetParmStringValue(const HAPI_Session* Session, HAPI_NodeId NodeId, const char* Value, HAPI_ParmId ParmId, int Index)
+	{
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	SetParmIntValue(const HAPI_Session* Session, HAPI_NodeId NodeId, const char* ParmName, int Index, int Value)
+	{
+		return HAPI_RESULT_SUCCESS;
+	}
+
+	static HAPI_Result
+	DeleteNode(const HAPI_Session* Session, HAPI_NodeId NodeId)
+	{
+		return HAPI_RESULT_SUCCESS;
+	}
+}
+
+bool
+FHoudiniEngineMockAPI::Install(const FString& InCaptureFilePath)
+{
+	using namespace HoudiniMockAPI;
+
+	FHoudiniMockCapture NewCapture;
+	if (!LoadCapture(InCaptureFilePath, NewCapture))
+		return false;
+
+	Capture = MoveTemp(NewCapture);
+	StringHandles.Empty();
+	NextStringHandle = 0;
+	for (const auto& CurString : Capture.Strings)
+		NextStringHandle = FMath::Max(NextStringHandle, CurString.Key + 1);
+
+	// Start from the empty stubs, so every call that isn't mocked fails
+	FHoudiniApi::FinalizeHAPI();
+
+	FHoudiniApi::AssetInfo_Init = &InitToZero<HAPI_AssetInfo>;
+	FHoudiniApi::AttributeInfo_Init = &InitToZero<HAPI_AttributeInfo>;
+	FHoudiniApi::CookOptions_Init = &InitToZero<HAPI_CookOptions>;
+	FHoudiniApi::CurveInfo_Init = &InitToZero<HAPI_CurveInfo>;
+	FHoudiniApi::GeoInfo_Init = &InitToZero<HAPI_GeoInfo>;
+	FHoudiniApi::ImageInfo_Init = &InitToZero<HAPI_ImageInfo>;
+	FHoudiniApi::MaterialInfo_Init = &InitToZero<HAPI_MaterialInfo>;
+	FHoudiniApi::NodeInfo_Init = &InitToZero<HAPI_NodeInfo>;
+	FHoudiniApi::ObjectInfo_Init = &InitToZero<HAPI_ObjectInfo>;
+	FHoudiniApi::ParmInfo_Init = &InitToZero<HAPI_ParmInfo>;
+	FHoudiniApi::PartInfo_Init = &InitToZero<HAPI_PartInfo>;
+	FHoudiniApi::VolumeInfo_Init = &InitToZero<HAPI_VolumeInfo>;
+	FHoudiniApi::Transform_Init = &InitTransform;
+
+	FHoudiniApi::IsSessionValid = &HoudiniMockAPI::IsSessionValid;
+	FHoudiniApi::IsInitialized = &HoudiniMockAPI::IsInitialized;
+	FHoudiniApi::GetStatus = &HoudiniMockAPI::GetStatus;
+	FHoudiniApi::CookNode = &HoudiniMockAPI::CookNode;
+	FHoudiniApi::GetStringBufLength = &HoudiniMockAPI::GetStringBufLength;
+	FHoudiniApi::GetString = &HoudiniMockAPI::GetString;
+	FHoudiniApi::IsNodeValid = &HoudiniMockAPI::IsNodeValid;
+	FHoudiniApi::GetNodeInfo = &HoudiniMockAPI::GetNodeInfo;
+	FHoudiniApi::GetNodePath = &HoudiniMockAPI::GetNodePath;
+	FHoudiniApi::GetAssetInfo = &HoudiniMockAPI::GetAssetInfo;
+	FHoudiniApi::GetObjectInfo = &HoudiniMockAPI::GetObjectInfo;
+	FHoudiniApi::GetObjectTransform = &HoudiniMockAPI::GetObjectTransform;
+	FHoudiniApi::ComposeObjectList = &HoudiniMockAPI::ComposeObjectList;
+	FHoudiniApi::GetComposedObjectList = &HoudiniMockAPI::GetComposedObjectList;
+	FHoudiniApi::GetComposedObjectTransforms = &HoudiniMockAPI::GetComposedObjectTransforms;
+	FHoudiniApi::ComposeChildNodeList = &HoudiniMockAPI::ComposeChildNodeList;
+	FHoudiniApi::GetGeoInfo = &HoudiniMockAPI::GetGeoInfo;
+	FHoudiniApi::GetDisplayGeoInfo = &HoudiniMockAPI::GetDisplayGeoInfo;
+	FHoudiniApi::GetPartInfo = &HoudiniMockAPI::GetPartInfo;
+	FHoudiniApi::GetFaceCounts = &HoudiniMockAPI::GetFaceCounts;
+	FHoudiniApi::GetVertexList = &HoudiniMockAPI::GetVertexList;
+	FHoudiniApi::GetAttributeNames = &HoudiniMockAPI::GetAttributeNames;
+	FHoudiniApi::GetAttributeInfo = &HoudiniMockAPI::GetAttributeInfo;
+	FHoudiniApi::GetAttributeFloatData = &HoudiniMockAPI::GetAttributeFloatData;
+	FHoudiniApi::GetAttributeIntData = &HoudiniMockAPI::GetAttributeIntData;
+	FHoudiniApi::GetAttributeStringData = &HoudiniMockAPI::GetAttributeStringData;
+	FHoudiniApi::GetGroupNames = &HoudiniMockAPI::GetGroupNames;
+	FHoudiniApi::GetGroupMembership = &HoudiniMockAPI::GetGroupMembership;
+	FHoudiniApi::GetMaterialNodeIdsOnFaces = &HoudiniMockAPI::GetMaterialNodeIdsOnFaces;
+	FHoudiniApi::GetInstancedPartIds = &HoudiniMockAPI::GetInstancedPartIds;
+	FHoudiniApi::GetInstancerPartTransforms = &HoudiniMockAPI::GetInstancerPartTransforms;
+	FHoudiniApi::SetParmStringValue = &HoudiniMockAPI::SetParmStringValue;
+	FHoudiniApi::SetParmIntValue = &HoudiniMockAPI::SetParmIntValue;
+	FHoudiniApi::DeleteNode = &HoudiniMockAPI::DeleteNode;
+
+	// Keep the cook report's transfer counters working on the mock
+	FHoudiniEngineCookReport::InstallTransferCounters();
+
+	bInstalled = true;
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Houdini Mock API: serving %d captured nodes from %s."),
+		Capture.Nodes.Num(), *InCaptureFilePath);
+
+	return true;
+}
+
+bool
+FHoudiniEngineMockAPI::IsInstalled()
+{
+	return HoudiniMockAPI::bInstalled && FHoudiniApi::IsInitialized == &HoudiniMockAPI::IsInitialized;
+}
+
+HAPI_NodeId
+FHoudiniEngineMockAPI::GetRootNodeId()
+{
+	return HoudiniMockAPI::Capture.RootNodeId;
+}
@@ -0,0 +1,129 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+
+// Geometry of a captured part
+struct FHoudiniMockAttribute
+{
+	FString Name;
+	HAPI_AttributeInfo Info;
+
+	// Depending on the storage, only one of these is filled
+	TArray<float> FloatData;
+	TArray<int32> IntData;
+	TArray<FString> StringData;
+};
+
+struct FHoudiniMockGroup
+{
+	FString Name;
+	int32 GroupType = HAPI_GROUPTYPE_INVALID;
+	TArray<int32> Membership;
+};
+
+struct FHoudiniMockPart
+{
+	HAPI_PartInfo Info;
+	FString Name;
+
+	TArray<int32> FaceCounts;
+	TArray<int32> VertexList;
+	TArray<FHoudiniMockAttribute> Attributes;
+	TArray<FHoudiniMockGroup> Groups;
+
+	// Packed primitive instancers
+	TArray<HAPI_PartId> InstancedPartIds;
+	TArray<HAPI_Transform> InstanceTransforms;
+
+	const FHoudiniMockAttribute* FindAttribute(const FString& InName, const HAPI_AttributeOwner& InOwner) const;
+	const FHoudiniMockGroup* FindGroup(const FString& InName, const HAPI_GroupType& InGroupType) const;
+};
+
+// A captured HAPI node and the informations that were queried for it
+struct FHoudiniMockNode
+{
+	HAPI_NodeInfo NodeInfo;
+	FString Name;
+	FString Path;
+
+	bool bHasAssetInfo = false;
+	HAPI_AssetInfo AssetInfo;
+
+	bool bHasObjectInfo = false;
+	HAPI_ObjectInfo ObjectInfo;
+	HAPI_Transform ObjectTransform;
+	// For OBJ nodes: the display geo node
+	HAPI_NodeId DisplayGeoNodeId = -1;
+	// For OBJ subnets: the composed object list
+	TArray<HAPI_NodeId> ComposedObjectIds;
+
+	bool bHasGeoInfo = false;
+	HAPI_GeoInfo GeoInfo;
+	TArray<FString> PointGroupNames;
+	TArray<FString> PrimGroupNames;
+	TArray<FHoudiniMockPart> Parts;
+};
+
+// A capture of the cooked results of a node, that can be served by the mock HAPI backend
+struct FHoudiniMockCapture
+{
+	HAPI_NodeId RootNodeId = -1;
+	TMap<HAPI_NodeId, FHoudiniMockNode> Nodes;
+	// The strings referenced by the string handles stored in the captured HAPI structs
+	TMap<HAPI_StringHandle, FString> Strings;
+};
+
+// Replaces FHoudiniApi's function pointers with a local implementation that serves the geometry,
+// attributes and cook results of a capture of a live session, so that the translators can run (and be
+// benchmarked) without Houdini. The mock is deterministic: the same capture always produces the same results.
+// Only the queries made when building outputs (objects, geos, parts, attributes, groups, instancers) are
+// supported. Setters and node creation succeed without doing anything, other queries fail.
+class HOUDINIENGINE_API FHoudiniEngineMockAPI
+{
+	public:
+
+		// Captures the cooked results of a node from the current (live) session and saves them to a file
+		static bool CaptureNode(const HAPI_NodeId& InNodeId, const FString& InCaptureFilePath);
+
+		// Loads a capture file
+		static bool LoadCapture(const FString& InCaptureFilePath, FHoudiniMockCapture& OutCapture);
+
+		// Binds FHoudiniApi to the mock implementation, serving the given capture
+		static bool Install(const FString& InCaptureFilePath);
+
+		// Returns true if FHoudiniApi is currently bound to the mock
+		static bool IsInstalled();
+
+		// The node the capture was made from
+		static HAPI_NodeId GetRootNodeId();
+
+		// Session type used for mock sessions
+		static const HAPI_SessionType MockSessionType = HAPI_SESSION_CUSTOM1;
+};
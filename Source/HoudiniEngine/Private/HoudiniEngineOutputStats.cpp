@@ -26,10 +26,111 @@
 
 #include "HoudiniEngineOutputStats.h"
 
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniApi.h"
+#include "HoudiniEngineTrace.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+
 FHoudiniEngineOutputStats::FHoudiniEngineOutputStats()
 	: NumPackagesCreated(0)
 	, NumPackagesUpdated(0)
-{ }
+	, NumCooks(0)
+	, BytesUploaded(0)
+	, BytesDownloaded(0)
+{
+	for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniCookPhase::Count; PhaseIdx++)
+	{
+		PhaseSeconds[PhaseIdx] = 0.0;
+		PhaseCalls[PhaseIdx] = 0;
+	}
+}
+
+const TCHAR*
+FHoudiniEngineOutputStats::GetCookPhaseName(EHoudiniCookPhase InPhase)
+{
+	switch (InPhase)
+	{
+		case EHoudiniCookPhase::InputUpload:
+			return TEXT("InputUpload");
+		case EHoudiniCookPhase::CookWait:
+			return TEXT("CookWait");
+		case EHoudiniCookPhase::ParameterSync:
+			return TEXT("ParameterSync");
+		case EHoudiniCookPhase::OutputFetch:
+			return TEXT("OutputFetch");
+		case EHoudiniCookPhase::MeshBuild:
+			return TEXT("MeshBuild");
+		case EHoudiniCookPhase::Collision:
+			return TEXT("Collision");
+		case EHoudiniCookPhase::MaterialTexture:
+			return TEXT("MaterialTexture");
+		case EHoudiniCookPhase::Instancer:
+			return TEXT("Instancer");
+		case EHoudiniCookPhase::Landscape:
+			return TEXT("Landscape");
+		default:
+			break;
+	}
+
+	return TEXT("Unknown");
+}
+
+void
+FHoudiniEngineOutputStats::NotifyPhaseTime(EHoudiniCookPhase InPhase, double InSeconds, const FString& InOutputType)
+{
+	if (InPhase >= EHoudiniCookPhase::Count)
+		return;
+
+	PhaseSeconds[(int32)InPhase] += InSeconds;
+	PhaseCalls[(int32)InPhase]++;
+
+	if (InPhase == EHoudiniCookPhase::OutputFetch && !InOutputType.IsEmpty())
+		OutputFetchSecondsPerType.FindOrAdd(InOutputType, 0.0) += InSeconds;
+}
+
+void
+FHoudiniEngineOutputStats::Accumulate(const FHoudiniEngineOutputStats& InOther)
+{
+	NumPackagesCreated += InOther.NumPackagesCreated;
+	NumPackagesUpdated += InOther.NumPackagesUpdated;
+	NumCooks += InOther.NumCooks;
+	BytesUploaded += InOther.BytesUploaded;
+	BytesDownloaded += InOther.BytesDownloaded;
+
+	for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniCookPhase::Count; PhaseIdx++)
+	{
+		PhaseSeconds[PhaseIdx] += InOther.PhaseSeconds[PhaseIdx];
+		PhaseCalls[PhaseIdx] += InOther.PhaseCalls[PhaseIdx];
+	}
+
+	for (const auto& Pair : InOther.OutputFetchSecondsPerType)
+		OutputFetchSecondsPerType.FindOrAdd(Pair.Key, 0.0) += Pair.Value;
+
+	for (const auto& Pair : InOther.OutputObjectsCreated)
+		OutputObjectsCreated.FindOrAdd(Pair.Key, 0) += Pair.Value;
+
+	for (const auto& Pair : InOther.OutputObjectsUpdated)
+		OutputObjectsUpdated.FindOrAdd(Pair.Key, 0) += Pair.Value;
+
+	for (const auto& Pair : InOther.OutputObjectsReplaced)
+		OutputObjectsReplaced.FindOrAdd(Pair.Key, 0) += Pair.Value;
+}
+
+double
+FHoudiniEngineOutputStats::GetTotalSeconds() const
+{
+	double Total = 0.0;
+	for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniCookPhase::Count; PhaseIdx++)
+		Total += PhaseSeconds[PhaseIdx];
+
+	return Total;
+}
 
 void FHoudiniEngineOutputStats::NotifyPackageCreated(int32 NumCreated)
 {
@@ -57,4 +158,483 @@ void FHoudiniEngineOutputStats::NotifyObjectsReplaced(const FString& ObjectTypeN
 {
 	const int32 Count = OutputObjectsReplaced.FindOrAdd(ObjectTypeName, 0);
 	OutputObjectsReplaced[ObjectTypeName] = Count + NumReplaced;
-}
\ No newline at end of file
+}
+
+FHoudiniEngineCookReport&
+FHoudiniEngineCookReport::Get()
+{
+	static FHoudiniEngineCookReport Report;
+	return Report;
+}
+
+// Wrappers around HAPI's bulk data functions, recording the size of the data transferred to/from the session.
+// Transfers are only recorded on the game thread, as the report isn't thread safe.
+namespace HoudiniCookReportTransfers
+{
+	static FHoudiniApi::GetAttributeFloatDataFuncPtr GetAttributeFloatData = nullptr;
+	static FHoudiniApi::GetAttributeIntDataFuncPtr GetAttributeIntData = nullptr;
+	static FHoudiniApi::GetAttributeStringDataFuncPtr GetAttributeStringData = nullptr;
+	static FHoudiniApi::GetVertexListFuncPtr GetVertexList = nullptr;
+	static FHoudiniApi::GetFaceCountsFuncPtr GetFaceCounts = nullptr;
+	static FHoudiniApi::GetHeightFieldDataFuncPtr GetHeightFieldData = nullptr;
+	static FHoudiniApi::SetAttributeFloatDataFuncPtr SetAttributeFloatData = nullptr;
+	static FHoudiniApi::SetAttributeIntDataFuncPtr SetAttributeIntData = nullptr;
+	static FHoudiniApi::SetAttributeStringDataFuncPtr SetAttributeStringData = nullptr;
+	static FHoudiniApi::SetVertexListFuncPtr SetVertexList = nullptr;
+	static FHoudiniApi::SetFaceCountsFuncPtr SetFaceCounts = nullptr;
+	static FHoudiniApi::SetHeightFieldDataFuncPtr SetHeightFieldData = nullptr;
+
+	static int64 GetNumValues(const HAPI_AttributeInfo* InAttributeInfo, int InLength)
+	{
+		const int32 TupleSize = InAttributeInfo ? FMath::Max(InAttributeInfo->tupleSize, 1) : 1;
+		return (int64)FMath::Max(InLength, 0) * TupleSize;
+	}
+
+	static void RecordDownload(HAPI_Result InResult, int64 InNumBytes)
+	{
+		if (InResult != HAPI_RESULT_SUCCESS)
+			return;
+
+		FHoudiniEngineTrace::NotifyBytesDownloaded(InNumBytes);
+		if (IsInGameThread())
+			FHoudiniEngineCookReport::Get().NotifyBytesDownloaded(InNumBytes);
+	}
+
+	static void RecordUpload(HAPI_Result InResult, int64 InNumBytes)
+	{
+		if (InResult != HAPI_RESULT_SUCCESS)
+			return;
+
+		FHoudiniEngineTrace::NotifyBytesUploaded(InNumBytes);
+		if (IsInGameThread())
+			FHoudiniEngineCookReport::Get().NotifyBytesUploaded(InNumBytes);
+	}
+
+	static HAPI_Result CountedGetAttributeFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, float * data_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI GetAttributeFloatData"));
+		HAPI_Result Result = GetAttributeFloatData(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		RecordDownload(Result, GetNumValues(attr_info, length) * sizeof(float));
+		return Result;
+	}
+
+	static HAPI_Result CountedGetAttributeIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, int stride, int * data_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI GetAttributeIntData"));
+		HAPI_Result Result = GetAttributeIntData(session, node_id, part_id, name, attr_info, stride, data_array, start, length);
+		RecordDownload(Result, GetNumValues(attr_info, length) * sizeof(int));
+		return Result;
+	}
+
+	static HAPI_Result CountedGetAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, HAPI_AttributeInfo * attr_info, HAPI_StringHandle * data_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI GetAttributeStringData"));
+		// Only the string handles are counted, not the strings fetched from them
+		HAPI_Result Result = GetAttributeStringData(session, node_id, part_id, name, attr_info, data_array, start, length);
+		RecordDownload(Result, GetNumValues(attr_info, length) * sizeof(HAPI_StringHandle));
+		return Result;
+	}
+
+	static HAPI_Result CountedGetVertexList(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * vertex_list_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI GetVertexList"));
+		HAPI_Result Result = GetVertexList(session, node_id, part_id, vertex_list_array, start, length);
+		RecordDownload(Result, GetNumValues(nullptr, length) * sizeof(int));
+		return Result;
+	}
+
+	static HAPI_Result CountedGetFaceCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, int * face_counts_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI GetFaceCounts"));
+		HAPI_Result Result = GetFaceCounts(session, node_id, part_id, face_counts_array, start, length);
+		RecordDownload(Result, GetNumValues(nullptr, length) * sizeof(int));
+		return Result;
+	}
+
+	static HAPI_Result CountedGetHeightFieldData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, float * values_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI GetHeightFieldData"));
+		HAPI_Result Result = GetHeightFieldData(session, node_id, part_id, values_array, start, length);
+		RecordDownload(Result, GetNumValues(nullptr, length) * sizeof(float));
+		return Result;
+	}
+
+	static HAPI_Result CountedSetAttributeFloatData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const float * data_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI SetAttributeFloatData"));
+		HAPI_Result Result = SetAttributeFloatData(session, node_id, part_id, name, attr_info, data_array, start, length);
+		RecordUpload(Result, GetNumValues(attr_info, length) * sizeof(float));
+		return Result;
+	}
+
+	static HAPI_Result CountedSetAttributeIntData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const int * data_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI SetAttributeIntData"));
+		HAPI_Result Result = SetAttributeIntData(session, node_id, part_id, name, attr_info, data_array, start, length);
+		RecordUpload(Result, GetNumValues(attr_info, length) * sizeof(int));
+		return Result;
+	}
+
+	static HAPI_Result CountedSetAttributeStringData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const HAPI_AttributeInfo * attr_info, const char ** data_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI SetAttributeStringData"));
+		HAPI_Result Result = SetAttributeStringData(session, node_id, part_id, name, attr_info, data_array, start, length);
+
+		int64 NumBytes = 0;
+		const int64 NumValues = GetNumValues(attr_info, length);
+		for (int64 Idx = 0; data_array && Idx < NumValues; Idx++)
+			NumBytes += data_array[Idx] ? FCStringAnsi::Strlen(data_array[Idx]) + 1 : 0;
+		RecordUpload(Result, NumBytes);
+
+		return Result;
+	}
+
+	static HAPI_Result CountedSetVertexList(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * vertex_list_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI SetVertexList"));
+		HAPI_Result Result = SetVertexList(session, node_id, part_id, vertex_list_array, start, length);
+		RecordUpload(Result, GetNumValues(nullptr, length) * sizeof(int));
+		return Result;
+	}
+
+	static HAPI_Result CountedSetFaceCounts(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const int * face_counts_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI SetFaceCounts"));
+		HAPI_Result Result = SetFaceCounts(session, node_id, part_id, face_counts_array, start, length);
+		RecordUpload(Result, GetNumValues(nullptr, length) * sizeof(int));
+		return Result;
+	}
+
+	static HAPI_Result CountedSetHeightFieldData(const HAPI_Session * session, HAPI_NodeId node_id, HAPI_PartId part_id, const char * name, const float * values_array, int start, int length)
+	{
+		HOUDINI_TRACE_SCOPE(TEXT("HAPI SetHeightFieldData"));
+		HAPI_Result Result = SetHeightFieldData(session, node_id, part_id, name, values_array, start, length);
+		RecordUpload(Result, GetNumValues(nullptr, length) * sizeof(float));
+		return Result;
+	}
+}
+
+void
+FHoudiniEngineCookReport::InstallTransferCounters()
+{
+	using namespace HoudiniCookReportTransfers;
+
+	// Avoid wrapping our own wrappers
+	if (FHoudiniApi::GetAttributeFloatData == &CountedGetAttributeFloatData)
+		return;
+
+	GetAttributeFloatData = FHoudiniApi::GetAttributeFloatData;
+	GetAttributeIntData = FHoudiniApi::GetAttributeIntData;
+	GetAttributeStringData = FHoudiniApi::GetAttributeStringData;
+	GetVertexList = FHoudiniApi::GetVertexList;
+	GetFaceCounts = FHoudiniApi::GetFaceCounts;
+	GetHeightFieldData = FHoudiniApi::GetHeightFieldData;
+	SetAttributeFloatData = FHoudiniApi::SetAttributeFloatData;
+	SetAttributeIntData = FHoudiniApi::SetAttributeIntData;
+	SetAttributeStringData = FHoudiniApi::SetAttributeStringData;
+	SetVertexList = FHoudiniApi::SetVertexList;
+	SetFaceCounts = FHoudiniApi::SetFaceCounts;
+	SetHeightFieldData = FHoudiniApi::SetHeightFieldData;
+
+	FHoudiniApi::GetAttributeFloatData = &CountedGetAttributeFloatData;
+	FHoudiniApi::GetAttributeIntData = &CountedGetAttributeIntData;
+	FHoudiniApi::GetAttributeStringData = &CountedGetAttributeStringData;
+	FHoudiniApi::GetVertexList = &CountedGetVertexList;
+	FHoudiniApi::GetFaceCounts = &CountedGetFaceCounts;
+	FHoudiniApi::GetHeightFieldData = &CountedGetHeightFieldData;
+	FHoudiniApi::SetAttributeFloatData = &CountedSetAttributeFloatData;
+	FHoudiniApi::SetAttributeIntData = &CountedSetAttributeIntData;
+	FHoudiniApi::SetAttributeStringData = &CountedSetAttributeStringData;
+	FHoudiniApi::SetVertexList = &CountedSetVertexList;
+	FHoudiniApi::SetFaceCounts = &CountedSetFaceCounts;
+	FHoudiniApi::SetHeightFieldData = &CountedSetHeightFieldData;
+}
+
+void
+FHoudiniEngineCookReport::BeginCook(const FString& InHDAName)
+{
+	FHoudiniEngineOutputStats& LastCookStats = LastCookStatsPerHDA.FindOrAdd(InHDAName);
+	LastCookStats = FHoudiniEngineOutputStats();
+	LastCookStats.NumCooks = 1;
+
+	AggregatedStatsPerHDA.FindOrAdd(InHDAName).NumCooks++;
+	TotalStats.NumCooks++;
+}
+
+void
+FHoudiniEngineCookReport::BeginCookWait(const FString& InCookKey)
+{
+	CookWaitStartTimes.Add(InCookKey, FPlatformTime::Seconds());
+}
+
+void
+FHoudiniEngineCookReport::EndCookWait(const FString& InCookKey)
+{
+	double StartTime = 0.0;
+	if (!CookWaitStartTimes.RemoveAndCopyValue(InCookKey, StartTime))
+		return;
+
+	NotifyPhaseTime(EHoudiniCookPhase::CookWait, FPlatformTime::Seconds() - StartTime);
+}
+
+FHoudiniEngineOutputStats*
+FHoudiniEngineCookReport::GetCurrentStats()
+{
+	if (CurrentHDAName.IsEmpty())
+		return nullptr;
+
+	return LastCookStatsPerHDA.Find(CurrentHDAName);
+}
+
+void
+FHoudiniEngineCookReport::NotifyPhaseTime(EHoudiniCookPhase InPhase, double InSeconds, const FString& InOutputType)
+{
+	if (CurrentHDAName.IsEmpty())
+		return;
+
+	LastCookStatsPerHDA.FindOrAdd(CurrentHDAName).NotifyPhaseTime(InPhase, InSeconds, InOutputType);
+	AggregatedStatsPerHDA.FindOrAdd(CurrentHDAName).NotifyPhaseTime(InPhase, InSeconds, InOutputType);
+	TotalStats.NotifyPhaseTime(InPhase, InSeconds, InOutputType);
+}
+
+void
+FHoudiniEngineCookReport::NotifyBytesUploaded(int64 InNumBytes)
+{
+	// Transfers that happen outside of an HDA's processing are only recorded in the totals
+	TotalStats.NotifyBytesUploaded(InNumBytes);
+	if (CurrentHDAName.IsEmpty())
+		return;
+
+	LastCookStatsPerHDA.FindOrAdd(CurrentHDAName).NotifyBytesUploaded(InNumBytes);
+	AggregatedStatsPerHDA.FindOrAdd(CurrentHDAName).NotifyBytesUploaded(InNumBytes);
+}
+
+void
+FHoudiniEngineCookReport::NotifyBytesDownloaded(int64 InNumBytes)
+{
+	TotalStats.NotifyBytesDownloaded(InNumBytes);
+	if (CurrentHDAName.IsEmpty())
+		return;
+
+	LastCookStatsPerHDA.FindOrAdd(CurrentHDAName).NotifyBytesDownloaded(InNumBytes);
+	AggregatedStatsPerHDA.FindOrAdd(CurrentHDAName).NotifyBytesDownloaded(InNumBytes);
+}
+
+void
+FHoudiniEngineCookReport::Reset()
+{
+	LastCookStatsPerHDA.Empty();
+	AggregatedStatsPerHDA.Empty();
+	TotalStats = FHoudiniEngineOutputStats();
+	CookWaitStartTimes.Empty();
+}
+
+void
+FHoudiniEngineCookReport::LogReport() const
+{
+	auto LogStats = [](const FString& InName, const FHoudiniEngineOutputStats& InStats)
+	{
+		HOUDINI_LOG_DISPLAY(TEXT("%s: %d cook(s), %.3fs, %lld bytes uploaded, %lld bytes downloaded"),
+			*InName, InStats.NumCooks, InStats.GetTotalSeconds(), InStats.BytesUploaded, InStats.BytesDownloaded);
+
+		for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniCookPhase::Count; PhaseIdx++)
+		{
+			if (InStats.PhaseCalls[PhaseIdx] <= 0)
+				continue;
+
+			HOUDINI_LOG_DISPLAY(TEXT("    %-16s %10.3fs (%d)"),
+				FHoudiniEngineOutputStats::GetCookPhaseName((EHoudiniCookPhase)PhaseIdx), InStats.PhaseSeconds[PhaseIdx], InStats.PhaseCalls[PhaseIdx]);
+		}
+
+		for (const auto& Pair : InStats.OutputFetchSecondsPerType)
+			HOUDINI_LOG_DISPLAY(TEXT("    OutputFetch[%s] %.3fs"), *Pair.Key, Pair.Value);
+	};
+
+	HOUDINI_LOG_DISPLAY(TEXT("Houdini Engine cook report:"));
+	for (const auto& Pair : AggregatedStatsPerHDA)
+		LogStats(Pair.Key, Pair.Value);
+
+	LogStats(TEXT("Total"), TotalStats);
+}
+
+bool
+FHoudiniEngineCookReport::DumpToFile(const FString& InFilePath) const
+{
+	const bool bIsJson = FPaths::GetExtension(InFilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	const FString Content = bIsJson ? ToJsonString() : ToCSVString();
+	if (!FFileHelper::SaveStringToFile(Content, *InFilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not write the Houdini Engine cook report to %s."), *InFilePath);
+		return false;
+	}
+
+	HOUDINI_LOG_DISPLAY(TEXT("Houdini Engine cook report written to %s."), *InFilePath);
+	return true;
+}
+
+FString
+FHoudiniEngineCookReport::ToJsonString() const
+{
+	typedef TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>> FReportJsonWriter;
+
+	auto WriteStats = [](TSharedRef<FReportJsonWriter>& Writer, const FHoudiniEngineOutputStats& InStats)
+	{
+		Writer->WriteValue(TEXT("cooks"), InStats.NumCooks);
+		Writer->WriteValue(TEXT("total_seconds"), InStats.GetTotalSeconds());
+		Writer->WriteValue(TEXT("bytes_uploaded"), InStats.BytesUploaded);
+		Writer->WriteValue(TEXT("bytes_downloaded"), InStats.BytesDownloaded);
+		Writer->WriteValue(TEXT("packages_created"), InStats.NumPackagesCreated);
+		Writer->WriteValue(TEXT("packages_updated"), InStats.NumPackagesUpdated);
+
+		Writer->WriteObjectStart(TEXT("phases"));
+		for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniCookPhase::Count; PhaseIdx++)
+		{
+			Writer->WriteObjectStart(FHoudiniEngineOutputStats::GetCookPhaseName((EHoudiniCookPhase)PhaseIdx));
+			Writer->WriteValue(TEXT("seconds"), InStats.PhaseSeconds[PhaseIdx]);
+			Writer->WriteValue(TEXT("calls"), InStats.PhaseCalls[PhaseIdx]);
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteObjectEnd();
+
+		Writer->WriteObjectStart(TEXT("output_fetch_seconds"));
+		for (const auto& Pair : InStats.OutputFetchSecondsPerType)
+			Writer->WriteValue(Pair.Key, Pair.Value);
+		Writer->WriteObjectEnd();
+	};
+
+	FString Output;
+	TSharedRef<FReportJsonWriter> Writer = FReportJsonWriter::Create(&Output);
+	Writer->WriteObjectStart();
+
+	Writer->WriteObjectStart(TEXT("total"));
+	WriteStats(Writer, TotalStats);
+	Writer->WriteObjectEnd();
+
+	Writer->WriteArrayStart(TEXT("hdas"));
+	for (const auto& Pair : AggregatedStatsPerHDA)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Pair.Key);
+
+		Writer->WriteObjectStart(TEXT("aggregate"));
+		WriteStats(Writer, Pair.Value);
+		Writer->WriteObjectEnd();
+
+		if (const FHoudiniEngineOutputStats* LastCookStats = LastCookStatsPerHDA.Find(Pair.Key))
+		{
+			Writer->WriteObjectStart(TEXT("last_cook"));
+			WriteStats(Writer, *LastCookStats);
+			Writer->WriteObjectEnd();
+		}
+
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Output;
+}
+
+FString
+FHoudiniEngineCookReport::ToCSVString() const
+{
+	// One row per HDA aggregate, one column per phase
+	FString Output = TEXT("HDA,Cooks,TotalSeconds,BytesUploaded,BytesDownloaded");
+	for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniCookPhase::Count; PhaseIdx++)
+		Output += FString::Printf(TEXT(",%s"), FHoudiniEngineOutputStats::GetCookPhaseName((EHoudiniCookPhase)PhaseIdx));
+	Output += LINE_TERMINATOR;
+
+	auto WriteRow = [&Output](const FString& InName, const FHoudiniEngineOutputStats& InStats)
+	{
+		Output += FString::Printf(TEXT("\"%s\",%d,%f,%lld,%lld"),
+			*InName.Replace(TEXT("\""), TEXT("\"\"")), InStats.NumCooks, InStats.GetTotalSeconds(), InStats.BytesUploaded, InStats.BytesDownloaded);
+
+		for (int32 PhaseIdx = 0; PhaseIdx < (int32)EHoudiniCookPhase::Count; PhaseIdx++)
+			Output += FString::Printf(TEXT(",%f"), InStats.PhaseSeconds[PhaseIdx]);
+		Output += LINE_TERMINATOR;
+	};
+
+	for (const auto& Pair : AggregatedStatsPerHDA)
+		WriteRow(Pair.Key, Pair.Value);
+
+	WriteRow(TEXT("Total"), TotalStats);
+
+	return Output;
+}
+
+FHoudiniCookReportHDAScope::FHoudiniCookReportHDAScope(const FString& InHDAName)
+{
+	FHoudiniEngineCookReport& Report = FHoudiniEngineCookReport::Get();
+	PreviousHDAName = Report.CurrentHDAName;
+	Report.CurrentHDAName = InHDAName;
+}
+
+FHoudiniCookReportHDAScope::~FHoudiniCookReportHDAScope()
+{
+	FHoudiniEngineCookReport::Get().CurrentHDAName = PreviousHDAName;
+}
+
+FHoudiniCookPhaseScope* FHoudiniCookPhaseScope::CurrentScope = nullptr;
+
+FHoudiniCookPhaseScope::FHoudiniCookPhaseScope(EHoudiniCookPhase InPhase, const FString& InOutputType)
+	: Phase(InPhase)
+	, OutputType(InOutputType)
+	, TraceScope(FHoudiniEngineOutputStats::GetCookPhaseName(InPhase), InOutputType)
+	, StartTime(0.0)
+	, ChildSeconds(0.0)
+	, Parent(nullptr)
+{
+	// Phases are only timed on the game thread
+	if (!IsInGameThread())
+		return;
+
+	StartTime = FPlatformTime::Seconds();
+	Parent = CurrentScope;
+	CurrentScope = this;
+}
+
+FHoudiniCookPhaseScope::~FHoudiniCookPhaseScope()
+{
+	if (StartTime <= 0.0)
+		return;
+
+	const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	FHoudiniEngineCookReport::Get().NotifyPhaseTime(Phase, TotalSeconds - ChildSeconds, OutputType);
+
+	if (Parent)
+		Parent->ChildSeconds += TotalSeconds;
+
+	CurrentScope = Parent;
+}
+
+// Console commands
+static void
+HoudiniCookReportDump(const TArray<FString>& Args)
+{
+	FString FilePath = Args.Num() > 0 ? Args[0] : FString();
+	if (FilePath.IsEmpty())
+	{
+		FilePath = FPaths::Combine(
+			FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"),
+			FString::Printf(TEXT("CookReport-%s.json"), *FDateTime::Now().ToString()));
+	}
+
+	FHoudiniEngineCookReport::Get().DumpToFile(FilePath);
+}
+
+static FAutoConsoleCommand CCmdHoudiniCookReportPrint(
+	TEXT("Houdini.CookReport.Print"),
+	TEXT("Prints the Houdini Engine cook report (per phase timings and transfers per HDA) to the log."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHoudiniEngineCookReport::Get().LogReport(); }));
+
+static FAutoConsoleCommand CCmdHoudiniCookReportDump(
+	TEXT("Houdini.CookReport.Dump"),
+	TEXT("Writes the Houdini Engine cook report to a file. Houdini.CookReport.Dump [Path.json|Path.csv], defaults to a JSON file in Saved/HoudiniEngine."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HoudiniCookReportDump));
+
+static FAutoConsoleCommand CCmdHoudiniCookReportReset(
+	TEXT("Houdini.CookReport.Reset"),
+	TEXT("Clears the Houdini Engine cook report."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHoudiniEngineCookReport::Get().Reset(); }));
\ No newline at end of file
@@ -29,13 +29,47 @@
 #include "CoreMinimal.h"
 #include "UObject/Class.h"
 
+#include "HoudiniEngineTrace.h"
+
+// The phases of a cook that are timed in FHoudiniEngineOutputStats
+enum class EHoudiniCookPhase : uint8
+{
+	InputUpload,
+	CookWait,
+	ParameterSync,
+	OutputFetch,
+	MeshBuild,
+	Collision,
+	MaterialTexture,
+	Instancer,
+	Landscape,
+
+	Count
+};
+
 struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 {
 	FHoudiniEngineOutputStats();
-	
+
+	static const TCHAR* GetCookPhaseName(EHoudiniCookPhase InPhase);
+
 	int32 NumPackagesCreated;
 	int32 NumPackagesUpdated;
 
+	// Number of cooks accumulated in these stats
+	int32 NumCooks;
+
+	// Time spent (exclusive, in seconds) and number of times we entered each cook phase
+	double PhaseSeconds[(int32)EHoudiniCookPhase::Count];
+	int32 PhaseCalls[(int32)EHoudiniCookPhase::Count];
+
+	// Time spent (exclusive, in seconds) fetching/creating outputs, per output type
+	TMap<FString, double> OutputFetchSecondsPerType;
+
+	// Bytes sent to / received from the Houdini Engine session
+	int64 BytesUploaded;
+	int64 BytesDownloaded;
+
 	// These FStrings should preferably be EHoudiniOutputType enum
 	// Move the OUtput enums into a separate header to avoid circular dependencies.
 	TMap<FString, int32> OutputObjectsCreated;
@@ -45,6 +79,17 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	void NotifyPackageCreated(int32 NumCreated);
 	void NotifyPackageUpdated(int32 NumUpdated);
 
+	// Timings / transfers
+	void NotifyPhaseTime(EHoudiniCookPhase InPhase, double InSeconds, const FString& InOutputType = FString());
+	void NotifyBytesUploaded(int64 InNumBytes) { BytesUploaded += InNumBytes; };
+	void NotifyBytesDownloaded(int64 InNumBytes) { BytesDownloaded += InNumBytes; };
+
+	// Adds the counters and timings of InOther to these stats
+	void Accumulate(const FHoudiniEngineOutputStats& InOther);
+
+	// Total time of all the phases
+	double GetTotalSeconds() const;
+
 	// Objects created
 	void NotifyObjectsCreated(const FString& ObjectTypeName, int32 NumCreated);
 	template<typename EnumT>
@@ -69,3 +114,92 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 		NotifyObjectsReplaced( UEnum::GetValueAsString(EnumValue), NumReplaced );
 	}
 };
+
+// Collects the stats of the last cook and the aggregated stats of every HDA, as well as the 
+// stats of the whole session. Cook phases are timed with FHoudiniCookPhaseScope, and attributed 
+// to the HDA set by the innermost FHoudiniCookReportHDAScope.
+class HOUDINIENGINE_API FHoudiniEngineCookReport
+{
+public:
+
+	static FHoudiniEngineCookReport& Get();
+
+	// Replaces the HAPI bulk data get/set functions with wrappers tracing them and recording the size of the transferred data.
+	// Needs to be called after FHoudiniApi::InitializeHAPI().
+	static void InstallTransferCounters();
+
+	// Starts a new cook report for the given HDA
+	void BeginCook(const FString& InHDAName);
+	// Times the cook's wait phase, between the start of the cook task and its completion.
+	// InCookKey identifies the cook (the HDA can have multiple instances), the time is recorded to the current HDA.
+	void BeginCookWait(const FString& InCookKey);
+	void EndCookWait(const FString& InCookKey);
+
+	// The stats the phases/transfers are currently recorded to, null if no HDA is being processed
+	FHoudiniEngineOutputStats* GetCurrentStats();
+
+	// Records time/transfers to the current HDA's last cook and to the aggregates
+	void NotifyPhaseTime(EHoudiniCookPhase InPhase, double InSeconds, const FString& InOutputType = FString());
+	void NotifyBytesUploaded(int64 InNumBytes);
+	void NotifyBytesDownloaded(int64 InNumBytes);
+
+	void Reset();
+
+	// Prints the report to the log
+	void LogReport() const;
+
+	// Writes the report as JSON (.json) or CSV (any other extension). Returns false if the file couldn't be written
+	bool DumpToFile(const FString& InFilePath) const;
+
+	FString ToJsonString() const;
+	FString ToCSVString() const;
+
+	const FString& GetCurrentHDAName() const { return CurrentHDAName; };
+	const FHoudiniEngineOutputStats& GetTotalStats() const { return TotalStats; };
+	const TMap<FString, FHoudiniEngineOutputStats>& GetLastCookStatsPerHDA() const { return LastCookStatsPerHDA; };
+	const TMap<FString, FHoudiniEngineOutputStats>& GetAggregatedStatsPerHDA() const { return AggregatedStatsPerHDA; };
+
+protected:
+
+	friend struct FHoudiniCookReportHDAScope;
+
+	// Name of the HDA currently being processed
+	FString CurrentHDAName;
+
+	// Stats of the last cook of each HDA
+	TMap<FString, FHoudiniEngineOutputStats> LastCookStatsPerHDA;
+	// Stats accumulated over all the cooks of each HDA
+	TMap<FString, FHoudiniEngineOutputStats> AggregatedStatsPerHDA;
+	// Stats accumulated over all HDAs
+	FHoudiniEngineOutputStats TotalStats;
+
+	// Start time of the cooks we are waiting for
+	TMap<FString, double> CookWaitStartTimes;
+};
+
+// Attributes the cook phases timed in this scope to the given HDA
+struct HOUDINIENGINE_API FHoudiniCookReportHDAScope
+{
+	FHoudiniCookReportHDAScope(const FString& InHDAName);
+	~FHoudiniCookReportHDAScope();
+
+private:
+	FString PreviousHDAName;
+};
+
+// Times a cook phase. Nested scopes are excluded from their parent's time, so phases don't overlap in the report
+struct HOUDINIENGINE_API FHoudiniCookPhaseScope
+{
+	FHoudiniCookPhaseScope(EHoudiniCookPhase InPhase, const FString& InOutputType = FString());
+	~FHoudiniCookPhaseScope();
+
+private:
+	EHoudiniCookPhase Phase;
+	FString OutputType;
+	FHoudiniTraceScope TraceScope;
+	double StartTime;
+	double ChildSeconds;
+	FHoudiniCookPhaseScope* Parent;
+
+	static FHoudiniCookPhaseScope* CurrentScope;
+};
@@ -274,6 +274,7 @@
 #define HAPI_UNREAL_PACKAGE_META_NODE_PATH                      TEXT( "HoudiniNodePath" )
 #define HAPI_UNREAL_PACKAGE_META_BAKE_COUNTER                   TEXT( "HoudiniPackageBakeCounter" )
 #define HAPI_UNREAL_PACKAGE_META_TEMP_GUID                      TEXT( "HoudiniPackageTempGUID" )
+#define HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH              TEXT( "HoudiniPackageBakeContentHash" )
 
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL       TEXT( "N" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE      TEXT( "C_A" )
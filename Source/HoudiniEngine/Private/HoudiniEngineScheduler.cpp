@@ -288,6 +288,17 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		return;
 	}
 
+	// The cook might have been interrupted before it started
+	if (IsTaskInterrupted(Task.HapiGUID, true))
+	{
+		AddResponseMessageTaskInfo(
+			HAPI_RESULT_USER_INTERRUPTED, EHoudiniEngineTaskType::AssetCooking,
+			EHoudiniEngineTaskState::Aborted,
+			AssetId, Task, TEXT("Cook interrupted."));
+
+		return;
+	}
+
 	// Default CookOptions
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
 	Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), AssetId, &CookOptions);
@@ -311,14 +322,34 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	// Initialize last update time.
 	double LastUpdateTime = FPlatformTime::Seconds();
 
+	bool bInterrupted = false;
+
 	// We need to spin until cooking is finished.
 	while (true)
 	{
+		// Interrupt the cook if requested, HAPI still needs to be ready before we can report it
+		if (!bInterrupted && IsTaskInterrupted(Task.HapiGUID, true))
+		{
+			bInterrupted = true;
+			FHoudiniApi::Interrupt(FHoudiniEngine::Get().GetSession());
+		}
+
 		int32 Status = HAPI_STATE_STARTING_COOK;
 		HOUDINI_CHECK_ERROR_GET( &Result, FHoudiniApi::GetStatus(
 			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
-		if (Status == HAPI_STATE_READY)
+		if (bInterrupted && Status <= HAPI_STATE_MAX_READY_STATE)
+		{
+			// The results of an interrupted cook are incomplete
+			AddResponseMessageTaskInfo(
+				HAPI_RESULT_USER_INTERRUPTED,
+				EHoudiniEngineTaskType::AssetCooking,
+				EHoudiniEngineTaskState::Aborted,
+				AssetId, Task, TEXT("Cook interrupted."));
+
+			break;
+		}
+		else if (Status == HAPI_STATE_READY)
 		{
 			// Cooking has been successful.
 			AddResponseMessageTaskInfo(
@@ -365,6 +396,9 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		// We want to yield.
 		FPlatformProcess::SleepNoStats(UpdateFrequency);
 	}
+
+	// Discard interruption requests that arrived after the cook finished
+	IsTaskInterrupted(Task.HapiGUID, true);
 }
 
 void
@@ -593,6 +627,26 @@ FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 	PositionWrite &= (TaskCount - 1);
 }
 
+void
+FHoudiniEngineScheduler::InterruptTask(const FGuid & InHapiGUID)
+{
+	if (!InHapiGUID.IsValid())
+		return;
+
+	FScopeLock ScopeLock(&CriticalSection);
+	InterruptedTasks.Add(InHapiGUID);
+}
+
+bool
+FHoudiniEngineScheduler::IsTaskInterrupted(const FGuid & InHapiGUID, const bool& bClear)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	if (bClear)
+		return InterruptedTasks.Remove(InHapiGUID) > 0;
+
+	return InterruptedTasks.Contains(InHapiGUID);
+}
+
 uint32
 FHoudiniEngineScheduler::Run()
 {
@@ -50,6 +50,10 @@ public:
 	// Adds a task.
 	void AddTask(const FHoudiniEngineTask & Task);
 
+	// Requests the interruption of a cook task, queued or in progress.
+	// The task will finish with the Aborted state.
+	void InterruptTask(const FGuid & InHapiGUID);
+
 	// Adds instantiation response task info.
 	void AddResponseTaskInfo(
 		HAPI_Result Result, 
@@ -89,6 +93,10 @@ protected:
 	// Process the result of a sucesfull cook
 	void TaskProccessAsset(const FHoudiniEngineTask & Task);
 
+	// Returns true if the interruption of the given task has been requested,
+	// bClear also removes the request.
+	bool IsTaskInterrupted(const FGuid & InHapiGUID, const bool& bClear);
+
 private:
 
 	// Initial number of tasks in our circular queue. 
@@ -114,4 +122,7 @@ private:
 
 	// Stopping flag. 
 	bool bStopping;
+
+	// Tasks whose interruption has been requested.
+	TSet<FGuid> InterruptedTasks;
 };
@@ -211,5 +211,75 @@ FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray
 		}
 	}
 
+	return bReturn;
+}
+
+bool
+FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
+{
+	bool bReturn = true;
+	OutStringArray.SetNum(InStringIdArray.Num());
+
+	// Only send the unique, valid handles to HAPI
+	// Null string ID / zero should be considered invalid
+	TArray<int32> UniqueSH;
+	TMap<HAPI_StringHandle, int32> UniqueSHIndices;
+	for (const int32& CurrentSH : InStringIdArray)
+	{
+		if (CurrentSH <= 0)
+		{
+			bReturn = false;
+			continue;
+		}
+
+		if (!UniqueSHIndices.Contains(CurrentSH))
+			UniqueSHIndices.Add(CurrentSH, UniqueSH.Add(CurrentSH));
+	}
+
+	if (UniqueSH.Num() <= 0)
+	{
+		for (FString& CurrentString : OutStringArray)
+			CurrentString = FString();
+
+		return bReturn;
+	}
+
+	int32 BufferSize = 0;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
+		FHoudiniEngine::Get().GetSession(), UniqueSH.GetData(), UniqueSH.Num(), &BufferSize)
+		|| BufferSize <= 0)
+	{
+		return SHArrayToFStringArray(InStringIdArray, OutStringArray);
+	}
+
+	TArray<char> Buffer;
+	Buffer.SetNumZeroed(BufferSize);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(
+		FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize))
+	{
+		return SHArrayToFStringArray(InStringIdArray, OutStringArray);
+	}
+
+	// The buffer contains all the strings in the order of the handles, separated by null characters
+	TArray<FString> UniqueStrings;
+	UniqueStrings.SetNum(UniqueSH.Num());
+	int32 StringStart = 0;
+	for (int32 IdxString = 0; IdxString < UniqueStrings.Num() && StringStart < BufferSize; IdxString++)
+	{
+		UniqueStrings[IdxString] = UTF8_TO_TCHAR(&Buffer[StringStart]);
+
+		while (StringStart < BufferSize && Buffer[StringStart] != '\0')
+			StringStart++;
+
+		// Skip the null terminator
+		StringStart++;
+	}
+
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+	{
+		const int32* UniqueIndex = UniqueSHIndices.Find(InStringIdArray[IdxSH]);
+		OutStringArray[IdxSH] = UniqueIndex ? UniqueStrings[*UniqueIndex] : FString();
+	}
+
 	return bReturn;
 }
\ No newline at end of file
@@ -61,6 +61,10 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		// Array converter, uses a map to avoid redudant calls to HAPI
 		static bool SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
 
+		// Array converter, resolves all the strings with a single batched HAPI query
+		// Falls back to SHArrayToFStringArray if the batched query fails
+		static bool SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
+
 		// Return id of this string.
 		int32 GetId() const;
 
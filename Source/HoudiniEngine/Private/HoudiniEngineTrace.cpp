@@ -0,0 +1,132 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniEngineTrace.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineOutputStats.h"
+
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(HoudiniEngineChannel)
+
+TRACE_DECLARE_INT_COUNTER(HoudiniEngineBytesUploaded, TEXT("HoudiniEngine/BytesUploaded"));
+TRACE_DECLARE_INT_COUNTER(HoudiniEngineBytesDownloaded, TEXT("HoudiniEngine/BytesDownloaded"));
+TRACE_DECLARE_INT_COUNTER(HoudiniEngineVerticesProduced, TEXT("HoudiniEngine/VerticesProduced"));
+TRACE_DECLARE_INT_COUNTER(HoudiniEngineInstancesProduced, TEXT("HoudiniEngine/InstancesProduced"));
+
+FHoudiniTraceScope::FHoudiniTraceScope(const TCHAR* InName, const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId)
+	: bStarted(false)
+{
+	Begin(InName, FString(), InNodeId, InPartId);
+}
+
+FHoudiniTraceScope::FHoudiniTraceScope(const TCHAR* InName, const FString& InDetail)
+	: bStarted(false)
+{
+	Begin(InName, InDetail, -1, -1);
+}
+
+void
+FHoudiniTraceScope::Begin(const TCHAR* InName, const FString& InDetail, const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId)
+{
+#if CPUPROFILERTRACE_ENABLED
+	if (!FHoudiniEngineTrace::IsChannelEnabled())
+		return;
+
+	FString EventName = InName;
+	if (!InDetail.IsEmpty())
+		EventName += FString::Printf(TEXT(" %s"), *InDetail);
+
+	const FString& HDAName = FHoudiniEngineCookReport::Get().GetCurrentHDAName();
+	if (!HDAName.IsEmpty())
+		EventName += FString::Printf(TEXT(" [%s]"), *HDAName);
+	if (InNodeId >= 0)
+		EventName += FString::Printf(TEXT(" node %d"), InNodeId);
+	if (InPartId >= 0)
+		EventName += FString::Printf(TEXT(" part %d"), InPartId);
+
+	FCpuProfilerTrace::OutputBeginDynamicEvent(*EventName);
+	bStarted = true;
+#endif
+}
+
+FHoudiniTraceScope::~FHoudiniTraceScope()
+{
+#if CPUPROFILERTRACE_ENABLED
+	if (bStarted)
+		FCpuProfilerTrace::OutputEndEvent();
+#endif
+}
+
+bool
+FHoudiniEngineTrace::IsChannelEnabled()
+{
+#if UE_TRACE_ENABLED
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(HoudiniEngineChannel | CpuChannel);
+#else
+	return false;
+#endif
+}
+
+void
+FHoudiniEngineTrace::NotifyBytesUploaded(const int64& InNumBytes)
+{
+	TRACE_COUNTER_ADD(HoudiniEngineBytesUploaded, InNumBytes);
+}
+
+void
+FHoudiniEngineTrace::NotifyBytesDownloaded(const int64& InNumBytes)
+{
+	TRACE_COUNTER_ADD(HoudiniEngineBytesDownloaded, InNumBytes);
+}
+
+void
+FHoudiniEngineTrace::NotifyVerticesProduced(const int64& InNumVertices)
+{
+	TRACE_COUNTER_ADD(HoudiniEngineVerticesProduced, InNumVertices);
+}
+
+void
+FHoudiniEngineTrace::NotifyInstancesProduced(const int64& InNumInstances)
+{
+	TRACE_COUNTER_ADD(HoudiniEngineInstancesProduced, InNumInstances);
+}
+
+void
+FHoudiniEngineTrace::BookmarkCookStart(const FString& InHDAName)
+{
+	if (IsChannelEnabled())
+		TRACE_BOOKMARK(TEXT("Houdini cook start: %s"), *InHDAName);
+}
+
+void
+FHoudiniEngineTrace::BookmarkCookEnd(const FString& InHDAName, const bool& bInSuccess)
+{
+	if (IsChannelEnabled())
+		TRACE_BOOKMARK(TEXT("Houdini cook end: %s (%s)"), *InHDAName, bInSuccess ? TEXT("success") : TEXT("failed"));
+}
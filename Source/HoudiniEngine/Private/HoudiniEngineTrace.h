@@ -0,0 +1,79 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAPI/HAPI_Common.h"
+
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Trace channel for the Houdini Engine events, enable it with -trace=cpu,houdiniengine
+UE_TRACE_CHANNEL_EXTERN(HoudiniEngineChannel, HOUDINIENGINE_API)
+
+// Static scope on the Houdini Engine channel
+#define HOUDINI_TRACE_SCOPE(Name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, HoudiniEngineChannel)
+
+// Scope tagged with the HDA currently being processed and the given node/part.
+// The event name is only built when the channel is enabled.
+#define HOUDINI_TRACE_SCOPE_NODE(Name, NodeId, PartId) \
+	FHoudiniTraceScope PREPROCESSOR_JOIN(HoudiniTraceScope, __LINE__)(Name, NodeId, PartId)
+
+// Scope tagged with the HDA currently being processed
+#define HOUDINI_TRACE_SCOPE_HDA(Name) \
+	FHoudiniTraceScope PREPROCESSOR_JOIN(HoudiniTraceScope, __LINE__)(Name, -1, -1)
+
+struct HOUDINIENGINE_API FHoudiniTraceScope
+{
+	FHoudiniTraceScope(const TCHAR* InName, const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId);
+	FHoudiniTraceScope(const TCHAR* InName, const FString& InDetail);
+	~FHoudiniTraceScope();
+
+private:
+	void Begin(const TCHAR* InName, const FString& InDetail, const HAPI_NodeId& InNodeId, const HAPI_PartId& InPartId);
+
+	bool bStarted;
+};
+
+// Counters and bookmarks of the Houdini Engine channel
+struct HOUDINIENGINE_API FHoudiniEngineTrace
+{
+	static bool IsChannelEnabled();
+
+	// Bytes sent to / received from HAPI by the bulk data functions
+	static void NotifyBytesUploaded(const int64& InNumBytes);
+	static void NotifyBytesDownloaded(const int64& InNumBytes);
+
+	// Geometry produced by the translators
+	static void NotifyVerticesProduced(const int64& InNumVertices);
+	static void NotifyInstancesProduced(const int64& InNumInstances);
+
+	// Marks the start and end of an HDA's cook
+	static void BookmarkCookStart(const FString& InHDAName);
+	static void BookmarkCookEnd(const FString& InHDAName, const bool& bInSuccess);
+};
@@ -45,6 +45,7 @@
 #include "HoudiniAsset.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniTransformMath.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInput.h"
@@ -52,6 +53,7 @@
 #include "HoudiniParameter.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniDetailsLayoutCache.h"
 
 #if WITH_EDITOR
 	#include "SAssetSelectionWidget.h"
@@ -1856,11 +1858,25 @@ void
 FHoudiniEngineUtils::TranslateHapiTransform(const HAPI_TransformEuler & HapiTransformEuler, FTransform & UnrealTransform)
 {
 	float HapiMatrix[16];
-	FHoudiniApi::ConvertTransformEulerToMatrix(FHoudiniEngine::Get().GetSession(), &HapiTransformEuler, HapiMatrix);
-
 	HAPI_Transform HapiTransformQuat;
 	FMemory::Memzero< HAPI_Transform >(HapiTransformQuat);
-	FHoudiniApi::ConvertMatrixToQuat(FHoudiniEngine::Get().GetSession(), HapiMatrix, HAPI_SRT, &HapiTransformQuat);
+
+	// Do the conversion natively if possible, to avoid two round trips to the session
+	if (FHoudiniTransformMath::TransformEulerToMatrix(HapiTransformEuler, HapiMatrix)
+		&& FHoudiniTransformMath::MatrixToQuat(HapiMatrix, HAPI_SRT, HapiTransformQuat))
+	{
+		if (FHoudiniTransformMath::IsValidationEnabled())
+		{
+			float ValidationMatrix[16];
+			if (HAPI_RESULT_SUCCESS == FHoudiniApi::ConvertTransformEulerToMatrix(FHoudiniEngine::Get().GetSession(), &HapiTransformEuler, ValidationMatrix))
+				FHoudiniTransformMath::ValidateMatrix(HapiMatrix, ValidationMatrix, TEXT("TranslateHapiTransform"));
+		}
+	}
+	else
+	{
+		FHoudiniApi::ConvertTransformEulerToMatrix(FHoudiniEngine::Get().GetSession(), &HapiTransformEuler, HapiMatrix);
+		FHoudiniApi::ConvertMatrixToQuat(FHoudiniEngine::Get().GetSession(), HapiMatrix, HAPI_SRT, &HapiTransformQuat);
+	}
 
 	FHoudiniEngineUtils::TranslateHapiTransform(HapiTransformQuat, UnrealTransform);
 }
@@ -2191,6 +2207,28 @@ FHoudiniEngineUtils::UpdateEditorProperties(TArray<UObject*> ObjectsToUpdate, co
 	}
 }
 
+void
+FHoudiniEngineUtils::UpdateEditorPropertiesAfterCook(UHoudiniAssetComponent* InHAC)
+{
+	if (!IsInGameThread())
+	{
+		// We need to be in the game thread to check the layout and update the editor properties
+		TWeakObjectPtr<UHoudiniAssetComponent> WeakHAC = InHAC;
+		AsyncTask(ENamedThreads::GameThread, [WeakHAC]()
+		{
+			if (WeakHAC.IsValid())
+				FHoudiniEngineUtils::UpdateEditorPropertiesAfterCook(WeakHAC.Get());
+		});
+		return;
+	}
+
+	if (!IsValid(InHAC))
+		return;
+
+	const bool bLayoutChanged = FHoudiniDetailsLayoutCache::Get().HasLayoutChanged(InHAC);
+	FHoudiniEngineUtils::UpdateEditorProperties_Internal({ InHAC }, bLayoutChanged);
+}
+
 void FHoudiniEngineUtils::UpdateBlueprintEditor(UHoudiniAssetComponent* HAC)
 {
 	if (!IsInGameThread())
@@ -2319,16 +2357,10 @@ FHoudiniEngineUtils::UpdateEditorProperties_Internal(TArray<UObject*> ObjectsToU
 			if (!bFoundActor)
 				continue;
 
-			// Refresh that details panels using its current selection
-			TArray<UObject*> Selection;
-			for (auto DetailsActor : SelectedDetailActors)
-			{
-				if (DetailsActor.IsValid())
-					Selection.Add(DetailsActor.Get());
-			}
-
-			// Reset selected actors, force refresh and override the lock.
-			DetailsView->SetObjects(SelectedActors, bInForceFullUpdate, true);
+			// Rebuild that details panel with its current selection.
+			// Unlike resetting the selected objects, this keeps the selected component,
+			// the expanded categories and the scroll position of the panel.
+			DetailsView->ForceRefresh();
 
 			if (GUnrealEd)
 				GUnrealEd->UpdateFloatingPropertyWindows();
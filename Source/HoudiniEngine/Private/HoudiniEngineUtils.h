@@ -279,6 +279,11 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// NOTE: Prefer using IDetailLayoutBuilder::ForceRefreshDetails() instead.
 		static void UpdateEditorProperties(TArray<UObject*> InObjectsToUpdate, const bool& InForceFullUpdate);
 
+		// Triggers an update of the details panel after the component has cooked/processed its outputs.
+		// The panel is only rebuilt if the component's details layout changed since it was last built,
+		// otherwise its rows are simply redrawn with the new values.
+		static void UpdateEditorPropertiesAfterCook(UHoudiniAssetComponent* InHAC);
+
 		// Triggers an update the details panel
 		static void UpdateBlueprintEditor(UHoudiniAssetComponent* HAC);
 
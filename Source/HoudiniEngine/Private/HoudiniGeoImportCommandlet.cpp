@@ -248,6 +248,9 @@ int32 UHoudiniGeoImportCommandlet::MainLoop()
 		// update task graph
 		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
 
+		// Import the BGEO files requested by the messages received this tick
+		ProcessPendingBGEOImports();
+
 		FTicker::GetCoreTicker().Tick(FApp::GetDeltaTime());
 		FThreadManager::Get().Tick();
 		GEngine->TickDeferredCommands();		
@@ -302,6 +305,52 @@ void UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 {
 	HOUDINI_LOG_DISPLAY(TEXT("Received BGEO import request from %s"), *InContext->GetSender().ToString());
 
+	// The requests are processed in batches by the main loop
+	PendingBGEOImports.Add(FPendingBGEOImport(InMessage, InContext->GetSender()));
+}
+
+void UHoudiniGeoImportCommandlet::ProcessPendingBGEOImports()
+{
+	// Bounds the number of output packages kept loaded until the end of the batch
+	const int32 MaxImportsPerBatch = 16;
+
+	while (PendingBGEOImports.Num() > 0)
+	{
+		const int32 NumToImport = FMath::Min(PendingBGEOImports.Num(), MaxImportsPerBatch);
+		TArray<FPendingBGEOImport> Batch;
+		Batch.Append(PendingBGEOImports.GetData(), NumToImport);
+		PendingBGEOImports.RemoveAt(0, NumToImport, false);
+
+		TArray<UPackage*> PackagesToUnload;
+		for (const FPendingBGEOImport& PendingImport : Batch)
+		{
+			ImportBGEOAndReply(PendingImport.Message, PendingImport.Sender, PackagesToUnload);
+		}
+
+		if (PackagesToUnload.Num() > 0)
+		{
+			HOUDINI_LOG_DISPLAY(TEXT("Unloading %d packages ..."), PackagesToUnload.Num());
+			FText ErrorMessage;
+			if (!UPackageTools::UnloadPackages(PackagesToUnload, ErrorMessage))
+			{
+				HOUDINI_LOG_WARNING(TEXT("Unload packages failed: %s"), *ErrorMessage.ToString());
+			}
+			else
+			{
+				HOUDINI_LOG_DISPLAY(TEXT("Unloading %d packages ... Success"), PackagesToUnload.Num());
+			}
+			PackagesToUnload.Empty();
+		}
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+}
+
+void UHoudiniGeoImportCommandlet::ImportBGEOAndReply(
+	const FHoudiniPDGImportBGEOMessage& InMessage,
+	const FMessageAddress& InSender,
+	TArray<UPackage*>& OutPackagesToUnload)
+{
 	FHoudiniPackageParams PackageParams;
 	InMessage.PopulatePackageParams(PackageParams);
 
@@ -364,18 +413,17 @@ void UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 			}
 		}
 
-		PDGEndpoint->Send(Reply, InContext->GetSender());
+		PDGEndpoint->Send(Reply, InSender);
 	}
 	else
 	{
 		HOUDINI_LOG_WARNING(TEXT("BGEO import failed."));
 		FHoudiniPDGImportBGEOResultMessage* Reply = new FHoudiniPDGImportBGEOResultMessage();
 		Reply->ImportResult = EHoudiniPDGImportBGEOResult::HPIBR_Failed;
-		PDGEndpoint->Send(Reply, InContext->GetSender());
+		PDGEndpoint->Send(Reply, InSender);
 	}
 
 	// Cleanup the outputs (remove from root)
-	TArray<UPackage*> PackagesToUnload;
 	for (UHoudiniOutput *CurOutput : Outputs)
 	{
 		if (!IsValid(CurOutput))
@@ -388,7 +436,7 @@ void UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 				UPackage *Outermost = Entry.Value.OutputObject->GetOutermost();
 				if (IsValid(Outermost))
 				{
-					PackagesToUnload.Add(Outermost);
+					OutPackagesToUnload.AddUnique(Outermost);
 				}
 				
 				Entry.Value.OutputObject->RemoveFromRoot();
@@ -397,25 +445,6 @@ void UHoudiniGeoImportCommandlet::HandleImportBGEOMessage(
 
 		CurOutput->RemoveFromRoot();
 	}
-	Outputs.Empty();
-	OutputObjectAttributes.Empty();
-
-	if (PackagesToUnload.Num() > 0)
-	{
-		HOUDINI_LOG_DISPLAY(TEXT("Unloading %d packages ..."), PackagesToUnload.Num());
-		FText ErrorMessage;
-		if (!UPackageTools::UnloadPackages(PackagesToUnload, ErrorMessage))
-		{
-			HOUDINI_LOG_WARNING(TEXT("Unload packages failed: %s"), *ErrorMessage.ToString());
-		}
-		else
-		{
-			HOUDINI_LOG_DISPLAY(TEXT("Unloading %d packages ... Success"), PackagesToUnload.Num());
-		}
-		PackagesToUnload.Empty();
-	}
-
-	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 }
 
 bool UHoudiniGeoImportCommandlet::StartHoudiniEngineSession()
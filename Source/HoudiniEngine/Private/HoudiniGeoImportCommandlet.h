@@ -79,6 +79,21 @@ public:
 	bool bImported;
 };
 
+// A BGEO import request received from the PDG manager, waiting to be processed
+struct FPendingBGEOImport
+{
+public:
+	FPendingBGEOImport() {}
+
+	FPendingBGEOImport(const FHoudiniPDGImportBGEOMessage& InMessage, const FMessageAddress& InSender) : Message(InMessage), Sender(InSender) {}
+
+	// The import request
+	FHoudiniPDGImportBGEOMessage Message;
+
+	// The address to reply to
+	FMessageAddress Sender;
+};
+
 UCLASS()
 class HOUDINIENGINE_API UHoudiniGeoImportCommandlet : public UCommandlet
 {
@@ -122,6 +137,17 @@ protected:
 
 	void TickDiscoveredFiles();
 
+	// Imports the pending BGEO import requests, a batch at a time, and replies to their senders.
+	// The packages of the outputs are unloaded and garbage is collected once per batch instead of once per file.
+	void ProcessPendingBGEOImports();
+
+	// Imports the BGEO file of the message and replies to the sender with the result.
+	// The packages of the created outputs are added to OutPackagesToUnload.
+	void ImportBGEOAndReply(
+		const FHoudiniPDGImportBGEOMessage& InMessage,
+		const FMessageAddress& InSender,
+		TArray<UPackage*>& OutPackagesToUnload);
+
 private:
 
 	// Messaging end point for receiving messages from PDG manager
@@ -145,6 +171,9 @@ private:
 	// Keep track of files discovered by the watcher, and their state
 	TMap<FString, FDiscoveredFileData> DiscoveredFiles;
 
+	// Import requests received from the PDG manager, processed by the main loop
+	TArray<FPendingBGEOImport> PendingBGEOImports;
+
 	// Mode in which commandlet is running
 	EHoudiniGeoImportCommandletMode Mode;
 	
@@ -30,6 +30,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniTransformMath.h"
 
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
@@ -337,18 +338,39 @@ FHoudiniHandleTranslator::UpdateTransformParameters(UHoudiniHandleComponent* Han
 
 	const HAPI_Session * Session = FHoudiniEngine::Get().GetSession();
 
-	float HapiMatrix[16];
-	FHoudiniApi::ConvertTransformQuatToMatrix(Session, &HapiXform, HapiMatrix);
+	const HAPI_RSTOrder RSTOrder = GetHapiRSTOrder(HandleComponent->RSTParm->Get(TSharedPtr< FString >()));
+	const HAPI_XYZOrder XYZOrder = GetHapiXYZOrder(HandleComponent->RotOrderParm->Get(TSharedPtr< FString >()));
 
+	float HapiMatrix[16];
 	HAPI_TransformEuler HapiEulerXform;
 	FMemory::Memzero< HAPI_TransformEuler >(HapiEulerXform);
-	FHoudiniApi::ConvertMatrixToEuler(
-		Session,
-		HapiMatrix,
-		GetHapiRSTOrder(HandleComponent->RSTParm->Get(TSharedPtr< FString >())),
-		GetHapiXYZOrder(HandleComponent->RotOrderParm->Get(TSharedPtr< FString >())),
-		&HapiEulerXform
-	);
+
+	// This is called while dragging the handle's gizmo, do the conversion natively
+	// so we don't pay for two round trips to the session on every update
+	if (FHoudiniTransformMath::TransformQuatToMatrix(HapiXform, HapiMatrix)
+		&& FHoudiniTransformMath::MatrixToEuler(HapiMatrix, RSTOrder, XYZOrder, HapiEulerXform))
+	{
+		if (FHoudiniTransformMath::IsValidationEnabled())
+		{
+			// Compare HAPI's matrix with the one rebuilt from the Euler transform (whose rotation is in radians)
+			float ValidationMatrix[16];
+			HAPI_TransformEuler EulerXformDegrees = HapiEulerXform;
+			for (int32 Idx = 0; Idx < 3; Idx++)
+				EulerXformDegrees.rotationEuler[Idx] = FMath::RadiansToDegrees(HapiEulerXform.rotationEuler[Idx]);
+
+			float EulerMatrix[16];
+			if (HAPI_RESULT_SUCCESS == FHoudiniApi::ConvertTransformQuatToMatrix(Session, &HapiXform, ValidationMatrix)
+				&& FHoudiniTransformMath::TransformEulerToMatrix(EulerXformDegrees, EulerMatrix))
+			{
+				FHoudiniTransformMath::ValidateMatrix(EulerMatrix, ValidationMatrix, TEXT("UpdateTransformParameters"));
+			}
+		}
+	}
+	else
+	{
+		FHoudiniApi::ConvertTransformQuatToMatrix(Session, &HapiXform, HapiMatrix);
+		FHoudiniApi::ConvertMatrixToEuler(Session, HapiMatrix, RSTOrder, XYZOrder, &HapiEulerXform);
+	}
 
 	*XformParms[int32(EXformParameter::TX)] = HapiEulerXform.position[0];
 	*XformParms[int32(EXformParameter::TY)] = HapiEulerXform.position[1];
@@ -30,6 +30,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniParameter.h"
 #include "HoudiniParameterOperatorPath.h"
@@ -94,6 +95,8 @@ struct FHoudiniMoveTracker
 bool
 FHoudiniInputTranslator::UpdateInputs(UHoudiniAssetComponent* HAC)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInputTranslator::UpdateInputs"), IsValid(HAC) ? HAC->GetAssetId() : -1, -1);
+
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
@@ -113,6 +116,8 @@ FHoudiniInputTranslator::BuildAllInputs(
 	TArray<UHoudiniInput*>& Inputs,
 	TArray<UHoudiniParameter*>& Parameters)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInputTranslator::BuildAllInputs"), AssetId, -1);
+
 	// Ensure the asset has a valid node ID
 	if (AssetId < 0)
 	{
@@ -674,6 +679,8 @@ FHoudiniInputTranslator::SetDefaultAssetFromHDA(UHoudiniInput* Input, bool& bOut
 bool
 FHoudiniInputTranslator::UploadChangedInputs(UHoudiniAssetComponent * HAC)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInputTranslator::UploadChangedInputs"), IsValid(HAC) ? HAC->GetAssetId() : -1, -1);
+
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
@@ -913,6 +920,8 @@ FHoudiniInputTranslator::UpdateTransformOffset(UHoudiniInput* InInput)
 bool
 FHoudiniInputTranslator::UploadInputData(UHoudiniInput* InInput)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniInputTranslator::UploadInputData"));
+
 	if (!InInput || InInput->IsPendingKill())
 		return false;
 
@@ -1184,6 +1193,8 @@ FHoudiniInputTranslator::UploadHoudiniInputObject(
 	UHoudiniInputObject* InInputObject,
 	TArray<int32>& OutCreatedNodeIds)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniInputTranslator::UploadHoudiniInputObject"));
+
 	if (!InInput || !InInputObject)
 		return false;
 
@@ -1706,6 +1717,8 @@ FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh(
 	const bool& bExportColliders,
 	const bool& bImportAsReference)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniInputTranslator::HapiCreateInputNodeForStaticMesh"));
+
 	if (!InObject || InObject->IsPendingKill())
 		return false;
 
@@ -2321,6 +2334,8 @@ bool
 FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 	const FString& InObjNodeName, UHoudiniInputLandscape* InObject, UHoudiniInput* InInput)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniInputTranslator::HapiCreateInputNodeForLandscape"));
+
 	if (!InObject || InObject->IsPendingKill())
 		return false;
 
@@ -2488,6 +2503,8 @@ FHoudiniInputTranslator::UpdateLoadedInputs(UHoudiniAssetComponent* HAC)
 bool
 FHoudiniInputTranslator::UpdateWorldInputs(UHoudiniAssetComponent* HAC)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInputTranslator::UpdateWorldInputs"), IsValid(HAC) ? HAC->GetAssetId() : -1, -1);
+
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
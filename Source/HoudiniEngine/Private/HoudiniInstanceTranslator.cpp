@@ -28,6 +28,7 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInstancedActorComponent.h"
@@ -148,6 +149,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	UObject* InOuterComponent,
 	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutputPartData>* InPreBuiltInstancedOutputPartData)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput"));
+
 	if (!InOutput || InOutput->IsPendingKill())
 		return false;
 
@@ -171,7 +174,9 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	// the UI (foliage mode) at the end
 	bool bHaveAnyFoliageInstancers = false;
 
-	// We also need to cleanup the previous foliages instances (if we have any)
+	// Keep track of the previous foliage instancers, their instances will be cleaned up after the new ones
+	// have been created if they're not updated (the instances that didn't change are kept)
+	TArray<FHoudiniOutputObject> OldFoliageOutputObjects;
 	for (auto& CurrentPair : OldOutputObjects)
 	{
 		// Foliage instancers store a HISMC in the components
@@ -179,10 +184,13 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		if (!IsValid(FoliageHISMC))
 			continue;
 
-		CleanupFoliageInstances(FoliageHISMC, CurrentPair.Value.OutputObject, ParentComponent);
+		OldFoliageOutputObjects.Add(CurrentPair.Value);
 		bHaveAnyFoliageInstancers = true;
 	}
 
+	// The foliage instances of all the parts, applied in bulk once all parts have been processed
+	TArray<FHoudiniFoliageInstancesBatch> FoliageBatches;
+
 	// The default SM to be used if the instanced object has not been found (when using attribute instancers)
 	UStaticMesh * DefaultReferenceSM = FHoudiniEngine::Get().GetHoudiniDefaultReferenceMesh().Get();
 
@@ -320,7 +328,9 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 				InstancedOutputPartData.bSplitMeshInstancer,
 				InstancedOutputPartData.bIsFoliageInstancer,
 				VariationMaterials,
-				InstancedOutputPartData.bForceHISM))
+				0,
+				InstancedOutputPartData.bForceHISM,
+				&FoliageBatches))
 			{
 				// TODO??
 				continue;
@@ -413,6 +423,31 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		}
 	}
 
+	// Add/remove the foliage instances now that we have all of them
+	ApplyFoliageInstancesBatches(FoliageBatches);
+
+	// Clean up the instances of the previous foliage types that weren't updated
+	for (const FHoudiniOutputObject& OldFoliageOutputObject : OldFoliageOutputObjects)
+	{
+		UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(OldFoliageOutputObject.OutputComponent);
+		if (!IsValid(FoliageHISMC))
+			continue;
+
+		AInstancedFoliageActor* InstancedFoliageActor = Cast<AInstancedFoliageActor>(FoliageHISMC->GetOwner());
+		UFoliageType* FoliageType = Cast<UFoliageType>(OldFoliageOutputObject.OutputObject);
+		if (!IsValid(FoliageType) && IsValid(InstancedFoliageActor))
+			FoliageType = InstancedFoliageActor->GetLocalFoliageTypeForSource(OldFoliageOutputObject.OutputObject);
+
+		const bool bUpdated = FoliageBatches.ContainsByPredicate(
+			[InstancedFoliageActor, FoliageType](const FHoudiniFoliageInstancesBatch& Batch)
+		{
+			return Batch.InstancedFoliageActor.Get() == InstancedFoliageActor && Batch.FoliageType.Get() == FoliageType;
+		});
+
+		if (!bUpdated)
+			CleanupFoliageInstances(FoliageHISMC, OldFoliageOutputObject.OutputObject, ParentComponent);
+	}
+
 	// Remove reused components from the old map to avoid their deletion
 	for (const auto& CurNewPair : NewOutputObjects)
 	{
@@ -691,6 +726,8 @@ FHoudiniInstanceTranslator::GetInstancerObjectsAndTransforms(
 	TArray<FString>& OutSplitAttributeValues,
 	TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInstanceTranslator::GetInstancerObjectsAndTransforms"), InHGPO.GeoId, InHGPO.PartId);
+
 	TArray<UObject*> InstancedObjects;
 	TArray<TArray<FTransform>> InstancedTransforms;
 
@@ -1053,6 +1090,8 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 	TArray<FString>& OutSplitAttributeValue,
 	TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms"), InHGPO.GeoId, InHGPO.PartId);
+
 	if (InHGPO.InstancerType != EHoudiniInstancerType::PackedPrimitive)
 		return false;
 
@@ -1206,6 +1245,8 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 	TArray<FString>& OutSplitAttributeValue,
 	TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms"), InHGPO.GeoId, InHGPO.PartId);
+
 	if (InHGPO.InstancerType != EHoudiniInstancerType::AttributeInstancer)
 		return false;
 
@@ -1635,6 +1676,8 @@ FHoudiniInstanceTranslator::GetObjectInstancerHGPOsAndTransforms(
 	TArray<FHoudiniGeoPartObject>& OutInstancedHGPO,
 	TArray<TArray<FTransform>>& OutInstancedTransforms)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInstanceTranslator::GetObjectInstancerHGPOsAndTransforms"), InHGPO.GeoId, InHGPO.PartId);
+
 	if (InHGPO.InstancerType != EHoudiniInstancerType::ObjectInstancer)
 		return false;
 
@@ -1702,8 +1745,12 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 	const bool& InIsFoliageInstancer,
 	const TArray<UMaterialInterface *>& InstancerMaterials,
 	const int32& InstancerObjectIdx,
-	const bool& bForceHISM)
+	const bool& bForceHISM,
+	TArray<FHoudiniFoliageInstancesBatch>* InFoliageBatches)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent"), InstancerGeoPartObject.GeoId, InstancerGeoPartObject.PartId);
+	FHoudiniEngineTrace::NotifyInstancesProduced(InstancedObjectTransforms.Num());
+
 	enum InstancerComponentType
 	{
 		Invalid = -1,
@@ -1838,7 +1885,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 		case Foliage:
 		{
 			bSuccess = CreateOrUpdateFoliageInstances(
-				StaticMesh, FoliageType, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterial);
+				StaticMesh, FoliageType, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterial, InFoliageBatches);
 		}
 	}
 
@@ -2001,6 +2048,12 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 
 	// Set the number of needed instances
 	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num());
+
+	// Instances that will receive the generic properties, indexed by instance
+	TArray<UObject*> PropertyTargets;
+	if (AllPropertyAttributes.Num() > 0)
+		PropertyTargets.SetNumZeroed(InstancedObjectTransforms.Num());
+
 	for (int32 Idx = 0; Idx < InstancedObjectTransforms.Num(); Idx++)
 	{
 		// if we already have an actor, we can reuse it
@@ -2020,11 +2073,14 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 			InstancedActorComponent->SetInstanceTransformAt(Idx, CurTransform);
 		}
 
-		// Update the generic properties for that instance if any
-		// TODO: Handle instance variations w/ Idx
-		UpdateGenericPropertiesAttributes(CurInstance, AllPropertyAttributes, Idx);
+		if (PropertyTargets.IsValidIndex(Idx))
+			PropertyTargets[Idx] = CurInstance;
 	}
 
+	// Update the generic properties for all instances if any, each instance receives the values at its index
+	if (PropertyTargets.Num() > 0)
+		UpdateGenericPropertiesAttributes(PropertyTargets, AllPropertyAttributes);
+
 	// Assign the new ISMC / HISMC to the output component if we created a new one
 	if (bCreatedNewComponent)
 	{
@@ -2191,22 +2247,23 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 	}
 #endif
 
-	// Apply generic attributes if we have any
-	// TODO: Handle variations w/ index
-	// TODO: Optimize
-	// Loop on attributes first, then components,
-	// if failing to find the attrib on a component, skip the rest
+	// Apply generic attributes if we have any, each component receives the values at its index
+	// Loop on attributes first, then components
 	if (AllPropertyAttributes.Num() > 0)
 	{
 		TArray<class UStaticMeshComponent*>& Instances = MeshSplitComponent->GetInstancesForWrite();
+		TArray<UObject*> PropertyTargets;
+		PropertyTargets.SetNumZeroed(Instances.Num());
 		for (int32 InstIndex = 0; InstIndex < Instances.Num(); InstIndex++)
 		{
 			UStaticMeshComponent* CurSMC = Instances[InstIndex];
 			if (!CurSMC || CurSMC->IsPendingKill())
 				continue;
 
-			UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, InstIndex);
+			PropertyTargets[InstIndex] = CurSMC;
 		}
+
+		UpdateGenericPropertiesAttributes(PropertyTargets, AllPropertyAttributes);
 	}
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
@@ -2364,8 +2421,11 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 	const FHoudiniGeoPartObject& InstancerGeoPartObject,
 	USceneComponent* ParentComponent,
 	USceneComponent*& NewInstancedComponent,
-	UMaterialInterface * InstancerMaterial /*=nullptr*/)
+	UMaterialInterface * InstancerMaterial /*=nullptr*/,
+	TArray<FHoudiniFoliageInstancesBatch>* InFoliageBatches /*=nullptr*/)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances"), InstancerGeoPartObject.GeoId, InstancerGeoPartObject.PartId);
+
 	// We need either a valid SM or a valid Foliage Type
 	if ((!InstancedStaticMesh || InstancedStaticMesh->IsPendingKill())
 		&& (!InFoliageType || InFoliageType->IsPendingKill()))
@@ -2419,21 +2479,50 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 		bCreatedNew = true;
 	}
 
-	if (!bCreatedNew && NewInstancedComponent)
+	if (!bCreatedNew)
 	{
-		// TODO: Shouldnt be needed anymore
-		// Clean up the instances previously generated for that component
-		InstancedFoliageActor->DeleteInstancesForComponent(ParentComponent, FoliageType);
+		// The previous instances used to be removed before adding the new ones, which also removed the foliage type
+		// if it only had our instances. Keep adding the instances as for a new foliage type in that case.
+		// The foliage instances are hashed by base id, not by component
+		const FFoliageInfo* ExistingFoliageInfo = InstancedFoliageActor->FindInfo(FoliageType);
+		const FFoliageInstanceBaseId BaseId = InstancedFoliageActor->InstanceBaseCache.GetInstanceBaseId(ParentComponent);
+		const TSet<int32>* ExistingInstances = (ExistingFoliageInfo && BaseId != FFoliageInstanceBaseCache::InvalidBaseId)
+			? ExistingFoliageInfo->ComponentHash.Find(BaseId) : nullptr;
+		if (ExistingInstances && ExistingInstances->Num() == ExistingFoliageInfo->Instances.Num())
+			bCreatedNew = true;
 	}
 
- 	// Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
+	// Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
 	FFoliageInfo* FoliageInfo = InstancedFoliageActor->FindOrAddMesh(FoliageType);
 	if (!FoliageInfo)
 		return false;
 
+	// The instances are accumulated in a batch (per foliage actor/level and foliage type), the previously generated
+	// instances that haven't changed are kept when the batch is applied, so the foliage trees aren't fully rebuilt.
+	TArray<FHoudiniFoliageInstancesBatch> LocalFoliageBatches;
+	TArray<FHoudiniFoliageInstancesBatch>& FoliageBatches = InFoliageBatches ? *InFoliageBatches : LocalFoliageBatches;
+
+	FHoudiniFoliageInstancesBatch* FoliageBatch = FoliageBatches.FindByPredicate(
+		[InstancedFoliageActor, FoliageType, ParentComponent](const FHoudiniFoliageInstancesBatch& Batch)
+	{
+		return Batch.InstancedFoliageActor.Get() == InstancedFoliageActor
+			&& Batch.FoliageType.Get() == FoliageType
+			&& Batch.BaseComponent.Get() == ParentComponent;
+	});
+
+	if (!FoliageBatch)
+	{
+		FoliageBatch = &FoliageBatches.AddDefaulted_GetRef();
+		FoliageBatch->InstancedFoliageActor = InstancedFoliageActor;
+		FoliageBatch->FoliageType = FoliageType;
+		FoliageBatch->BaseComponent = ParentComponent;
+	}
+
+	FoliageBatch->Instances.Reserve(FoliageBatch->Instances.Num() + InstancedObjectTransforms.Num());
+	FoliageBatch->bNeedsApply = true;
+
 	FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
 	FFoliageInstance FoliageInstance;
-	int32 CurrentInstanceCount = 0;
 	for (auto CurrentTransform : InstancedObjectTransforms)
 	{
 		// Use our parent component for the base component of the instances,
@@ -2456,16 +2545,20 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 			FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
 		}
 
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-		CurrentInstanceCount++;
+		FoliageBatch->Instances.Add(FoliageInstance);
 	}
 
-	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();	
-	if (IsValid(FoliageHISMC))
+	// Apply the instances now if we're not batching them, or if the foliage component
+	// will only be created with the first instances
+	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();
+	if (!InFoliageBatches || !IsValid(FoliageHISMC))
 	{
-		// TODO: This was due to a bug in UE4.22-20, check if still needed! 
-		FoliageHISMC->BuildTreeIfOutdated(true, true);
+		ApplyFoliageInstancesBatch(*FoliageBatch);
+		FoliageHISMC = FoliageInfo->GetComponent();
+	}
 
+	if (IsValid(FoliageHISMC))
+	{
 		if (InstancerMaterial)
 		{
 			FoliageHISMC->OverrideMaterials.Empty();
@@ -2580,6 +2673,39 @@ FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributes(
 	return (NumSuccess > 0);
 }
 
+bool
+FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributes(
+	const TArray<UObject*>& InObjects, const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes)
+{
+	if (InObjects.Num() <= 0)
+		return false;
+
+	// Iterate over the found Property attributes
+	int32 NumSuccess = 0;
+	for (const auto& CurrentPropAttribute : InAllPropertyAttributes)
+	{
+		if (CurrentPropAttribute.AttributeName.Equals(TEXT("NumCustomDataFloats"), ESearchCase::IgnoreCase))
+		{
+			// Skip, as setting NumCustomDataFloats this way causes Unreal to crash!
+			HOUDINI_LOG_WARNING(
+				TEXT("Skipping UProperty %s, custom data floats should be modified via the unreal_num_custom_floats and unreal_per_instance_custom_dataX attributes"),
+				*CurrentPropAttribute.AttributeName);
+			continue;
+		}
+
+		// Update the current property on all the objects
+		const int32 NumModified = FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(InObjects, CurrentPropAttribute);
+		if (NumModified <= 0)
+			continue;
+
+		// Success!
+		NumSuccess += NumModified;
+		HOUDINI_LOG_MESSAGE(TEXT("Modified UProperty %s on %d objects"), *CurrentPropAttribute.AttributeName, NumModified);
+	}
+
+	return (NumSuccess > 0);
+}
+
 bool
 FHoudiniInstanceTranslator::RemoveAndDestroyComponent(UObject* InComponent, UObject* InFoliageObject)
 {
@@ -2893,6 +3019,114 @@ FHoudiniInstanceTranslator::SpawnInstanceActor(
 }
 
 
+bool
+FHoudiniInstanceTranslator::ApplyFoliageInstancesBatch(FHoudiniFoliageInstancesBatch& InBatch)
+{
+	InBatch.bNeedsApply = false;
+
+	AInstancedFoliageActor* InstancedFoliageActor = InBatch.InstancedFoliageActor.Get();
+	UFoliageType* FoliageType = InBatch.FoliageType.Get();
+	USceneComponent* BaseComponent = InBatch.BaseComponent.Get();
+	if (!IsValid(InstancedFoliageActor) || !IsValid(FoliageType) || !IsValid(BaseComponent))
+		return false;
+
+	FFoliageInfo* FoliageInfo = InstancedFoliageActor->FindOrAddMesh(FoliageType);
+	if (!FoliageInfo)
+		return false;
+
+	// Bucket the new instances by location (rounded to the unit), to match them with the existing ones
+	TMultiMap<FIntVector, int32> NewInstancesByCell;
+	NewInstancesByCell.Reserve(InBatch.Instances.Num());
+	for (int32 InstanceIdx = 0; InstanceIdx < InBatch.Instances.Num(); InstanceIdx++)
+	{
+		const FVector& Location = InBatch.Instances[InstanceIdx].Location;
+		NewInstancesByCell.Add(FIntVector(FMath::RoundToInt(Location.X), FMath::RoundToInt(Location.Y), FMath::RoundToInt(Location.Z)), InstanceIdx);
+	}
+
+	// Find the instances we previously generated that are identical to a new one, remove the others
+	TBitArray<> NewInstanceExists(false, InBatch.Instances.Num());
+	TArray<int32> InstancesToRemove;
+	const FFoliageInstanceBaseId BaseId = InstancedFoliageActor->InstanceBaseCache.GetInstanceBaseId(BaseComponent);
+	const TSet<int32>* ExistingInstances = BaseId != FFoliageInstanceBaseCache::InvalidBaseId
+		? FoliageInfo->ComponentHash.Find(BaseId) : nullptr;
+	if (ExistingInstances)
+	{
+		TArray<int32> CellInstances;
+		for (const int32& ExistingIdx : *ExistingInstances)
+		{
+			if (!FoliageInfo->Instances.IsValidIndex(ExistingIdx))
+				continue;
+
+			const FFoliageInstance& Existing = FoliageInfo->Instances[ExistingIdx];
+			const FIntVector Cell(FMath::RoundToInt(Existing.Location.X), FMath::RoundToInt(Existing.Location.Y), FMath::RoundToInt(Existing.Location.Z));
+
+			bool bFound = false;
+			CellInstances.Reset();
+			NewInstancesByCell.MultiFind(Cell, CellInstances);
+			for (const int32& NewIdx : CellInstances)
+			{
+				if (NewInstanceExists[NewIdx])
+					continue;
+
+				const FFoliageInstance& New = InBatch.Instances[NewIdx];
+				if (!New.Location.Equals(Existing.Location, KINDA_SMALL_NUMBER)
+					|| !New.Rotation.Equals(Existing.Rotation, KINDA_SMALL_NUMBER)
+					|| !New.DrawScale3D.Equals(Existing.DrawScale3D, KINDA_SMALL_NUMBER))
+					continue;
+
+				NewInstanceExists[NewIdx] = true;
+				bFound = true;
+				break;
+			}
+
+			if (!bFound)
+				InstancesToRemove.Add(ExistingIdx);
+		}
+	}
+
+	TArray<const FFoliageInstance*> InstancesToAdd;
+	for (int32 InstanceIdx = 0; InstanceIdx < InBatch.Instances.Num(); InstanceIdx++)
+	{
+		if (!NewInstanceExists[InstanceIdx])
+			InstancesToAdd.Add(&InBatch.Instances[InstanceIdx]);
+	}
+
+	if (InstancesToRemove.Num() <= 0 && InstancesToAdd.Num() <= 0)
+		return false;
+
+	// Remove and add the instances in bulk, and only rebuild the foliage tree once
+	if (InstancesToRemove.Num() > 0)
+		FoliageInfo->RemoveInstances(InstancedFoliageActor, InstancesToRemove, InstancesToAdd.Num() <= 0);
+
+	if (InstancesToAdd.Num() > 0)
+		FoliageInfo->AddInstances(InstancedFoliageActor, FoliageType, InstancesToAdd);
+
+	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();
+	if (IsValid(FoliageHISMC))
+	{
+		// TODO: This was due to a bug in UE4.22-20, check if still needed! 
+		FoliageHISMC->BuildTreeIfOutdated(true, true);
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Foliage %s: kept %d instances, removed %d, added %d."), *FoliageType->GetName(),
+		InBatch.Instances.Num() - InstancesToAdd.Num(), InstancesToRemove.Num(), InstancesToAdd.Num());
+
+	return true;
+}
+
+bool
+FHoudiniInstanceTranslator::ApplyFoliageInstancesBatches(TArray<FHoudiniFoliageInstancesBatch>& InBatches)
+{
+	bool bModified = false;
+	for (FHoudiniFoliageInstancesBatch& Batch : InBatches)
+	{
+		if (Batch.bNeedsApply)
+			bModified |= ApplyFoliageInstancesBatch(Batch);
+	}
+
+	return bModified;
+}
+
 void 
 FHoudiniInstanceTranslator::CleanupFoliageInstances(
 	UHierarchicalInstancedStaticMeshComponent* InFoliageHISMC,
@@ -33,6 +33,7 @@
 #include "UObject/ObjectMacros.h"
 
 #include "HoudiniGenericAttribute.h"
+#include "InstancedFoliage.h"
 
 #include "HoudiniInstanceTranslator.generated.h"
 
@@ -40,6 +41,24 @@ class UStaticMesh;
 class UFoliageType;
 class UHoudiniStaticMesh;
 class UHoudiniInstancedActorComponent;
+class AInstancedFoliageActor;
+
+// Foliage instances generated for a foliage type in an instanced foliage actor (there is one per level).
+// The instances of all the parts of an output are accumulated, then applied in bulk:
+// only the instances that differ from the ones previously generated are removed/added.
+struct HOUDINIENGINE_API FHoudiniFoliageInstancesBatch
+{
+	TWeakObjectPtr<AInstancedFoliageActor> InstancedFoliageActor;
+	TWeakObjectPtr<UFoliageType> FoliageType;
+	// Base component of the instances, used to find the previously generated instances
+	TWeakObjectPtr<USceneComponent> BaseComponent;
+
+	// All the instances that should exist for the base component and foliage type
+	TArray<FFoliageInstance> Instances;
+
+	// Indicates instances have been added since the batch was last applied
+	bool bNeedsApply = false;
+};
 
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniInstancedOutputPerSplitAttributes
@@ -241,7 +260,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const bool& InIsFoliageInstancer,
 			const TArray<UMaterialInterface *>& InstancerMaterials,
 			const int32& InstancerObjectIdx = 0,
-			const bool& bForceHISM = false);
+			const bool& bForceHISM = false,
+			TArray<FHoudiniFoliageInstancesBatch>* InFoliageBatches = nullptr);
 
 		// Create or update an ISMC / HISMC
 		static bool CreateOrUpdateInstancedStaticMeshComponent(
@@ -293,6 +313,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			UMaterialInterface * InstancerMaterial = nullptr);
 
 		// Create or update a Foliage instances
+		// If InFoliageBatches is valid, the instances are added to the batches instead, and need to be
+		// applied with ApplyFoliageInstancesBatches(). Otherwise they are applied immediately.
 		static bool CreateOrUpdateFoliageInstances(
 			UStaticMesh* InstancedStaticMesh,
 			UFoliageType* InFoliageType,
@@ -301,7 +323,15 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const FHoudiniGeoPartObject& InstancerGeoPartObject,
 			USceneComponent* ParentComponent,
 			USceneComponent*& NewInstancedComponent,
-			UMaterialInterface * InstancerMaterial /*=nullptr*/);
+			UMaterialInterface * InstancerMaterial /*=nullptr*/,
+			TArray<FHoudiniFoliageInstancesBatch>* InFoliageBatches = nullptr);
+
+		// Removes the stale instances of the batch's base component and adds the missing ones, in bulk.
+		// Returns true if the foliage instances were modified.
+		static bool ApplyFoliageInstancesBatch(FHoudiniFoliageInstancesBatch& InBatch);
+
+		// Applies all the batches that need it
+		static bool ApplyFoliageInstancesBatches(TArray<FHoudiniFoliageInstancesBatch>& InBatches);
 
 		// Helper fumction to properly remove/destroy a component
 		static bool RemoveAndDestroyComponent(
@@ -332,6 +362,12 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes,
 			const int32& AtIndex);
 
+		// Batch version, InObjects[n] receives the attribute values at index n.
+		// Loops on the attributes first, then on the objects, so each property is only looked up once per class.
+		static bool UpdateGenericPropertiesAttributes(
+			const TArray<UObject*>& InObjects,
+			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes);
+
 		static bool GetMaterialOverridesFromAttributes(
 			const int32& InGeoNodeId,
 			const int32& InPartId, 
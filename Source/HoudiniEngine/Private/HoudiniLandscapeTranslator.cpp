@@ -32,6 +32,7 @@
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEnginePrivatePCH.h"
@@ -103,6 +104,8 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	TArray<UPackage*>& OutCreatedPackages
 )
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniLandscapeTranslator::CreateLandscape"));
+
 	check(LayerMinimums.Contains(TEXT("height")));
 	check(LayerMaximums.Contains(TEXT("height")));
 
@@ -1522,6 +1525,8 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	FTransform& LandscapeTransform,
 	const bool& NoResize)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData"));
+
 	IntHeightData.Empty();
 	LandscapeTransform.SetIdentity();
 
@@ -2193,6 +2198,8 @@ bool FHoudiniLandscapeTranslator::GetHoudiniHeightfieldVolumeInfo(const FHoudini
 bool 
 FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPartObject* HGPO, TArray<float> &OutFloatArr, float &OutFloatMin, float &OutFloatMax) 
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData"), HGPO ? HGPO->GeoId : -1, HGPO ? HGPO->PartId : -1);
+
 	OutFloatArr.Empty();
 	OutFloatMin = 0.f;
 	OutFloatMax = 0.f;
@@ -2300,6 +2307,8 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 	TArray<UPackage*>& OutCreatedPackages
 	)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers"), Heightfield.GeoId, Heightfield.PartId);
+
 	OutLayerInfos.Empty();
 
 	// Get the names of all non weight blended layers
@@ -2794,6 +2803,8 @@ FHoudiniLandscapeTranslator::CreateLandscapeTileInWorld(
 	ULevel* InLevel,
 	FHoudiniPackageParams InPackageParams)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniLandscapeTranslator::CreateLandscapeTileInWorld"));
+
 	if (!IsValid(InWorld))
 		return nullptr;
 
@@ -33,6 +33,8 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineTrace.h"
+#include "HoudiniEngineOutputStats.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniAssetActor.h"
@@ -87,6 +89,8 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	bool bInTreatExistingMaterialsAsUpToDate,
 	bool bInDestroyProxies)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput"));
+
 	if (!InOutput || InOutput->IsPendingKill())
 		return false;
 
@@ -156,6 +160,8 @@ FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
 	bool bInDestroyProxies,
 	bool bInApplyGenericProperties)
 {
+	HOUDINI_TRACE_SCOPE_HDA(TEXT("FHoudiniMeshTranslator::CreateOrUpdateAllComponents"));
+
 	if (!InOutput || InOutput->IsPendingKill())
 		return false;
 
@@ -555,6 +561,8 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	const FMeshBuildSettings& InSMBuildSettings,
 	bool bInTreatExistingMaterialsAsUpToDate)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject"), InHGPO.GeoId, InHGPO.PartId);
+
 	// If we're not forcing the rebuild
 	// No need to recreate something that hasn't changed
 	if (!InForceRebuild && (!InHGPO.bHasGeoChanged || !InHGPO.bHasPartChanged) && InOutputObjects.Num() > 0)
@@ -600,6 +608,8 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	OutOutputObjects = CurrentTranslator.OutputObjects;
 	AssignmentMaterialMap = CurrentTranslator.OutputAssignmentMaterials;
 
+	FHoudiniEngineTrace::NotifyVerticesProduced(InHGPO.PartInfo.VertexCount);
+
 	return true;
 }
 
@@ -1425,6 +1435,8 @@ FHoudiniMeshTranslator::CreateNewHoudiniStaticMesh(const FString& InSplitIdentif
 bool
 FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniMeshTranslator::CreateStaticMesh_RawMesh"), HGPO.GeoId, HGPO.PartId);
+
 	double time_start = FPlatformTime::Seconds();
 
 	// Start by updating the vertex list
@@ -2670,7 +2682,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 		// bSilent doesnt add the Build Errors...
 		double build_start = FPlatformTime::Seconds();
 		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);
+		{
+			FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::MeshBuild);
+			SM->Build(true, &SMBuildErrors);
+		}
 		double build_end = FPlatformTime::Seconds();
 		HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->Build() executed in %f seconds."), build_end - build_start);
 
@@ -2739,6 +2754,8 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 bool
 FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription"), HGPO.GeoId, HGPO.PartId);
+
 	double time_start = FPlatformTime::Seconds();
 
 	// Start by updating the vertex list
@@ -3999,7 +4016,10 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 		// bSilent doesnt add the Build Errors...
 		double build_start = FPlatformTime::Seconds();
 		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);
+		{
+			FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::MeshBuild);
+			SM->Build(true, &SMBuildErrors);
+		}
 		double build_end = FPlatformTime::Seconds();
 		HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->Build() executed in %f seconds."), build_end - build_start);
 
@@ -4972,6 +4992,7 @@ bool
 FHoudiniMeshTranslator::CreateNeededMaterials()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT("FHoudiniMeshTranslator::CreateNeededMaterials"));
+	FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::MaterialTexture);
 
 	UpdatePartNeededMaterials();
 
@@ -5180,6 +5201,8 @@ FHoudiniMeshTranslator::GetSplitTypeFromSplitName(const FString& InSplitName)
 bool
 FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
 {
+	FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::Collision);
+
 	// Get the vertex indices for the split group
 	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
 
@@ -5282,6 +5305,8 @@ FHoudiniMeshTranslator::AddConvexCollisionToAggregate(const FString& SplitGroupN
 bool
 FHoudiniMeshTranslator::AddSimpleCollisionToAggregate(const FString& SplitGroupName, FKAggregateGeom& AggCollisions)
 {
+	FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::Collision);
+
 	// Get the vertex indices for the split group
 	TArray<int32>& SplitGroupVertexList = AllSplitVertexLists[SplitGroupName];
 
@@ -31,6 +31,8 @@
 #include "HoudiniEngine.h"
 
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineTrace.h"
+#include "HoudiniEngineOutputStats.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniEnginePrivatePCH.h"
@@ -68,6 +70,8 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	const bool& bInForceUpdate,
 	bool& bOutHasHoudiniStaticMeshOutput)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniOutputTranslator::UpdateOutputs"), IsValid(HAC) ? HAC->GetAssetId() : -1, -1);
+
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
@@ -95,7 +99,13 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		}
 
 		TArray<UHoudiniOutput*> NewOutputs;
-		if (FHoudiniOutputTranslator::BuildAllOutputs(HAC->GetAssetId(), HAC, HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos))
+		bool bOutputsBuilt = false;
+		{
+			FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::OutputFetch, TEXT("PartInfos"));
+			bOutputsBuilt = FHoudiniOutputTranslator::BuildAllOutputs(HAC->GetAssetId(), HAC, HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos);
+		}
+
+		if (bOutputsBuilt)
 		{
 			// NOTE: For now we are currently forcing all outputs to be cleared here. There is still an issue where, in some
 			// circumstances, landscape tiles disappear when clearing outputs after processing.
@@ -285,6 +295,9 @@ FHoudiniOutputTranslator::UpdateOutputs(
 		if (!HAC->IsOutputTypeSupported(CurOutput->GetType()))
 			continue;
 
+		// Time spent processing this output, excluding the mesh build/collision/material phases
+		FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::OutputFetch, UEnum::GetValueAsString(CurOutput->GetType()));
+
 		switch (CurOutput->GetType())
 		{
 			case EHoudiniOutputType::Mesh:
@@ -394,6 +407,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 			// make use of untracked actors on the HAC (similar to PDG Asset Link).
 			TArray<TWeakObjectPtr<AActor>> UntrackedActors;
 
+			FHoudiniCookPhaseScope LandscapePhaseScope(EHoudiniCookPhase::Landscape);
 			FHoudiniLandscapeTranslator::CreateLandscape(
 				CurOutput,
 				UntrackedActors,
@@ -447,6 +461,7 @@ FHoudiniOutputTranslator::UpdateOutputs(
 	// Now that all meshes have been created, process the instancers
 	for (auto& CurOutput : InstancerOutputs)
 	{
+		FHoudiniCookPhaseScope PhaseScope(EHoudiniCookPhase::Instancer);
 		FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
 		NumVisibleOutputs++;
 	}
@@ -902,6 +917,160 @@ FHoudiniOutputTranslator::UploadChangedEditableOutput(
 }
 
 
+// Lookup tables used by BuildAllOutputs() to find the output matching an HGPO without scanning all the outputs.
+// The tables only narrow down the candidates: matches are still confirmed with HasHoudiniGeoPartObject()
+// and HeightfieldMatch(), and the first matching output in the array order is returned as before.
+struct FHoudiniOutputLookup
+{
+	// (ObjectId, GeoId, PartId, Type) for parts, (AssetId, ObjectId, GeoId, VolumeTileIndex) for volumes
+	typedef TTuple<int32, int32, int32, int32> FHGPOKey;
+
+	static FHGPOKey MakePartKey(const FHoudiniGeoPartObject& InHGPO)
+	{
+		return FHGPOKey(InHGPO.ObjectId, InHGPO.GeoId, InHGPO.PartId, (int32)InHGPO.Type);
+	};
+
+	static FHGPOKey MakeVolumeKey(const FHoudiniGeoPartObject& InHGPO)
+	{
+		return FHGPOKey(InHGPO.AssetId, InHGPO.ObjectId, InHGPO.GeoId, InHGPO.VolumeTileIndex);
+	};
+
+	template<typename KeyType>
+	static void AddCandidate(TMap<KeyType, TArray<int32>>& InMap, const KeyType& InKey, const int32& InOutputIdx)
+	{
+		InMap.FindOrAdd(InKey).AddUnique(InOutputIdx);
+	};
+
+	// Indexes the HGPOs of the outputs from the previous cook
+	void IndexOldOutputs(const TArray<UHoudiniOutput*>& InOldOutputs)
+	{
+		OldOutputs = InOldOutputs;
+		for (int32 OutputIdx = 0; OutputIdx < OldOutputs.Num(); OutputIdx++)
+		{
+			if (!OldOutputs[OutputIdx])
+				continue;
+
+			for (const FHoudiniGeoPartObject& CurHGPO : OldOutputs[OutputIdx]->GetHoudiniGeoPartObjects())
+			{
+				// HGPOs with matching IDs and type are equal
+				AddCandidate(OldOutputsByPartKey, MakePartKey(CurHGPO), OutputIdx);
+				// Otherwise HGPOs need at least matching part names to be equal
+				AddCandidate(OldOutputsByPartName, CurHGPO.PartName, OutputIdx);
+
+				if (CurHGPO.Type == EHoudiniPartType::Volume)
+					AddCandidate(OldOutputsByVolumeKey, MakeVolumeKey(CurHGPO), OutputIdx);
+			}
+		}
+	};
+
+	// Returns the first unclaimed old output containing an HGPO equal to InHGPO
+	UHoudiniOutput* FindOldOutput(const FHoudiniGeoPartObject& InHGPO) const
+	{
+		TArray<int32> Candidates;
+		if (const TArray<int32>* FoundByKey = OldOutputsByPartKey.Find(MakePartKey(InHGPO)))
+			Candidates.Append(*FoundByKey);
+		if (const TArray<int32>* FoundByName = OldOutputsByPartName.Find(InHGPO.PartName))
+			Candidates.Append(*FoundByName);
+
+		Candidates.Sort();
+		for (const int32& OutputIdx : Candidates)
+		{
+			UHoudiniOutput* CurOutput = OldOutputs[OutputIdx];
+			if (!ClaimedOldOutputs.Contains(CurOutput) && CurOutput->HasHoudiniGeoPartObject(InHGPO))
+				return CurOutput;
+		}
+
+		return nullptr;
+	};
+
+	// Returns the first unclaimed old heightfield output with a volume of the same name as InHGPO
+	UHoudiniOutput* FindOldHeightfield(const FHoudiniGeoPartObject& InHGPO) const
+	{
+		const TArray<int32>* Candidates = OldOutputsByVolumeKey.Find(MakeVolumeKey(InHGPO));
+		if (!Candidates)
+			return nullptr;
+
+		for (const int32& OutputIdx : *Candidates)
+		{
+			UHoudiniOutput* CurOutput = OldOutputs[OutputIdx];
+			if (!ClaimedOldOutputs.Contains(CurOutput) && CurOutput->HeightfieldMatch(InHGPO, true))
+				return CurOutput;
+		}
+
+		return nullptr;
+	};
+
+	// Old outputs that have been moved to the new outputs can't be matched anymore
+	void ClaimOldOutput(UHoudiniOutput* InOutput)
+	{
+		ClaimedOldOutputs.Add(InOutput);
+	};
+
+	// Adds an output to the new outputs if needed, and returns its index in that array
+	int32 AddNewOutput(TArray<UHoudiniOutput*>& OutNewOutputs, UHoudiniOutput* InOutput)
+	{
+		if (const int32* FoundIdx = NewOutputIndices.Find(InOutput))
+			return *FoundIdx;
+
+		const int32 OutputIdx = OutNewOutputs.Add(InOutput);
+		NewOutputIndices.Add(InOutput, OutputIdx);
+
+		// The output can already contain HGPOs from the previous cook
+		for (const FHoudiniGeoPartObject& CurHGPO : InOutput->GetHoudiniGeoPartObjects())
+			IndexNewHGPO(OutputIdx, CurHGPO);
+
+		return OutputIdx;
+	};
+
+	// Indexes the outputs that are already in the new outputs
+	void IndexNewOutputs(const TArray<UHoudiniOutput*>& InNewOutputs)
+	{
+		for (int32 OutputIdx = 0; OutputIdx < InNewOutputs.Num(); OutputIdx++)
+		{
+			if (!InNewOutputs[OutputIdx] || NewOutputIndices.Contains(InNewOutputs[OutputIdx]))
+				continue;
+
+			NewOutputIndices.Add(InNewOutputs[OutputIdx], OutputIdx);
+			for (const FHoudiniGeoPartObject& CurHGPO : InNewOutputs[OutputIdx]->GetHoudiniGeoPartObjects())
+				IndexNewHGPO(OutputIdx, CurHGPO);
+		}
+	};
+
+	// Must be called when an HGPO is added to one of the new outputs
+	void IndexNewHGPO(const int32& InOutputIdx, const FHoudiniGeoPartObject& InHGPO)
+	{
+		if (InHGPO.Type == EHoudiniPartType::Volume)
+			AddCandidate(NewOutputsByVolumeKey, MakeVolumeKey(InHGPO), InOutputIdx);
+	};
+
+	// Returns the index of the first new heightfield output with a volume on the same tile but with a different name
+	int32 FindNewHeightfield(const TArray<UHoudiniOutput*>& InNewOutputs, const FHoudiniGeoPartObject& InHGPO) const
+	{
+		const TArray<int32>* FoundCandidates = NewOutputsByVolumeKey.Find(MakeVolumeKey(InHGPO));
+		if (!FoundCandidates)
+			return INDEX_NONE;
+
+		TArray<int32> Candidates = *FoundCandidates;
+		Candidates.Sort();
+		for (const int32& OutputIdx : Candidates)
+		{
+			if (InNewOutputs.IsValidIndex(OutputIdx) && InNewOutputs[OutputIdx] && InNewOutputs[OutputIdx]->HeightfieldMatch(InHGPO, false))
+				return OutputIdx;
+		}
+
+		return INDEX_NONE;
+	};
+
+	TArray<UHoudiniOutput*> OldOutputs;
+	TSet<UHoudiniOutput*> ClaimedOldOutputs;
+	TMap<FHGPOKey, TArray<int32>> OldOutputsByPartKey;
+	TMap<FString, TArray<int32>> OldOutputsByPartName;
+	TMap<FHGPOKey, TArray<int32>> OldOutputsByVolumeKey;
+
+	TMap<UHoudiniOutput*, int32> NewOutputIndices;
+	TMap<FHGPOKey, TArray<int32>> NewOutputsByVolumeKey;
+};
+
 bool
 FHoudiniOutputTranslator::BuildAllOutputs(
 	const HAPI_NodeId& AssetId,
@@ -910,41 +1079,21 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	TArray<UHoudiniOutput*>& OutNewOutputs,
 	const bool& InOutputTemplatedGeos)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniOutputTranslator::BuildAllOutputs"), AssetId, -1);
+
 	// Ensure the asset has a valid node ID
 	if (AssetId < 0)
 	{
 		return false;
 	}
 
-	// Get the AssetInfo
-	HAPI_AssetInfo AssetInfo;
-	FHoudiniApi::AssetInfo_Init(&AssetInfo);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAssetInfo(
-		FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo), false);
-
-	FString CurrentAssetName;
-	{
-		FHoudiniEngineString hapiSTR(AssetInfo.nameSH);
-		hapiSTR.ToFString(CurrentAssetName);
-	}
-
-	// Retrieve the asset's transform.
-	// TODO: Unused?!
-	//FTransform AssetUnrealTransform;
-	//if (!FHoudiniEngineUtils::HapiGetAssetTransform(AssetId, AssetUnrealTransform))
-	//	return false;
-
-	// Retrieve information about each object contained within our asset.
-	TArray<HAPI_ObjectInfo> ObjectInfos;
-	if (!FHoudiniEngineUtils::HapiGetObjectInfos(AssetId, ObjectInfos))
+	// Fetch the object/geo/part topology of the asset first, so we can then walk it
+	// in memory instead of querying HAPI for every object, geo and part
+	FHoudiniTopologySnapshot Snapshot;
+	if (!FHoudiniOutputTranslator::BuildTopologySnapshot(AssetId, InOldOutputs, InOutputTemplatedGeos, Snapshot))
 		return false;
 
-	//const int32 ObjectCount = ObjectInfos.Num();
-
-	// Retrieve transforms for each object in this asset.
-	TArray<HAPI_Transform> ObjectTransforms;
-	if (!FHoudiniEngineUtils::HapiGetObjectTransforms(AssetId, ObjectTransforms))
-		return false;
+	const FString& CurrentAssetName = Snapshot.AssetName;
 
 	// Mark all the previous HGPOs on the outputs as stale
 	// This indicates that they were from a previous cook and should then be deleted
@@ -959,219 +1108,43 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	// match them with theit corresponding height volume after
 	TArray<FHoudiniGeoPartObject> UnassignedVolumeParts;
 
-	TArray<FHoudiniMeshSocket> AllSockets;
+	// Index the outputs' HGPOs so each part can be matched to its output without scanning all of them
+	FHoudiniOutputLookup OutputLookup;
+	OutputLookup.IndexOldOutputs(InOldOutputs);
+	OutputLookup.IndexNewOutputs(OutNewOutputs);
 
 	// Iterate through all objects.
-	int32 OutputIdx = 1;
-	for (int32 ObjectId = 0; ObjectId < ObjectInfos.Num(); ++ObjectId)
+	for (const FHoudiniObjectSnapshot& CurrentObject : Snapshot.Objects)
 	{
-		// Retrieve the object info
-		const HAPI_ObjectInfo& CurrentHapiObjectInfo = ObjectInfos[ObjectId];
-
-		// Cache/convert them
-		FHoudiniObjectInfo CurrentObjectInfo;
-		CacheObjectInfo(CurrentHapiObjectInfo, CurrentObjectInfo);
+		const HAPI_ObjectInfo& CurrentHapiObjectInfo = CurrentObject.ObjectInfo;
+		const FHoudiniObjectInfo& CurrentObjectInfo = CurrentObject.CachedObjectInfo;
 
 		// Retrieve object name.
-		FString CurrentObjectName = CurrentObjectInfo.Name;
+		const FString& CurrentObjectName = CurrentObjectInfo.Name;
 
 		// Get transformation for this object.
-		const HAPI_Transform & ObjectTransform = ObjectTransforms[ObjectId];
-		FTransform TransformMatrix;
-		FHoudiniEngineUtils::TranslateHapiTransform(ObjectTransform, TransformMatrix);
-
-		// TODO: Check transforms??
-
-		// Build an array of the geos we'll need to process
-		// In most case, it will only be the display geo, 
-		// but we may also want to process editable geos as well
-		TArray<HAPI_GeoInfo> GeoInfos;
-
-		// Get the Display Geo's info
-		HAPI_GeoInfo DisplayHapiGeoInfo;
-		FHoudiniApi::GeoInfo_Init(&DisplayHapiGeoInfo);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetDisplayGeoInfo(
-			FHoudiniEngine::Get().GetSession(), CurrentHapiObjectInfo.nodeId, &DisplayHapiGeoInfo))
-		{
-			HOUDINI_LOG_MESSAGE(
-				TEXT("Creating Static Meshes: Object [%d %s] unable to retrieve GeoInfo, - skipping."),
-				CurrentHapiObjectInfo.nodeId, *CurrentObjectName);		
-		}
-		else
-		{
-			// Add the display geo info to the array
-			GeoInfos.Add(DisplayHapiGeoInfo);
-		}
-
-		// Handle the editable nodes for this geo
-		// Start by getting the number of editable nodes
-		int32 EditableNodeCount = 0;
-		HOUDINI_CHECK_ERROR(FHoudiniApi::ComposeChildNodeList(
-			FHoudiniEngine::Get().GetSession(),
-			CurrentHapiObjectInfo.nodeId, HAPI_NODETYPE_SOP, HAPI_NODEFLAGS_EDITABLE,
-			true, &EditableNodeCount));
-
-		if (EditableNodeCount > 0)
-		{
-			TArray< HAPI_NodeId > EditableNodeIds;
-			EditableNodeIds.SetNumUninitialized(EditableNodeCount);
-			HOUDINI_CHECK_ERROR(FHoudiniApi::GetComposedChildNodeList(
-				FHoudiniEngine::Get().GetSession(), 
-				AssetId, EditableNodeIds.GetData(), EditableNodeCount));
-
-			for (int32 nEditable = 0; nEditable < EditableNodeCount; nEditable++)
-			{
-				HAPI_GeoInfo CurrentEditableGeoInfo;
-				FHoudiniApi::GeoInfo_Init(&CurrentEditableGeoInfo);
-				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-					FHoudiniEngine::Get().GetSession(), 
-					EditableNodeIds[nEditable], &CurrentEditableGeoInfo));
-
-				// Do not process the main display geo twice!
-				if (CurrentEditableGeoInfo.isDisplayGeo)
-					continue;
-
-				// We only handle editable curves for now
-				if (CurrentEditableGeoInfo.type != HAPI_GEOTYPE_CURVE)
-					continue;
-
-				// Add this geo to the geo info array
-				GeoInfos.Add(CurrentEditableGeoInfo);
-			}
-		}
-
-		// Handle the templated nodes if desired
-		if (InOutputTemplatedGeos)
-		{
-			// Start by getting the number of templated nodes
-			int32 TemplatedNodeCount = 0;
-			HOUDINI_CHECK_ERROR(FHoudiniApi::ComposeChildNodeList(
-				FHoudiniEngine::Get().GetSession(),
-				CurrentHapiObjectInfo.nodeId,
-				HAPI_NODETYPE_SOP, HAPI_NODEFLAGS_TEMPLATED,
-				true, &TemplatedNodeCount));
-
-			if (TemplatedNodeCount > 0)
-			{
-				TArray<HAPI_NodeId> TemplatedNodeIds;
-				TemplatedNodeIds.SetNumUninitialized(TemplatedNodeCount);
-				HOUDINI_CHECK_ERROR(FHoudiniApi::GetComposedChildNodeList(
-					FHoudiniEngine::Get().GetSession(),
-					CurrentHapiObjectInfo.nodeId, TemplatedNodeIds.GetData(), TemplatedNodeCount));
-
-				for (int32 nTemplated = 0; nTemplated < TemplatedNodeCount; nTemplated++)
-				{
-					HAPI_GeoInfo CurrentTemplatedGeoInfo;
-					FHoudiniApi::GeoInfo_Init(&CurrentTemplatedGeoInfo);
-					HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-						FHoudiniEngine::Get().GetSession(),
-						TemplatedNodeIds[nTemplated], &CurrentTemplatedGeoInfo));
-
-					// Do not process the main display geo twice!
-					if (CurrentTemplatedGeoInfo.isDisplayGeo)
-						continue;
-
-					// We don't want all the nested template node IDs,
-					// as our HDA could potentially be using other HDAs with nested template flags
-					// Make sure the parent of the templated node is either the HDA, the current OBJ or the Display SOP
-					HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId(CurrentTemplatedGeoInfo.nodeId);
-					if (ParentId != CurrentHapiObjectInfo.nodeId
-						&& ParentId != DisplayHapiGeoInfo.nodeId
-						&& ParentId != AssetId)
-					{
-						continue;
-					}
-
-					// Add this geo to the geo info array
-					GeoInfos.Add(CurrentTemplatedGeoInfo);
-				}
-			}
-		}
+		const FTransform& TransformMatrix = CurrentObject.Transform;
 
 		// Iterates through the geos we want to process
-		for (int32 GeoIdx = 0; GeoIdx < GeoInfos.Num(); GeoIdx++)
+		for (const FHoudiniGeoSnapshot& CurrentGeo : CurrentObject.Geos)
 		{
-			// Cook editable/templated nodes to get their parts.
-			const HAPI_GeoInfo& CurrentHapiGeoInfo = GeoInfos[GeoIdx];
-			if ((CurrentHapiGeoInfo.isEditable && CurrentHapiGeoInfo.partCount <= 0)
-				|| (CurrentHapiGeoInfo.isTemplated && CurrentHapiGeoInfo.partCount <= 0))
-			{
-				//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-				//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, &CookOptions);
-				FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-
-				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-					FHoudiniEngine::Get().GetSession(),
-					CurrentHapiGeoInfo.nodeId,
-					&GeoInfos[GeoIdx]));
-			}
-
-			// Cache/convert the display geo's info
-			FHoudiniGeoInfo CurrentGeoInfo;
-			CacheGeoInfo(CurrentHapiGeoInfo, CurrentGeoInfo);
+			const HAPI_GeoInfo& CurrentHapiGeoInfo = CurrentGeo.GeoInfo;
+			const FHoudiniGeoInfo& CurrentGeoInfo = CurrentGeo.CachedGeoInfo;
 
 			// Simply create an empty array for this geo's group names
 			// We might need it later for splitting
 			TArray<FString> GeoGroupNames;
-			bool HasSocketGroups = false;
 
 			// Iterate on this geo's parts
-			for (int32 PartId = 0; PartId < CurrentGeoInfo.PartCount; ++PartId)
+			for (const FHoudiniPartSnapshot& CurrentPart : CurrentGeo.Parts)
 			{
-				// Get part information.
-				HAPI_PartInfo CurrentHapiPartInfo;
-				FHoudiniApi::PartInfo_Init(&CurrentHapiPartInfo);
-
-				// If the geo is templated, cook it manually
-				if (CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
-				{
-					//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-					//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, &CookOptions);
-					FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-				}
-
-				bool bPartInfoFailed = false;
-				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
-					FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
-				{
-					bPartInfoFailed = true;
-
-					// If the geo is templated, attempt to cook it manually
-					if(CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
-					{
-						//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-						//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, nullptr);
-						FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-
-						HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-							FHoudiniEngine::Get().GetSession(),
-							CurrentHapiGeoInfo.nodeId,
-							&GeoInfos[GeoIdx]));
-
-						if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(
-							FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
-						{
-							// We managed to get the templated part infos after cooking
-							bPartInfoFailed = false;
-						}
-					}
-				}
-
-				if (bPartInfoFailed)
-				{
-					// Error retrieving part info.
-					HOUDINI_LOG_MESSAGE(
-						TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d] unable to retrieve PartInfo - skipping."),
-						CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId);
-					continue;
-				}
-
-				// Convert/cache the part info
-				FHoudiniPartInfo CurrentPartInfo;
-				CachePartInfo(CurrentHapiPartInfo, CurrentPartInfo);
+				const HAPI_PartInfo& CurrentHapiPartInfo = CurrentPart.PartInfo;
+				const FHoudiniPartInfo& CurrentPartInfo = CurrentPart.CachedPartInfo;
+				const FHoudiniGeoPartObject& CachedHGPO = CurrentPart.CachedHGPO;
+				const int32 PartId = CurrentHapiPartInfo.id;
 
 				// Retrieve part name.
-				FString CurrentPartName = CurrentPartInfo.Name;
+				const FString& CurrentPartName = CurrentPartInfo.Name;
 
 				// Unsupported/Invalid part
 				if (CurrentPartInfo.Type == EHoudiniPartType::Invalid)
@@ -1180,101 +1153,110 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				// Update part/instancer type from the part infos
 				EHoudiniPartType CurrentPartType = EHoudiniPartType::Invalid;
 				EHoudiniInstancerType CurrentInstancerType = EHoudiniInstancerType::Invalid;
-				switch (CurrentHapiPartInfo.type)
+				if (CurrentPart.bHasCachedHGPO)
 				{
-					case HAPI_PARTTYPE_BOX:
-					case HAPI_PARTTYPE_SPHERE:
-					case HAPI_PARTTYPE_MESH:
+					// The geo hasn't changed since the previous cook, reuse the part/instancer type
+					CurrentPartType = CachedHGPO.Type;
+					CurrentInstancerType = CachedHGPO.InstancerType;
+				}
+				else
+				{
+					switch (CurrentHapiPartInfo.type)
 					{
-						if (CurrentHapiGeoInfo.type == HAPI_GEOTYPE_CURVE)
+						case HAPI_PARTTYPE_BOX:
+						case HAPI_PARTTYPE_SPHERE:
+						case HAPI_PARTTYPE_MESH:
 						{
-							// Closed curve will be seen as mesh
-							CurrentPartType = EHoudiniPartType::Curve;
-						}
-						else
-						{
-							CurrentPartType = EHoudiniPartType::Mesh;
-							
-							if (CurrentHapiObjectInfo.isInstancer)
-							{
-								if (FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
-								{
-									// That part is actually an attribute instancer
-									CurrentPartType = EHoudiniPartType::Instancer;
-									// Instancer type is set by IsAttributeInstancer
-								}
-								else
-								{
-									// That part is actually an instancer
-									CurrentPartType = EHoudiniPartType::Instancer;
-									CurrentInstancerType = EHoudiniInstancerType::ObjectInstancer;
-								}
-								
-							}
-							else if (CurrentHapiPartInfo.vertexCount <= 0 && CurrentHapiPartInfo.pointCount <= 0)
+							if (CurrentHapiGeoInfo.type == HAPI_GEOTYPE_CURVE)
 							{
-								// No points, no vertices, we're likely invalid
-								CurrentPartType = EHoudiniPartType::Invalid;
-								HOUDINI_LOG_MESSAGE(
-									TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a mesh with no points or vertices - skipping."),
-									CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId, *CurrentPartName);
+								// Closed curve will be seen as mesh
+								CurrentPartType = EHoudiniPartType::Curve;
 							}
-							else if (CurrentHapiPartInfo.vertexCount <= 0)
+							else
 							{
-								// This is not an instancer, we do not have vertices, but we have points
-								// Maybe this is a point cloud with attribute override instancing
-								if(FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
+								CurrentPartType = EHoudiniPartType::Mesh;
+								
+								if (CurrentHapiObjectInfo.isInstancer)
 								{
-									// Mark it as an instancer
-									CurrentPartType = EHoudiniPartType::Instancer;
-									// Instancer type is set by IsAttributeInstancer
-									//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
+									if (FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
+									{
+										// That part is actually an attribute instancer
+										CurrentPartType = EHoudiniPartType::Instancer;
+										// Instancer type is set by IsAttributeInstancer
+									}
+									else
+									{
+										// That part is actually an instancer
+										CurrentPartType = EHoudiniPartType::Instancer;
+										CurrentInstancerType = EHoudiniInstancerType::ObjectInstancer;
+									}
+									
 								}
-								else
+								else if (CurrentHapiPartInfo.vertexCount <= 0 && CurrentHapiPartInfo.pointCount <= 0)
 								{
-									// No vertices, not an instancer, just a point cloud, consider ourself as invalid
+									// No points, no vertices, we're likely invalid
 									CurrentPartType = EHoudiniPartType::Invalid;
 									HOUDINI_LOG_MESSAGE(
-										TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a point cloud mesh - skipping."),
+										TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a mesh with no points or vertices - skipping."),
 										CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId, *CurrentPartName);
 								}
+								else if (CurrentHapiPartInfo.vertexCount <= 0)
+								{
+									// This is not an instancer, we do not have vertices, but we have points
+									// Maybe this is a point cloud with attribute override instancing
+									if(FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
+									{
+										// Mark it as an instancer
+										CurrentPartType = EHoudiniPartType::Instancer;
+										// Instancer type is set by IsAttributeInstancer
+										//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
+									}
+									else
+									{
+										// No vertices, not an instancer, just a point cloud, consider ourself as invalid
+										CurrentPartType = EHoudiniPartType::Invalid;
+										HOUDINI_LOG_MESSAGE(
+											TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] is a point cloud mesh - skipping."),
+											CurrentHapiObjectInfo.nodeId, *CurrentObjectName, CurrentHapiGeoInfo.nodeId, PartId, *CurrentPartName);
+									}
+								}
 							}
 						}
-					}
-					break;
+						break;
 
-					case HAPI_PARTTYPE_CURVE:
-					{
-						// Make sure that this curve is not an an attribute instancer!
-						if (FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
-						{
-							// Mark the part as an instancer it as an instancer
-							CurrentPartType = EHoudiniPartType::Instancer;
-							// Instancer type is set by IsAttributeInstancer
-							//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
-						}
-						else
+						case HAPI_PARTTYPE_CURVE:
 						{
-							// The curve is a curve!
-							CurrentPartType = EHoudiniPartType::Curve;
+							// Make sure that this curve is not an an attribute instancer!
+							if (FHoudiniEngineUtils::IsAttributeInstancer(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentInstancerType))
+							{
+								// Mark the part as an instancer it as an instancer
+								CurrentPartType = EHoudiniPartType::Instancer;
+								// Instancer type is set by IsAttributeInstancer
+								//CurrentInstancerType = EHoudiniInstancerType::OldSchoolAttributeInstancer;
+							}
+							else
+							{
+								// The curve is a curve!
+								CurrentPartType = EHoudiniPartType::Curve;
+							}
 						}
-					}
-						break;
+							break;
 
-					case HAPI_PARTTYPE_INSTANCER:
-						// This is a packed primitive instancer
-						CurrentPartType = EHoudiniPartType::Instancer;
-						CurrentInstancerType = EHoudiniInstancerType::PackedPrimitive;
-						break;
+						case HAPI_PARTTYPE_INSTANCER:
+							// This is a packed primitive instancer
+							CurrentPartType = EHoudiniPartType::Instancer;
+							CurrentInstancerType = EHoudiniInstancerType::PackedPrimitive;
+							break;
 
-					case HAPI_PARTTYPE_VOLUME:
-						// Volume data, likely a Heightfield height / mask	
-						CurrentPartType = EHoudiniPartType::Volume;
-						break;
+						case HAPI_PARTTYPE_VOLUME:
+							// Volume data, likely a Heightfield height / mask	
+							CurrentPartType = EHoudiniPartType::Volume;
+							break;
 
-					default:
-						// Unsupported Part Type
-						break;
+						default:
+							// Unsupported Part Type
+							break;
+					}
 				}
 
 				// There are no vertices AND no points and this part is not a packed prim instancer
@@ -1340,12 +1322,16 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 					continue;
 
 				// Update the HGPO's node path
-				FHoudiniEngineUtils::HapiGetNodePath(currentHGPO, currentHGPO.NodePath);
+				if (CurrentPart.bHasCachedHGPO)
+					currentHGPO.NodePath = CachedHGPO.NodePath;
+				else if (!CurrentGeo.NodePath.IsEmpty())
+					currentHGPO.NodePath = FString::Printf(TEXT("%s_%d"), *CurrentGeo.NodePath, currentHGPO.PartId);
+				else
+					FHoudiniEngineUtils::HapiGetNodePath(currentHGPO, currentHGPO.NodePath);
 
-				// Try to get the custom part name from attribute
-				FString CustomPartName;
-				if (FHoudiniOutputTranslator::GetCustomPartNameFromAttribute(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CustomPartName))
-					currentHGPO.SetCustomPartName(CustomPartName);
+				// Use the custom part name from attribute if we have one
+				if (!CurrentPart.CustomPartName.IsEmpty())
+					currentHGPO.SetCustomPartName(CurrentPart.CustomPartName);
 				else
 					currentHGPO.PartName = CurrentPartName;
 
@@ -1357,7 +1343,14 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				TArray< FString > SplitGroupNames;
 				if (CurrentPartType == EHoudiniPartType::Mesh)
 				{
-					if (!CurrentHapiPartInfo.isInstanced && GeoGroupNames.Num() > 0)
+					if (CurrentPart.bHasCachedHGPO)
+					{
+						// Reuse the split groups of the previous cook
+						currentHGPO.SplitGroups = CachedHGPO.SplitGroups;
+						if (!CurrentHapiPartInfo.isInstanced && GeoGroupNames.Num() <= 0)
+							GeoGroupNames = currentHGPO.SplitGroups;
+					}
+					else if (!CurrentHapiPartInfo.isInstanced && GeoGroupNames.Num() > 0)
 					{
 						// We are not instanced and already have extracted the geo's group names
 						// We can simply reuse the Geo group names / socket groups
@@ -1411,7 +1404,14 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				// 
 				// Extract the volume's name, and see if a tile attribute is present
 				FHoudiniVolumeInfo CurrentVolumeInfo;
-				if (CurrentPartType == EHoudiniPartType::Volume)
+				if (CurrentPartType == EHoudiniPartType::Volume && CurrentPart.bHasCachedHGPO)
+				{
+					// Reuse the volume infos of the previous cook
+					CurrentVolumeInfo = CachedHGPO.VolumeInfo;
+					currentHGPO.VolumeName = CachedHGPO.VolumeName;
+					currentHGPO.VolumeTileIndex = CachedHGPO.VolumeTileIndex;
+				}
+				else if (CurrentPartType == EHoudiniPartType::Volume)
 				{
 					// Get this volume's info
 					HAPI_VolumeInfo CurrentHapiVolumeInfo;
@@ -1464,7 +1464,11 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				// !!! Only call GetCurveInfo if the PartType is Curve
 				// !!! Closed curves are actually Meshes, and calling GetCurveInfo on a Mesh will crash HAPI!
 				FHoudiniCurveInfo CurrentCurveInfo;
-				if (CurrentPartType == EHoudiniPartType::Curve && CurrentPartInfo.Type == EHoudiniPartType::Curve)
+				if (CurrentPartType == EHoudiniPartType::Curve && CurrentPart.bHasCachedHGPO)
+				{
+					CurrentCurveInfo = CachedHGPO.CurveInfo;
+				}
+				else if (CurrentPartType == EHoudiniPartType::Curve && CurrentPartInfo.Type == EHoudiniPartType::Curve)
 				{
 					HAPI_CurveInfo CurrentHapiCurveInfo;
 					FHoudiniApi::CurveInfo_Init(&CurrentHapiCurveInfo);
@@ -1485,42 +1489,34 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				// See if a custom bake folder override for the mesh was assigned via the "unreal_bake_folder" attribute
 				//TArray<FString> BakeFolderOverrides;
 
-				// Extract socket points
-				FHoudiniEngineUtils::AddMeshSocketsToArray_DetailAttribute(
-					currentHGPO.GeoId, currentHGPO.PartId, AllSockets, CurrentHapiPartInfo.isInstanced);
-				FHoudiniEngineUtils::AddMeshSocketsToArray_Group(
-					currentHGPO.GeoId, currentHGPO.PartId, AllSockets, CurrentHapiPartInfo.isInstanced);
-
 				// See if we have an existing output that matches this HGPO or if we need to create a new one
 				bool IsFoundOutputValid = false;
-				UHoudiniOutput ** FoundHoudiniOutput = nullptr;	
+				UHoudiniOutput * FoundHoudiniOutput = nullptr;
 				// We handle volumes differently than other outputs types, as a single HF output has multiple HGPOs
 				if (currentHGPO.Type != EHoudiniPartType::Volume)
 				{
 					// Look in the previous output if we have a match
-					FoundHoudiniOutput = InOldOutputs.FindByPredicate(
-						[currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HasHoudiniGeoPartObject(currentHGPO) : false; });
+					FoundHoudiniOutput = OutputLookup.FindOldOutput(currentHGPO);
 
-					if (FoundHoudiniOutput && *FoundHoudiniOutput && !(*FoundHoudiniOutput)->IsPendingKill())
+					if (FoundHoudiniOutput && !FoundHoudiniOutput->IsPendingKill())
 						IsFoundOutputValid = true;
 
 				}
-				else
+				else if (!currentHGPO.VolumeName.IsEmpty())
 				{
 					// Look in the previous outputs if we have a match
-					FoundHoudiniOutput = InOldOutputs.FindByPredicate(
-						[currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HeightfieldMatch(currentHGPO, true) : false; });
+					FoundHoudiniOutput = OutputLookup.FindOldHeightfield(currentHGPO);
 					
-					if (FoundHoudiniOutput && *FoundHoudiniOutput && !(*FoundHoudiniOutput)->IsPendingKill())
+					if (FoundHoudiniOutput && !FoundHoudiniOutput->IsPendingKill())
 						IsFoundOutputValid = true;
 
 					// If we dont have a match in the old maps, also look in the newly created outputs
 					if (!IsFoundOutputValid)
 					{
-						FoundHoudiniOutput = OutNewOutputs.FindByPredicate(
-							[currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HeightfieldMatch(currentHGPO, false) : false; });
+						const int32 FoundOutputIdx = OutputLookup.FindNewHeightfield(OutNewOutputs, currentHGPO);
+						FoundHoudiniOutput = OutNewOutputs.IsValidIndex(FoundOutputIdx) ? OutNewOutputs[FoundOutputIdx] : nullptr;
 
-						if (FoundHoudiniOutput && *FoundHoudiniOutput && !(*FoundHoudiniOutput)->IsPendingKill())
+						if (FoundHoudiniOutput && !FoundHoudiniOutput->IsPendingKill())
 							IsFoundOutputValid = true;
 					}
 				}
@@ -1529,10 +1525,11 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				if (IsFoundOutputValid)
 				{
 					// We can reuse the existing output
-					HoudiniOutput = *FoundHoudiniOutput;
+					HoudiniOutput = FoundHoudiniOutput;
 					HoudiniOutput->SetIsUpdating(true);
 					// Transfer this output from the old array to the new one
-					InOldOutputs.Remove(HoudiniOutput);
+					// (they are removed from the old array after the loop)
+					OutputLookup.ClaimOldOutput(HoudiniOutput);
 				}
 				else
 				{
@@ -1569,11 +1566,21 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				// Add the HGPO to the output
 				HoudiniOutput->AddNewHGPO(currentHGPO);
 				// Add this output object to the new ouput array
-				OutNewOutputs.AddUnique(HoudiniOutput);
+				const int32 NewOutputIdx = OutputLookup.AddNewOutput(OutNewOutputs, HoudiniOutput);
+				OutputLookup.IndexNewHGPO(NewOutputIdx, currentHGPO);
 			}
 		}
 	}
 
+	// Remove the outputs we've reused from the old outputs
+	if (OutputLookup.ClaimedOldOutputs.Num() > 0)
+	{
+		InOldOutputs.RemoveAll([&OutputLookup](UHoudiniOutput* Output)
+		{
+			return OutputLookup.ClaimedOldOutputs.Contains(Output);
+		});
+	}
+
 	// Update the output/HGPO associations from the map
 	// Clear the old HGPO since we don't need them anymore
 	for (auto& CurrentOuput : OutNewOutputs)
@@ -1590,20 +1597,18 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	{
 		for (auto& currentVolumeHGPO : UnassignedVolumeParts)
 		{
-			UHoudiniOutput ** FoundHoudiniOutput = OutNewOutputs.FindByPredicate(
-				[currentVolumeHGPO](UHoudiniOutput* Output) 
-				{
-					return Output ? Output->HeightfieldMatch(currentVolumeHGPO, false) : false;
-				});
+			const int32 FoundOutputIdx = OutputLookup.FindNewHeightfield(OutNewOutputs, currentVolumeHGPO);
+			UHoudiniOutput * FoundHoudiniOutput = OutNewOutputs.IsValidIndex(FoundOutputIdx) ? OutNewOutputs[FoundOutputIdx] : nullptr;
 
-			if (!FoundHoudiniOutput || !(*FoundHoudiniOutput) || (*FoundHoudiniOutput)->IsPendingKill())
+			if (!FoundHoudiniOutput || FoundHoudiniOutput->IsPendingKill())
 			{
 				// Skip - consider this volume as invalid
 				continue;
 			}
 
 			// Add this HGPO to the output
-			(*FoundHoudiniOutput)->AddNewHGPO(currentVolumeHGPO);
+			FoundHoudiniOutput->AddNewHGPO(currentVolumeHGPO);
+			OutputLookup.IndexNewHGPO(FoundOutputIdx, currentVolumeHGPO);
 		} 
 	}
 
@@ -1617,9 +1622,403 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	return true;
 }
 
+bool
+FHoudiniOutputTranslator::BuildTopologySnapshot(
+	const HAPI_NodeId& AssetId,
+	const TArray<UHoudiniOutput*>& InOldOutputs,
+	const bool& InOutputTemplatedGeos,
+	FHoudiniTopologySnapshot& OutSnapshot)
+{
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniOutputTranslator::BuildTopologySnapshot"), AssetId, -1);
+
+	OutSnapshot.AssetName = FString();
+	OutSnapshot.Objects.Empty();
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	// Get the AssetInfo
+	HAPI_AssetInfo AssetInfo;
+	FHoudiniApi::AssetInfo_Init(&AssetInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAssetInfo(Session, AssetId, &AssetInfo), false);
+
+	// Retrieve information about each object contained within our asset.
+	TArray<HAPI_ObjectInfo> ObjectInfos;
+	if (!FHoudiniEngineUtils::HapiGetObjectInfos(AssetId, ObjectInfos))
+		return false;
+
+	// Retrieve transforms for each object in this asset.
+	TArray<HAPI_Transform> ObjectTransforms;
+	if (!FHoudiniEngineUtils::HapiGetObjectTransforms(AssetId, ObjectTransforms))
+		return false;
+
+	// Index the HGPOs of the previous cook by their object/geo/part IDs
+	TMap<FIntVector, const FHoudiniGeoPartObject*> PreviousHGPOs;
+	for (const UHoudiniOutput* CurOutput : InOldOutputs)
+	{
+		if (!IsValid(CurOutput))
+			continue;
+
+		for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
+		{
+			// Loaded HGPOs don't come from a cook of this node
+			if (CurHGPO.bLoaded || CurHGPO.AssetId != AssetId)
+				continue;
+
+			PreviousHGPOs.Add(FIntVector(CurHGPO.ObjectId, CurHGPO.GeoId, CurHGPO.PartId), &CurHGPO);
+		}
+	}
+
+	// Only fetches the handle of the custom part name, the string itself is resolved with the other names
+	auto GetCustomPartNameHandle = [Session](const HAPI_NodeId& InGeoId, const HAPI_PartId& InPartId, FHoudiniPartSnapshot& OutPart)
+	{
+		// Look for the v2 attribute (unreal_output_name) first,
+		// then for the legacy v1 attribute (unreal_generated_mesh_name)
+		const char* CustomNameAttributes[] = { HAPI_UNREAL_ATTRIB_CUSTOM_OUTPUT_NAME_V2, HAPI_UNREAL_ATTRIB_CUSTOM_OUTPUT_NAME_V1 };
+		for (const char* AttributeName : CustomNameAttributes)
+		{
+			HAPI_AttributeInfo AttributeInfo;
+			FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+			for (int32 AttrOwner = 0; AttrOwner < HAPI_ATTROWNER_MAX; ++AttrOwner)
+			{
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+					Session, InGeoId, InPartId, AttributeName, (HAPI_AttributeOwner)AttrOwner, &AttributeInfo))
+					break;
+
+				if (AttributeInfo.exists)
+					break;
+			}
+
+			if (!AttributeInfo.exists)
+				continue;
+
+			if (AttributeInfo.storage == HAPI_STORAGETYPE_STRING)
+			{
+				// We only use the first value
+				TArray<HAPI_StringHandle> StringHandles;
+				StringHandles.Init(-1, FMath::Max(AttributeInfo.tupleSize, 1));
+				if (AttributeInfo.count > 0 && HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeStringData(
+					Session, InGeoId, InPartId, AttributeName, &AttributeInfo, StringHandles.GetData(), 0, 1))
+				{
+					OutPart.CustomPartNameSH = StringHandles[0];
+				}
+			}
+			else
+			{
+				// The attribute needs to be converted to a string
+				FHoudiniOutputTranslator::GetCustomPartNameFromAttribute(InGeoId, InPartId, OutPart.CustomPartName);
+			}
+
+			return;
+		}
+	};
+
+	OutSnapshot.Objects.SetNum(ObjectInfos.Num());
+	for (int32 ObjectIdx = 0; ObjectIdx < ObjectInfos.Num(); ++ObjectIdx)
+	{
+		const HAPI_ObjectInfo& CurrentHapiObjectInfo = ObjectInfos[ObjectIdx];
+
+		FHoudiniObjectSnapshot& CurrentObject = OutSnapshot.Objects[ObjectIdx];
+		CurrentObject.ObjectInfo = CurrentHapiObjectInfo;
+		CacheObjectInfo(CurrentHapiObjectInfo, CurrentObject.CachedObjectInfo, false);
+
+		if (ObjectTransforms.IsValidIndex(ObjectIdx))
+			FHoudiniEngineUtils::TranslateHapiTransform(ObjectTransforms[ObjectIdx], CurrentObject.Transform);
+		else
+			CurrentObject.Transform = FTransform::Identity;
+
+		// Build an array of the geos we'll need to process
+		// In most case, it will only be the display geo, 
+		// but we may also want to process editable geos as well
+		TArray<HAPI_GeoInfo> GeoInfos;
+
+		// Get the Display Geo's info
+		HAPI_GeoInfo DisplayHapiGeoInfo;
+		FHoudiniApi::GeoInfo_Init(&DisplayHapiGeoInfo);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetDisplayGeoInfo(
+			Session, CurrentHapiObjectInfo.nodeId, &DisplayHapiGeoInfo))
+		{
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Creating Static Meshes: Object [%d] unable to retrieve GeoInfo, - skipping."),
+				CurrentHapiObjectInfo.nodeId);
+		}
+		else
+		{
+			// Add the display geo info to the array
+			GeoInfos.Add(DisplayHapiGeoInfo);
+		}
+
+		// Handle the editable nodes for this geo
+		// Start by getting the number of editable nodes
+		int32 EditableNodeCount = 0;
+		HOUDINI_CHECK_ERROR(FHoudiniApi::ComposeChildNodeList(
+			Session, CurrentHapiObjectInfo.nodeId,
+			HAPI_NODETYPE_SOP, HAPI_NODEFLAGS_EDITABLE,
+			true, &EditableNodeCount));
+
+		if (EditableNodeCount > 0)
+		{
+			TArray<HAPI_NodeId> EditableNodeIds;
+			EditableNodeIds.SetNumUninitialized(EditableNodeCount);
+			HOUDINI_CHECK_ERROR(FHoudiniApi::GetComposedChildNodeList(
+				Session, CurrentHapiObjectInfo.nodeId,
+				EditableNodeIds.GetData(), EditableNodeCount));
+
+			for (int32 nEditable = 0; nEditable < EditableNodeCount; nEditable++)
+			{
+				HAPI_GeoInfo CurrentEditableGeoInfo;
+				FHoudiniApi::GeoInfo_Init(&CurrentEditableGeoInfo);
+				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
+					Session, EditableNodeIds[nEditable], &CurrentEditableGeoInfo));
+
+				// Do not process the main display geo twice!
+				if (CurrentEditableGeoInfo.isDisplayGeo)
+					continue;
+
+				// We only handle editable curves for now
+				if (CurrentEditableGeoInfo.type != HAPI_GEOTYPE_CURVE)
+					continue;
+
+				// Add this geo to the geo info array
+				GeoInfos.Add(CurrentEditableGeoInfo);
+			}
+		}
+
+		// Handle the templated nodes if desired
+		if (InOutputTemplatedGeos)
+		{
+			// Start by getting the number of templated nodes
+			int32 TemplatedNodeCount = 0;
+			HOUDINI_CHECK_ERROR(FHoudiniApi::ComposeChildNodeList(
+				Session, CurrentHapiObjectInfo.nodeId,
+				HAPI_NODETYPE_SOP, HAPI_NODEFLAGS_TEMPLATED,
+				true, &TemplatedNodeCount));
+
+			if (TemplatedNodeCount > 0)
+			{
+				TArray<HAPI_NodeId> TemplatedNodeIds;
+				TemplatedNodeIds.SetNumUninitialized(TemplatedNodeCount);
+				HOUDINI_CHECK_ERROR(FHoudiniApi::GetComposedChildNodeList(
+					Session, CurrentHapiObjectInfo.nodeId,
+					TemplatedNodeIds.GetData(), TemplatedNodeCount));
+
+				for (int32 nTemplated = 0; nTemplated < TemplatedNodeCount; nTemplated++)
+				{
+					HAPI_GeoInfo CurrentTemplatedGeoInfo;
+					FHoudiniApi::GeoInfo_Init(&CurrentTemplatedGeoInfo);
+					HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
+						Session, TemplatedNodeIds[nTemplated], &CurrentTemplatedGeoInfo));
+
+					// Do not process the main display geo twice!
+					if (CurrentTemplatedGeoInfo.isDisplayGeo)
+						continue;
+
+					// We don't want all the nested template node IDs,
+					// as our HDA could potentially be using other HDAs with nested template flags
+					// Make sure the parent of the templated node is either the HDA, the current OBJ or the Display SOP
+					HAPI_NodeId ParentId = FHoudiniEngineUtils::HapiGetParentNodeId(CurrentTemplatedGeoInfo.nodeId);
+					if (ParentId != CurrentHapiObjectInfo.nodeId
+						&& ParentId != DisplayHapiGeoInfo.nodeId
+						&& ParentId != AssetId)
+					{
+						continue;
+					}
+
+					// Add this geo to the geo info array
+					GeoInfos.Add(CurrentTemplatedGeoInfo);
+				}
+			}
+		}
+
+		CurrentObject.Geos.SetNum(GeoInfos.Num());
+		for (int32 GeoIdx = 0; GeoIdx < GeoInfos.Num(); GeoIdx++)
+		{
+			HAPI_GeoInfo& CurrentHapiGeoInfo = GeoInfos[GeoIdx];
+
+			// Cook editable/templated nodes to get their parts.
+			if ((CurrentHapiGeoInfo.isEditable && CurrentHapiGeoInfo.partCount <= 0)
+				|| (CurrentHapiGeoInfo.isTemplated && CurrentHapiGeoInfo.partCount <= 0))
+			{
+				FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
+
+				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
+					Session, CurrentHapiGeoInfo.nodeId, &CurrentHapiGeoInfo));
+			}
+
+			FHoudiniGeoSnapshot& CurrentGeo = CurrentObject.Geos[GeoIdx];
+			CacheGeoInfo(CurrentHapiGeoInfo, CurrentGeo.CachedGeoInfo, false);
+
+			// If the geo is templated, cook it manually before getting its parts
+			const bool bCookTemplatedGeo = CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos;
+			if (bCookTemplatedGeo && CurrentGeo.CachedGeoInfo.PartCount > 0)
+				FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
+
+			// Parts of geos that haven't changed since the previous cook can reuse their previous HGPO
+			const bool bCanReuseHGPOs = !CurrentHapiGeoInfo.hasGeoChanged && !CurrentHapiGeoInfo.isTemplated;
+
+			bool bNeedsNodePath = false;
+			CurrentGeo.Parts.Reserve(CurrentGeo.CachedGeoInfo.PartCount);
+			for (int32 PartId = 0; PartId < CurrentGeo.CachedGeoInfo.PartCount; ++PartId)
+			{
+				FHoudiniPartSnapshot CurrentPart;
+				FHoudiniApi::PartInfo_Init(&CurrentPart.PartInfo);
+
+				const FHoudiniGeoPartObject* const* PreviousHGPO = bCanReuseHGPOs
+					? PreviousHGPOs.Find(FIntVector(CurrentHapiObjectInfo.nodeId, CurrentHapiGeoInfo.nodeId, PartId))
+					: nullptr;
+
+				if (PreviousHGPO && (*PreviousHGPO)->ObjectInfo.bIsInstancer == (bool)CurrentHapiObjectInfo.isInstancer)
+				{
+					const FHoudiniGeoPartObject& CachedHGPO = **PreviousHGPO;
+					CurrentPart.bHasCachedHGPO = true;
+					CurrentPart.CachedHGPO = CachedHGPO;
+					CurrentPart.CachedPartInfo = CachedHGPO.PartInfo;
+					CurrentPart.CachedPartInfo.bHasChanged = false;
+					if (CachedHGPO.bHasCustomPartName)
+						CurrentPart.CustomPartName = CachedHGPO.PartName;
+
+					// Rebuild the part info from the cached one instead of fetching it again
+					// The part's type will be taken from the cached HGPO
+					HAPI_PartInfo& CurrentHapiPartInfo = CurrentPart.PartInfo;
+					CurrentHapiPartInfo.id = CurrentPart.CachedPartInfo.PartId;
+					CurrentHapiPartInfo.faceCount = CurrentPart.CachedPartInfo.FaceCount;
+					CurrentHapiPartInfo.vertexCount = CurrentPart.CachedPartInfo.VertexCount;
+					CurrentHapiPartInfo.pointCount = CurrentPart.CachedPartInfo.PointCount;
+					CurrentHapiPartInfo.attributeCounts[HAPI_ATTROWNER_POINT] = CurrentPart.CachedPartInfo.PointAttributeCounts;
+					CurrentHapiPartInfo.attributeCounts[HAPI_ATTROWNER_VERTEX] = CurrentPart.CachedPartInfo.VertexAttributeCounts;
+					CurrentHapiPartInfo.attributeCounts[HAPI_ATTROWNER_PRIM] = CurrentPart.CachedPartInfo.PrimitiveAttributeCounts;
+					CurrentHapiPartInfo.attributeCounts[HAPI_ATTROWNER_DETAIL] = CurrentPart.CachedPartInfo.DetailAttributeCounts;
+					CurrentHapiPartInfo.isInstanced = CurrentPart.CachedPartInfo.bIsInstanced;
+					CurrentHapiPartInfo.instancedPartCount = CurrentPart.CachedPartInfo.InstancedPartCount;
+					CurrentHapiPartInfo.instanceCount = CurrentPart.CachedPartInfo.InstanceCount;
+					CurrentHapiPartInfo.hasChanged = false;
+				}
+				else
+				{
+					bool bPartInfoFailed = false;
+					if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
+						Session, CurrentHapiGeoInfo.nodeId, PartId, &CurrentPart.PartInfo))
+					{
+						bPartInfoFailed = true;
+
+						// If the geo is templated, attempt to cook it manually
+						if (bCookTemplatedGeo)
+						{
+							FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
+
+							HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
+								Session, CurrentHapiGeoInfo.nodeId, &CurrentHapiGeoInfo));
+
+							if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetPartInfo(
+								Session, CurrentHapiGeoInfo.nodeId, PartId, &CurrentPart.PartInfo))
+							{
+								// We managed to get the templated part infos after cooking
+								bPartInfoFailed = false;
+							}
+						}
+					}
+
+					if (bPartInfoFailed)
+					{
+						// Error retrieving part info.
+						HOUDINI_LOG_MESSAGE(
+							TEXT("Creating Static Meshes: Object [%d], Geo [%d], Part [%d] unable to retrieve PartInfo - skipping."),
+							CurrentHapiObjectInfo.nodeId, CurrentHapiGeoInfo.nodeId, PartId);
+						continue;
+					}
+
+					// Convert/cache the part info, its name will be resolved with the others
+					CachePartInfo(CurrentPart.PartInfo, CurrentPart.CachedPartInfo, false);
+
+					if (CurrentPart.CachedPartInfo.Type != EHoudiniPartType::Invalid)
+					{
+						GetCustomPartNameHandle(CurrentHapiGeoInfo.nodeId, CurrentPart.PartInfo.id, CurrentPart);
+						bNeedsNodePath = true;
+					}
+				}
+
+				CurrentGeo.Parts.Add(MoveTemp(CurrentPart));
+			}
+
+			CurrentGeo.GeoInfo = CurrentHapiGeoInfo;
+
+			// Get the geo's node path handle, the parts' node paths will be built from it
+			if (bNeedsNodePath)
+			{
+				if (CurrentHapiGeoInfo.nodeId == AssetId)
+				{
+					// This is a SOP asset, just use the asset name in this case
+					HAPI_NodeInfo AssetNodeInfo;
+					FHoudiniApi::NodeInfo_Init(&AssetNodeInfo);
+					if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodeInfo(Session, AssetInfo.nodeId, &AssetNodeInfo))
+						CurrentGeo.NodePathSH = AssetNodeInfo.nameSH;
+				}
+				else
+				{
+					// This is an OBJ asset, use the path to this geo relative to the asset
+					HAPI_StringHandle NodePathSH = -1;
+					if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetNodePath(Session, CurrentHapiGeoInfo.nodeId, AssetId, &NodePathSH))
+						CurrentGeo.NodePathSH = NodePathSH;
+				}
+			}
+		}
+	}
+
+	// Now resolve all the names we need with a single batched query.
+	// The snapshot is walked twice in the same order: once to gather the handles, once to assign the strings.
+	TArray<int32> StringHandles;
+	StringHandles.Add(AssetInfo.nameSH);
+	for (const FHoudiniObjectSnapshot& CurrentObject : OutSnapshot.Objects)
+	{
+		StringHandles.Add(CurrentObject.ObjectInfo.nameSH);
+		for (const FHoudiniGeoSnapshot& CurrentGeo : CurrentObject.Geos)
+		{
+			StringHandles.Add(CurrentGeo.GeoInfo.nameSH);
+			StringHandles.Add(CurrentGeo.NodePathSH);
+			for (const FHoudiniPartSnapshot& CurrentPart : CurrentGeo.Parts)
+			{
+				if (CurrentPart.bHasCachedHGPO)
+					continue;
+
+				StringHandles.Add(CurrentPart.PartInfo.nameSH);
+				StringHandles.Add(CurrentPart.CustomPartNameSH);
+			}
+		}
+	}
+
+	TArray<FString> Strings;
+	FHoudiniEngineString::SHArrayToFStringArray_Batch(StringHandles, Strings);
+
+	int32 StringIdx = 0;
+	OutSnapshot.AssetName = Strings[StringIdx++];
+	for (FHoudiniObjectSnapshot& CurrentObject : OutSnapshot.Objects)
+	{
+		CurrentObject.CachedObjectInfo.Name = Strings[StringIdx++];
+		for (FHoudiniGeoSnapshot& CurrentGeo : CurrentObject.Geos)
+		{
+			CurrentGeo.CachedGeoInfo.Name = Strings[StringIdx++];
+			CurrentGeo.NodePath = Strings[StringIdx++];
+			for (FHoudiniPartSnapshot& CurrentPart : CurrentGeo.Parts)
+			{
+				if (CurrentPart.bHasCachedHGPO)
+					continue;
+
+				CurrentPart.CachedPartInfo.Name = Strings[StringIdx++];
+
+				const FString& CustomPartName = Strings[StringIdx++];
+				if (!CustomPartName.IsEmpty())
+					CurrentPart.CustomPartName = CustomPartName;
+			}
+		}
+	}
+
+	return true;
+}
+
 bool
 FHoudiniOutputTranslator::UpdateChangedOutputs(UHoudiniAssetComponent* HAC)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniOutputTranslator::UpdateChangedOutputs"), IsValid(HAC) ? HAC->GetAssetId() : -1, -1);
+
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
@@ -1692,10 +2091,13 @@ FHoudiniOutputTranslator::UpdateChangedOutputs(UHoudiniAssetComponent* HAC)
 }
 
 void
-FHoudiniOutputTranslator::CacheObjectInfo(const HAPI_ObjectInfo& InObjInfo, FHoudiniObjectInfo& OutObjInfoCache)
+FHoudiniOutputTranslator::CacheObjectInfo(const HAPI_ObjectInfo& InObjInfo, FHoudiniObjectInfo& OutObjInfoCache, const bool& bInResolveName)
 {
-	FHoudiniEngineString hapiSTR(InObjInfo.nameSH);
-	hapiSTR.ToFString(OutObjInfoCache.Name);
+	if (bInResolveName)
+	{
+		FHoudiniEngineString hapiSTR(InObjInfo.nameSH);
+		hapiSTR.ToFString(OutObjInfoCache.Name);
+	}
 	//OutObjInfoCache.Name = InObjInfo.nameSH;
 
 	OutObjInfoCache.NodeId = InObjInfo.nodeId;
@@ -1742,12 +2144,15 @@ FHoudiniOutputTranslator::ConvertHapiGeoType(const HAPI_GeoType& InType)
 }
 
 void
-FHoudiniOutputTranslator::CacheGeoInfo(const HAPI_GeoInfo& InGeoInfo, FHoudiniGeoInfo& OutGeoInfoCache)
+FHoudiniOutputTranslator::CacheGeoInfo(const HAPI_GeoInfo& InGeoInfo, FHoudiniGeoInfo& OutGeoInfoCache, const bool& bInResolveName)
 {
 	OutGeoInfoCache.Type = ConvertHapiGeoType(InGeoInfo.type);
 
-	FHoudiniEngineString hapiSTR(InGeoInfo.nameSH);
-	hapiSTR.ToFString(OutGeoInfoCache.Name);
+	if (bInResolveName)
+	{
+		FHoudiniEngineString hapiSTR(InGeoInfo.nameSH);
+		hapiSTR.ToFString(OutGeoInfoCache.Name);
+	}
 
 	OutGeoInfoCache.NodeId = InGeoInfo.nodeId;
 
@@ -1796,12 +2201,15 @@ FHoudiniOutputTranslator::ConvertHapiPartType(const HAPI_PartType& InType)
 }
 
 void
-FHoudiniOutputTranslator::CachePartInfo(const HAPI_PartInfo& InPartInfo, FHoudiniPartInfo& OutPartInfoCache)
+FHoudiniOutputTranslator::CachePartInfo(const HAPI_PartInfo& InPartInfo, FHoudiniPartInfo& OutPartInfoCache, const bool& bInResolveName)
 {
 	OutPartInfoCache.PartId = InPartInfo.id;
 	
-	FHoudiniEngineString hapiSTR(InPartInfo.nameSH);
-	hapiSTR.ToFString(OutPartInfoCache.Name);
+	if (bInResolveName)
+	{
+		FHoudiniEngineString hapiSTR(InPartInfo.nameSH);
+		hapiSTR.ToFString(OutPartInfoCache.Name);
+	}
 
 	OutPartInfoCache.Type = ConvertHapiPartType(InPartInfo.type);
 
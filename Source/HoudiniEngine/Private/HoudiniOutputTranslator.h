@@ -30,6 +30,8 @@
 
 #include "CoreMinimal.h"
 
+#include "HoudiniGeoPartObject.h"
+
 class UHoudiniOutput;
 class UHoudiniAssetComponent;
 
@@ -44,6 +46,54 @@ enum class EHoudiniGeoType : uint8;
 enum class EHoudiniPartType : uint8;
 enum class EHoudiniCurveType : int8;
 
+// Snapshot of a part's infos, as fetched by FHoudiniOutputTranslator::BuildTopologySnapshot()
+struct FHoudiniPartSnapshot
+{
+	HAPI_PartInfo PartInfo;
+	FHoudiniPartInfo CachedPartInfo;
+
+	// Value of the custom part name attribute, if any
+	FString CustomPartName;
+	HAPI_StringHandle CustomPartNameSH = -1;
+
+	// HGPO built for this part by the previous cook, reused when the part's geo hasn't changed
+	bool bHasCachedHGPO = false;
+	FHoudiniGeoPartObject CachedHGPO;
+};
+
+// Snapshot of a geo's infos and of all its parts
+struct FHoudiniGeoSnapshot
+{
+	HAPI_GeoInfo GeoInfo;
+	FHoudiniGeoInfo CachedGeoInfo;
+
+	// Path of the geo node relative to the asset, or the asset name for SOP assets
+	FString NodePath;
+	HAPI_StringHandle NodePathSH = -1;
+
+	TArray<FHoudiniPartSnapshot> Parts;
+};
+
+// Snapshot of an object's infos and of all the geos we want to output
+struct FHoudiniObjectSnapshot
+{
+	HAPI_ObjectInfo ObjectInfo;
+	FHoudiniObjectInfo CachedObjectInfo;
+
+	FTransform Transform;
+
+	TArray<FHoudiniGeoSnapshot> Geos;
+};
+
+// Object / Geo / Part topology of an asset, fetched in one pass so the outputs can be built
+// without querying HAPI for each object, geo and part
+struct FHoudiniTopologySnapshot
+{
+	FString AssetName;
+
+	TArray<FHoudiniObjectSnapshot> Objects;
+};
+
 struct HOUDINIENGINE_API FHoudiniOutputTranslator
 {
 	// 
@@ -70,6 +120,14 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 		TArray<UHoudiniOutput*>& OutNewOutputs,
 		const bool& InOutputTemplatedGeos);
 
+	// Fetches the object, geo and part infos of the asset and resolves all their strings in a single batch.
+	// Parts whose geo hasn't changed since the previous cook reuse the HGPOs found in the old outputs.
+	static bool BuildTopologySnapshot(
+		const HAPI_NodeId& AssetId,
+		const TArray<UHoudiniOutput*>& InOldOutputs,
+		const bool& InOutputTemplatedGeos,
+		FHoudiniTopologySnapshot& OutSnapshot);
+
 	static bool UpdateChangedOutputs(
 		UHoudiniAssetComponent* HAC);
 
@@ -79,9 +137,10 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 	static EHoudiniCurveType ConvertHapiCurveType(const HAPI_CurveType& InType);
 
 	// Helper functions used to cache HAPI infos
-	static void CacheObjectInfo(const HAPI_ObjectInfo& InObjInfo, FHoudiniObjectInfo& OutObjInfoCache);
-	static void CacheGeoInfo(const HAPI_GeoInfo& InGeoInfo, FHoudiniGeoInfo& OutGeoInfoCache);
-	static void CachePartInfo(const HAPI_PartInfo& InPartInfo, FHoudiniPartInfo& OutPartInfoCache);
+	// bInResolveName can be set to false when the names are resolved separately (see BuildTopologySnapshot)
+	static void CacheObjectInfo(const HAPI_ObjectInfo& InObjInfo, FHoudiniObjectInfo& OutObjInfoCache, const bool& bInResolveName = true);
+	static void CacheGeoInfo(const HAPI_GeoInfo& InGeoInfo, FHoudiniGeoInfo& OutGeoInfoCache, const bool& bInResolveName = true);
+	static void CachePartInfo(const HAPI_PartInfo& InPartInfo, FHoudiniPartInfo& OutPartInfoCache, const bool& bInResolveName = true);
 	static void CacheVolumeInfo(const HAPI_VolumeInfo& InVolumeInfo, FHoudiniVolumeInfo& OutVolumeInfoCache);
 	static void CacheCurveInfo(const HAPI_CurveInfo& InCurveInfo, FHoudiniCurveInfo& OutCurveInfoCache);
 
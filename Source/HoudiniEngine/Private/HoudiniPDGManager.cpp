@@ -29,6 +29,12 @@
 #include "Modules/ModuleManager.h"
 #include "MessageEndpointBuilder.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+	#include "EditorViewportClient.h"
+#endif
 
 #include "HoudiniApi.h"
 #include "HoudiniEngine.h"
@@ -51,6 +57,7 @@ HOUDINI_PDG_DEFINE_LOG_CATEGORY();
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+
 FHoudiniPDGManager::FHoudiniPDGManager()
 {
 }
@@ -439,6 +446,8 @@ FHoudiniPDGManager::PopulateTOPNetworks(UHoudiniPDGAssetLink* PDGAssetLink, bool
 	}
 	//PDGAssetLink->ClearAllTOPData();
 	PDGAssetLink->AllTOPNetworks = AllTOPNetworks;
+	// Invalidates the node lookup entries of this asset link in the manager
+	PDGAssetLink->NotifyTOPNodesChanged();
 
 	return (AllTOPNetworks.Num() > 0);
 }
@@ -544,6 +553,8 @@ FHoudiniPDGManager::PopulateTOPNodes(
 	}
 
 	InTOPNetwork->AllTOPNodes = AllTOPNodes;
+	// Link the nodes to their parents and rebuild the parents' aggregated work item tallies
+	InTOPNetwork->UpdateTOPNodeHierarchy();
 
 	return (TOPNodeCount > 0);
 }
@@ -761,6 +772,17 @@ FHoudiniPDGManager::Update()
 
 	// Prcoess any workitem result if we have any
 	ProcessWorkItemResults();
+
+	// Notify the UI of the TOP nodes that changed during this update
+	// (the output visibility changes are applied by each asset link's own ticker)
+	for (TWeakObjectPtr<UHoudiniPDGAssetLink>& CurAssetLinkPtr : PDGAssetLinks)
+	{
+		UHoudiniPDGAssetLink* const CurAssetLink = CurAssetLinkPtr.Get();
+		if (!IsValid(CurAssetLink))
+			continue;
+
+		CurAssetLink->BroadcastTOPNodeChanges();
+	}
 }
 
 // Query all the PDG graph context in the current Houdini Engine session.
@@ -1052,6 +1074,8 @@ FHoudiniPDGManager::ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID,
 			break;
 	}
 
+	PDGAssetLink->MarkTOPNodeChanged(TOPNode);
+
 	if (bUpdatePDGNodeState)
 	{
 		// Work item events
@@ -1127,6 +1151,23 @@ FHoudiniPDGManager::GetTOPAssetLinkAndNode(
 	// Returns the PDGAssetLink and FTOPNode data associated with this TOP node ID
 	OutAssetLink = nullptr;
 	OutTOPNode = nullptr;
+
+	if (const FTOPNodeLookupEntry* Entry = TOPNodeLookup.Find(InNodeID))
+	{
+		UHoudiniPDGAssetLink* AssetLink = Entry->AssetLink.Get();
+		UTOPNode* TOPNode = Entry->TOPNode.Get();
+		if (IsValid(AssetLink) && IsValid(TOPNode) && TOPNode->NodeId == InNodeID
+			&& AssetLink->GetTOPNodesVersion() == Entry->TOPNodesVersion)
+		{
+			OutAssetLink = AssetLink;
+			OutTOPNode = TOPNode;
+			return true;
+		}
+
+		TOPNodeLookup.Remove(InNodeID);
+	}
+
+	// Not in the lookup (or stale): search the asset links, and update the lookup of the asset link if found
 	for (TWeakObjectPtr<UHoudiniPDGAssetLink>& CurAssetLinkPtr : PDGAssetLinks)
 	{
 		if (!CurAssetLinkPtr.IsValid() || CurAssetLinkPtr.IsStale())
@@ -1141,6 +1182,7 @@ FHoudiniPDGManager::GetTOPAssetLinkAndNode(
 		if (OutTOPNode != nullptr)
 		{
 			OutAssetLink = CurAssetLink;
+			UpdateTOPNodeLookup(CurAssetLink);
 			return true;
 		}
 	}
@@ -1148,6 +1190,43 @@ FHoudiniPDGManager::GetTOPAssetLinkAndNode(
 	return false;
 }
 
+void
+FHoudiniPDGManager::UpdateTOPNodeLookup(UHoudiniPDGAssetLink* InPDGAssetLink)
+{
+	// Remove the entries of this asset link, and stale entries
+	for (auto It = TOPNodeLookup.CreateIterator(); It; ++It)
+	{
+		UHoudiniPDGAssetLink* EntryAssetLink = It.Value().AssetLink.Get();
+		if (!IsValid(EntryAssetLink) || EntryAssetLink == InPDGAssetLink || !It.Value().TOPNode.IsValid())
+			It.RemoveCurrent();
+	}
+
+	if (!IsValid(InPDGAssetLink))
+		return;
+
+	const uint32 TOPNodesVersion = InPDGAssetLink->GetTOPNodesVersion();
+	for (UTOPNetwork* CurrentTOPNet : InPDGAssetLink->AllTOPNetworks)
+	{
+		if (!IsValid(CurrentTOPNet))
+			continue;
+
+		for (UTOPNode* CurrentTOPNode : CurrentTOPNet->AllTOPNodes)
+		{
+			if (!IsValid(CurrentTOPNode) || CurrentTOPNode->NodeId < 0)
+				continue;
+
+			// Keep the first node with this id, like GetTOPNode()
+			if (TOPNodeLookup.Contains(CurrentTOPNode->NodeId))
+				continue;
+
+			FTOPNodeLookupEntry& Entry = TOPNodeLookup.Add(CurrentTOPNode->NodeId);
+			Entry.AssetLink = InPDGAssetLink;
+			Entry.TOPNode = CurrentTOPNode;
+			Entry.TOPNodesVersion = TOPNodesVersion;
+		}
+	}
+}
+
 void
 FHoudiniPDGManager::SetTOPNodePDGState(UHoudiniPDGAssetLink* InPDGAssetLink, UTOPNode* InTOPNode, const EPDGNodeState& InPDGState)
 {
@@ -1395,11 +1474,11 @@ FHoudiniPDGManager::CreateOrRelinkWorkItem(
 			FTOPWorkResult LocalWorkResult;
 			LocalWorkResult.WorkItemID = InWorkItemID;
 			LocalWorkResult.WorkItemIndex = WorkItemInfo.index;
-			Index = InTOPNode->WorkResult.Add(LocalWorkResult);
+			Index = InTOPNode->AddWorkResult(LocalWorkResult);
 		}
 		else
 		{
-			InTOPNode->WorkResult[Index].WorkItemID = InWorkItemID;
+			InTOPNode->SetWorkResultID(Index, InWorkItemID);
 		}
 	}
 
@@ -1557,6 +1636,14 @@ FHoudiniPDGManager::CreateOrRelinkWorkItemResult(
 	}
 	WorkResult->ResultObjects = NewResultObjects;
 
+	// New results might have to go through the load budget
+	if (bInLoadResultObjects)
+	{
+		UHoudiniPDGAssetLink* AssetLink = Cast<UHoudiniPDGAssetLink>(InTOPNode->GetOuter());
+		if (IsValid(AssetLink))
+			AssetLink->MarkLoadBudgetDirty();
+	}
+
 	return true;
 }
 
@@ -1618,9 +1705,10 @@ FHoudiniPDGManager::SyncAndPruneWorkItems(UTOPNode* InTOPNode)
 			HOUDINI_PDG_WARNING(
 				TEXT("Pruning a FTOPWorkResult entry from TOP Node %d, WorkItemID %d, WorkItemIndex %d, Array Index %d"),
 				InTOPNode->NodeId, WorkResult.WorkItemID, WorkResult.WorkItemIndex, Index);
+			const int32 RemovedWorkItemID = WorkResult.WorkItemID;
 			WorkResult.ClearAndDestroyResultObjects();
-			InTOPNode->WorkResult.RemoveAt(Index);
-			InTOPNode->OnWorkItemRemoved(WorkResult.WorkItemID);
+			InTOPNode->RemoveWorkResultAt(Index);
+			InTOPNode->OnWorkItemRemoved(RemovedWorkItemID);
 			NumRemoved++;
 		}
 	}
@@ -1688,6 +1776,9 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 		// UWorld *World = ParentActor ? ParentActor->GetWorld() : AssetLink->GetWorld();
 		UWorld *World = AssetLink->GetWorld();
 
+		// Defer or unload results to respect the asset link's load budget
+		ApplyWorkResultLoadBudget(AssetLink);
+
 		// .. All TOP Nets
 		for (UTOPNetwork* CurrentTOPNet : AssetLink->AllTOPNetworks)
 		{
@@ -1736,18 +1827,25 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 									PackageParams))
 								{
 									CurrentWorkResultObj.State = EPDGWorkResultState::Loaded;
-									CurrentWorkResultObj.SetAutoBakedSinceLastLoad(false);
+									const bool bIsBudgetReload = IsReloadOfAutoBakedResult(CurrentWorkResultObj);
+									CurrentWorkResultObj.SetAutoBakedSinceLastLoad(bIsBudgetReload);
+									UpdateLoadedWorkResultInfo(CurrentWorkResultObj);
 									CurrentTOPNode->bCachedHaveLoadedWorkResults = true;
 									
 									// Broadcast that we have loaded the work result object to those interested
-									AssetLink->OnWorkResultObjectLoaded.Broadcast(
-										AssetLink, CurrentTOPNode, CurrentWorkResult.WorkItemIndex,
-										CurrentWorkResultObj.WorkItemResultInfoIndex);
+									if (!bIsBudgetReload)
+									{
+										AssetLink->OnWorkResultObjectLoaded.Broadcast(
+											AssetLink, CurrentTOPNode, CurrentWorkResult.WorkItemIndex,
+											CurrentWorkResultObj.WorkItemResultInfoIndex);
+									}
 								}
 								else
 								{
 									CurrentWorkResultObj.State = EPDGWorkResultState::None;
 								}
+								AssetLink->MarkTOPNodeChanged(CurrentTOPNode);
+								AssetLink->MarkLoadBudgetDirty();
 							}
 						}
 						else if (CurrentWorkResultObj.State == EPDGWorkResultState::Loaded)
@@ -1774,6 +1872,8 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 							CurrentWorkResultObj.GetOutputActorOwner().DestroyOutputActor();
 							CurrentWorkResultObj.State = EPDGWorkResultState::Deleted;
 							CurrentTOPNode->bCachedHaveNotLoadedWorkResults = true;
+							AssetLink->MarkTOPNodeChanged(CurrentTOPNode);
+							AssetLink->MarkLoadBudgetDirty();
 						}
 						else if (CurrentWorkResultObj.State == EPDGWorkResultState::Deleted)
 						{
@@ -1790,6 +1890,284 @@ FHoudiniPDGManager::ProcessWorkItemResults()
 	}
 }
 
+// Location of the active editor viewport's camera, returns false if there is none
+static bool
+GetEditorViewLocation(FVector& OutViewLocation)
+{
+#if WITH_EDITOR
+	if (!GEditor || !GEditor->GetActiveViewport())
+		return false;
+
+	FEditorViewportClient* ViewportClient = (FEditorViewportClient*)GEditor->GetActiveViewport()->GetClient();
+	if (!ViewportClient)
+		return false;
+
+	OutViewLocation = ViewportClient->GetViewLocation();
+	return true;
+#else
+	return false;
+#endif
+}
+
+// A work result object considered by the load budget, with its priority
+struct FHoudiniPDGBudgetEntry
+{
+	UTOPNode* TOPNode = nullptr;
+	FTOPWorkResultObject* WorkResultObject = nullptr;
+	// Results of the selected TOP node have priority over the others
+	bool bInSelectedTOPNode = false;
+	// Squared distance to the camera, MAX_flt if unknown
+	float DistanceSquared = MAX_flt;
+	// Memory used by the result once loaded: estimated if it was never loaded, 0 if unknown
+	int64 EstimatedSize = 0;
+};
+
+void
+FHoudiniPDGManager::ApplyWorkResultLoadBudget(UHoudiniPDGAssetLink* InAssetLink)
+{
+	if (!IsValid(InAssetLink))
+		return;
+
+	const int32 MaxLoaded = InAssetLink->MaxLoadedWorkResultObjects;
+	const int64 MaxMemory = (int64)InAssetLink->MaxLoadedWorkResultsMemoryMB * 1024 * 1024;
+	if (MaxLoaded <= 0 && MaxMemory <= 0)
+		return;
+
+	// Only enforce the budget when results were added/loaded or the budget changed
+	const double Now = FPlatformTime::Seconds();
+	if (!InAssetLink->ShouldApplyLoadBudget(Now))
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniPDGManager::ApplyWorkResultLoadBudget);
+
+	// Results rendered within that time are considered viewed
+	const float RecentlyViewedTolerance = 0.5f;
+	// A result closer to the camera only replaces a loaded one if it is that much closer (squared), 
+	// to avoid results being unloaded and reloaded as the camera moves between them
+	const float DistanceHysteresis = 0.5f;
+
+	FVector ViewLocation = FVector::ZeroVector;
+	const bool bHasViewLocation = GetEditorViewLocation(ViewLocation);
+	UTOPNode* SelectedTOPNode = InAssetLink->GetSelectedTOPNode();
+
+	int32 NumLoaded = 0;
+	int64 LoadedMemory = 0;
+	// Used to estimate the size of the results that were never loaded
+	int32 NumSizedResults = 0;
+	int64 SizedResultsMemory = 0;
+	int32 NumUnsizedLoading = 0;
+	TArray<FHoudiniPDGBudgetEntry> LoadedEntries;
+	TArray<FHoudiniPDGBudgetEntry> CandidateEntries;
+	for (UTOPNetwork* TOPNetwork : InAssetLink->AllTOPNetworks)
+	{
+		if (!IsValid(TOPNetwork))
+			continue;
+
+		for (UTOPNode* TOPNode : TOPNetwork->AllTOPNodes)
+		{
+			if (!IsValid(TOPNode))
+				continue;
+
+			for (FTOPWorkResult& WorkResult : TOPNode->WorkResult)
+			{
+				for (FTOPWorkResultObject& WRO : WorkResult.ResultObjects)
+				{
+					FHoudiniPDGBudgetEntry Entry;
+					Entry.TOPNode = TOPNode;
+					Entry.WorkResultObject = &WRO;
+					Entry.bInSelectedTOPNode = (TOPNode == SelectedTOPNode);
+					if (bHasViewLocation && WRO.bHasLastKnownLocation)
+						Entry.DistanceSquared = FVector::DistSquared(ViewLocation, WRO.LastKnownLocation);
+					Entry.EstimatedSize = WRO.LoadedResourceSize;
+					if (WRO.LoadedResourceSize > 0)
+					{
+						NumSizedResults++;
+						SizedResultsMemory += WRO.LoadedResourceSize;
+					}
+
+					if (WRO.State == EPDGWorkResultState::Loaded || WRO.State == EPDGWorkResultState::Loading)
+					{
+						NumLoaded++;
+						LoadedMemory += WRO.LoadedResourceSize;
+						if (WRO.LoadedResourceSize <= 0)
+							NumUnsizedLoading++;
+
+						// Results still loading can't be unloaded
+						if (WRO.State != EPDGWorkResultState::Loaded)
+							continue;
+
+						AActor* OutputActor = WRO.GetOutputActorOwner().GetOutputActor();
+						if (IsValid(OutputActor) && OutputActor->WasRecentlyRendered(RecentlyViewedTolerance))
+							WRO.LastViewedTime = Now;
+
+						LoadedEntries.Add(Entry);
+					}
+					else if (WRO.State == EPDGWorkResultState::ToLoad
+						|| (WRO.bWaitingForLoadBudget && (WRO.State == EPDGWorkResultState::NotLoaded || WRO.State == EPDGWorkResultState::Deleted)))
+					{
+						CandidateEntries.Add(Entry);
+					}
+				}
+			}
+		}
+	}
+
+	// Results that were never loaded have no known size: use the average size of the results we know of,
+	// or the size of their file on disk. Without either, they are admitted one at a time (see below).
+	bool bAdmittedUnknownSize = false;
+	if (MaxMemory > 0)
+	{
+		const int64 AverageSize = NumSizedResults > 0 ? SizedResultsMemory / NumSizedResults : 0;
+		LoadedMemory += NumUnsizedLoading * AverageSize;
+		bAdmittedUnknownSize = NumUnsizedLoading > 0 && AverageSize <= 0;
+
+		for (FHoudiniPDGBudgetEntry& Candidate : CandidateEntries)
+		{
+			if (Candidate.EstimatedSize > 0)
+				continue;
+
+			if (AverageSize > 0)
+				Candidate.EstimatedSize = AverageSize;
+			else if (!Candidate.WorkResultObject->FilePath.IsEmpty())
+				Candidate.EstimatedSize = FMath::Max<int64>(IFileManager::Get().FileSize(*Candidate.WorkResultObject->FilePath), 0);
+		}
+	}
+
+	auto IsOverBudget = [MaxLoaded, MaxMemory](int32 InNumLoaded, int64 InMemory)
+	{
+		return (MaxLoaded > 0 && InNumLoaded > MaxLoaded) || (MaxMemory > 0 && InMemory > MaxMemory);
+	};
+
+	if (CandidateEntries.Num() <= 0 && !IsOverBudget(NumLoaded, LoadedMemory))
+	{
+		InAssetLink->OnLoadBudgetApplied(Now, false);
+		return;
+	}
+
+	// Least recently viewed (then farthest) loaded results first: the first to be unloaded
+	LoadedEntries.Sort([](const FHoudiniPDGBudgetEntry& A, const FHoudiniPDGBudgetEntry& B)
+	{
+		if (A.bInSelectedTOPNode != B.bInSelectedTOPNode)
+			return !A.bInSelectedTOPNode;
+		if (A.WorkResultObject->LastViewedTime != B.WorkResultObject->LastViewedTime)
+			return A.WorkResultObject->LastViewedTime < B.WorkResultObject->LastViewedTime;
+		return A.DistanceSquared > B.DistanceSquared;
+	});
+
+	// Results of the selected node, then the closest to the camera first: the first to be loaded
+	CandidateEntries.Sort([](const FHoudiniPDGBudgetEntry& A, const FHoudiniPDGBudgetEntry& B)
+	{
+		if (A.bInSelectedTOPNode != B.bInSelectedTOPNode)
+			return A.bInSelectedTOPNode;
+		return A.DistanceSquared < B.DistanceSquared;
+	});
+
+	// Indicates if a result to load has priority over a loaded one
+	auto HasPriorityOver = [Now, RecentlyViewedTolerance, DistanceHysteresis](const FHoudiniPDGBudgetEntry& InCandidate, const FHoudiniPDGBudgetEntry& InLoaded)
+	{
+		if (InCandidate.bInSelectedTOPNode != InLoaded.bInSelectedTOPNode)
+			return InCandidate.bInSelectedTOPNode;
+
+		// Never replace what is currently on screen
+		if (Now - InLoaded.WorkResultObject->LastViewedTime <= RecentlyViewedTolerance)
+			return false;
+
+		return InCandidate.DistanceSquared < InLoaded.DistanceSquared * DistanceHysteresis;
+	};
+
+	int32 NextToUnloadIdx = 0;
+	auto UnloadNext = [&]()
+	{
+		const FHoudiniPDGBudgetEntry& Entry = LoadedEntries[NextToUnloadIdx++];
+		FTOPWorkResultObject* WRO = Entry.WorkResultObject;
+		WRO->State = EPDGWorkResultState::ToDelete;
+		WRO->bWaitingForLoadBudget = true;
+		NumLoaded--;
+		LoadedMemory -= WRO->LoadedResourceSize;
+		InAssetLink->MarkTOPNodeChanged(Entry.TOPNode);
+	};
+
+	bool bHasResultsWaitingForBudget = false;
+	for (const FHoudiniPDGBudgetEntry& Candidate : CandidateEntries)
+	{
+		FTOPWorkResultObject* WRO = Candidate.WorkResultObject;
+
+		while (IsOverBudget(NumLoaded + 1, LoadedMemory + Candidate.EstimatedSize)
+			&& LoadedEntries.IsValidIndex(NextToUnloadIdx)
+			&& HasPriorityOver(Candidate, LoadedEntries[NextToUnloadIdx]))
+		{
+			UnloadNext();
+		}
+
+		// With a memory budget, only admit one result of unknown size per pass: its actual size,
+		// known once it is loaded, is then used to estimate the others
+		const bool bUnknownSize = MaxMemory > 0 && Candidate.EstimatedSize <= 0;
+		if (IsOverBudget(NumLoaded + 1, LoadedMemory + Candidate.EstimatedSize) || (bUnknownSize && bAdmittedUnknownSize))
+		{
+			bHasResultsWaitingForBudget = true;
+			// Doesn't fit: load it later, when it has priority
+			if (WRO->State != EPDGWorkResultState::NotLoaded)
+			{
+				WRO->State = EPDGWorkResultState::NotLoaded;
+				InAssetLink->MarkTOPNodeChanged(Candidate.TOPNode);
+			}
+			WRO->bWaitingForLoadBudget = true;
+			continue;
+		}
+
+		WRO->State = EPDGWorkResultState::ToLoad;
+		NumLoaded++;
+		LoadedMemory += Candidate.EstimatedSize;
+		bAdmittedUnknownSize |= bUnknownSize;
+	}
+
+	// The budget might have been reduced, or the size of the last loaded results exceeded it
+	while (IsOverBudget(NumLoaded, LoadedMemory) && LoadedEntries.IsValidIndex(NextToUnloadIdx))
+		UnloadNext();
+
+	// Last, as unloading marks the budget dirty
+	InAssetLink->OnLoadBudgetApplied(Now, bHasResultsWaitingForBudget);
+}
+
+bool
+FHoudiniPDGManager::IsReloadOfAutoBakedResult(const FTOPWorkResultObject& InWorkResultObject)
+{
+	// Results unloaded by the budget keep their auto-baked flag: reloading them must not bake them again
+	return InWorkResultObject.bWaitingForLoadBudget && InWorkResultObject.AutoBakedSinceLastLoad();
+}
+
+void
+FHoudiniPDGManager::UpdateLoadedWorkResultInfo(FTOPWorkResultObject& InWorkResultObject)
+{
+	InWorkResultObject.LastViewedTime = FPlatformTime::Seconds();
+	InWorkResultObject.bWaitingForLoadBudget = false;
+
+	int64 ResourceSize = 0;
+	for (UHoudiniOutput* ResultOutput : InWorkResultObject.GetResultOutputs())
+	{
+		if (!IsValid(ResultOutput))
+			continue;
+
+		for (auto& Pair : ResultOutput->GetOutputObjects())
+		{
+			const FHoudiniOutputObject& OutputObject = Pair.Value;
+			if (IsValid(OutputObject.OutputObject))
+				ResourceSize += OutputObject.OutputObject->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			if (IsValid(OutputObject.ProxyObject))
+				ResourceSize += OutputObject.ProxyObject->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+	}
+	InWorkResultObject.LoadedResourceSize = ResourceSize;
+
+	AActor* OutputActor = InWorkResultObject.GetOutputActorOwner().GetOutputActor();
+	if (IsValid(OutputActor))
+	{
+		const FBox Bounds = OutputActor->GetComponentsBoundingBox(true);
+		InWorkResultObject.LastKnownLocation = Bounds.IsValid ? Bounds.GetCenter() : OutputActor->GetActorLocation();
+		InWorkResultObject.bHasLastKnownLocation = true;
+	}
+}
+
 void FHoudiniPDGManager::HandleImportBGEODiscoverMessage(
 	const FHoudiniPDGImportBGEODiscoverMessage& InMessage,
 	const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext)
@@ -2025,17 +2403,24 @@ void FHoudiniPDGManager::HandleImportBGEOResultMessage(
 		if (bSuccess)
 		{
 			WorkResultObject->State = EPDGWorkResultState::Loaded;
-			WorkResultObject->SetAutoBakedSinceLastLoad(false);
+			const bool bIsBudgetReload = IsReloadOfAutoBakedResult(*WorkResultObject);
+			WorkResultObject->SetAutoBakedSinceLastLoad(bIsBudgetReload);
+			UpdateLoadedWorkResultInfo(*WorkResultObject);
 			HOUDINI_LOG_MESSAGE(TEXT("Loaded geo for %s"), *InMessage.Name);
 			// Broadcast that we have loaded the work result object to those interested
-			AssetLink->OnWorkResultObjectLoaded.Broadcast(
-				AssetLink, TOPNode, WorkResult->WorkItemIndex, WorkResultObject->WorkItemResultInfoIndex);
+			if (!bIsBudgetReload)
+			{
+				AssetLink->OnWorkResultObjectLoaded.Broadcast(
+					AssetLink, TOPNode, WorkResult->WorkItemIndex, WorkResultObject->WorkItemResultInfoIndex);
+			}
 		}
 		else
 		{
 			WorkResultObject->State = EPDGWorkResultState::None;
 			HOUDINI_LOG_WARNING(TEXT("Failed to process loaded assets for %s"), *InMessage.Name);
 		}
+		AssetLink->MarkTOPNodeChanged(TOPNode);
+		AssetLink->MarkLoadBudgetDirty();
 	}
 	else
 	{
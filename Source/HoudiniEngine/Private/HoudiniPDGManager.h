@@ -37,6 +37,7 @@ class UHoudiniPDGAssetLink;
 class UTOPNetwork;
 class UTOPNode;
 class FSocket;
+struct FTOPWorkResultObject;
 
 enum class EPDGNodeState : uint8;
 
@@ -167,6 +168,21 @@ private:
 
 	void ProcessWorkItemResults();
 
+	// Enforces the asset link's work result load budget (MaxLoadedWorkResultObjects / MaxLoadedWorkResultsMemoryMB).
+	// Results to load are prioritized by TOP node selection and camera proximity: the ones that don't fit are
+	// deferred, or unload the least recently viewed results if they have priority over them.
+	// The size of results that were never loaded is estimated from the loaded ones or from their file size.
+	// Only runs when the asset link's budget is dirty, or periodically while results are waiting for it.
+	// Must be called before the ToLoad results are processed.
+	static void ApplyWorkResultLoadBudget(UHoudiniPDGAssetLink* InAssetLink);
+
+	// Records the estimated size and the location of a work result object's outputs after it has been loaded
+	static void UpdateLoadedWorkResultInfo(FTOPWorkResultObject& InWorkResultObject);
+
+	// Indicates if a work result object that was just loaded had been auto-baked before the load budget unloaded it.
+	// Must be called before UpdateLoadedWorkResultInfo(), which clears the budget state.
+	static bool IsReloadOfAutoBakedResult(const FTOPWorkResultObject& InWorkResultObject);
+
 	void ProcessPDGEvent(const HAPI_PDG_GraphContextId& InContextID, HAPI_PDG_EventInfo& EventInfo);
 
 	static void ResetPDGEventInfo(HAPI_PDG_EventInfo& InEventInfo);
@@ -174,6 +190,9 @@ private:
 	// Returns the PDGAssetLink and FTOPNode associated with this TOP node ID
 	bool GetTOPAssetLinkAndNode(const HAPI_NodeId& InNodeID, UHoudiniPDGAssetLink*& OutAssetLink, UTOPNode*& OutTOPNode);
 
+	// Replaces the entries of InPDGAssetLink in the TOP node lookup with its current TOP nodes
+	void UpdateTOPNodeLookup(UHoudiniPDGAssetLink* InPDGAssetLink);
+
 	void SetTOPNodePDGState(UHoudiniPDGAssetLink* InPDGAssetLink, UTOPNode* InTOPNode, const EPDGNodeState& InPDGState);
 
 	void NotifyTOPNodePDGStateClear(UHoudiniPDGAssetLink* InPDGAssetLink, UTOPNode* InTOPNode);
@@ -202,6 +221,16 @@ private:
 
 	TArray<TWeakObjectPtr<UHoudiniPDGAssetLink>> PDGAssetLinks;
 
+	// Asset link and TOP node of a HAPI TOP node id, used to dispatch the PDG events
+	struct FTOPNodeLookupEntry
+	{
+		TWeakObjectPtr<UHoudiniPDGAssetLink> AssetLink;
+		TWeakObjectPtr<UTOPNode> TOPNode;
+		// The asset link's TOP nodes version when the entry was added
+		uint32 TOPNodesVersion = 0;
+	};
+	TMap<HAPI_NodeId, FTOPNodeLookupEntry> TOPNodeLookup;
+
 	int32 MaxNumberOfPDGEvents = 20;
 	int32 MaxNumberOPDGContexts = 20;
 
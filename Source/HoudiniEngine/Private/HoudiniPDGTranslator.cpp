@@ -147,7 +147,8 @@ FHoudiniPDGTranslator::CreateAllResultObjectsForPDGWorkItem(
 			FHoudiniEngine::Get().FinishTaskSlateNotification(
 				LOCTEXT("TranslatePDGBGEOOutputsDone", "Done: Translating PDG/BGEO Outputs."));		
 
-		InTOPNode->UpdateOutputVisibilityInLevel();
+		// Apply the node's visibility to the new results right away, so they don't show up for a frame if it is hidden
+		InTOPNode->UpdateOutputVisibilityInLevel(true);
 	}
 	else
 	{
@@ -230,7 +231,8 @@ FHoudiniPDGTranslator::LoadExistingAssetsAsResultObjectsForPDGWorkItem(
 		FHoudiniEngine::Get().FinishTaskSlateNotification(
 			LOCTEXT("TranslatePDGBGEOOutputsDone", "Done: Translating PDG/BGEO Outputs."));
 
-	InTOPNode->UpdateOutputVisibilityInLevel();
+	// Apply the node's visibility to the new results right away, so they don't show up for a frame if it is hidden
+	InTOPNode->UpdateOutputVisibilityInLevel(true);
 
 	return bResult;
 }
@@ -0,0 +1,288 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniPackageNameAllocator.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+
+FHoudiniPackageNameAllocator::FHoudiniPackageNameAllocator()
+{}
+
+FHoudiniPackageNameAllocator::~FHoudiniPackageNameAllocator()
+{}
+
+FHoudiniPackageNameAllocator&
+FHoudiniPackageNameAllocator::Get()
+{
+	static FHoudiniPackageNameAllocator Allocator;
+	return Allocator;
+}
+
+bool
+FHoudiniPackageNameAllocator::IsPackageNameUsed(const FString& InPackageName)
+{
+	if (InPackageName.IsEmpty())
+		return false;
+
+	IndexFolderIfNeeded(FPackageName::GetLongPackagePath(InPackageName));
+
+	return UsedPackageNames.Contains(FName(*InPackageName));
+}
+
+int32
+FHoudiniPackageNameAllocator::GetNextFreeCounter(const FString& InBasePackageName, const int32& InStartCounter)
+{
+	IndexFolderIfNeeded(FPackageName::GetLongPackagePath(InBasePackageName));
+
+	if (!UsedPackageNames.Contains(FName(*MakePackageName(InBasePackageName, InStartCounter))))
+		return InStartCounter;
+
+	const int32* HighestCounter = HighestCounters.Find(FName(*InBasePackageName));
+	const int32 NextCounter = HighestCounter ? *HighestCounter + 1 : 1;
+
+	return FMath::Max(NextCounter, InStartCounter + 1);
+}
+
+void
+FHoudiniPackageNameAllocator::ReserveCounters(
+	const TArray<FString>& InBasePackageNames, TArray<int32>& OutCounters, const int32& InStartCounter)
+{
+	OutCounters.SetNumUninitialized(InBasePackageNames.Num());
+	for (int32 Idx = 0; Idx < InBasePackageNames.Num(); Idx++)
+	{
+		const int32 Counter = GetNextFreeCounter(InBasePackageNames[Idx], InStartCounter);
+		ReservePackageName(MakePackageName(InBasePackageNames[Idx], Counter));
+		ReservedCounters.FindOrAdd(FName(*InBasePackageNames[Idx])).Add(Counter);
+		OutCounters[Idx] = Counter;
+	}
+}
+
+bool
+FHoudiniPackageNameAllocator::ClaimReservedCounter(const FString& InBasePackageName, int32& OutCounter)
+{
+	const FName BasePackageName(*InBasePackageName);
+	TArray<int32>* Counters = ReservedCounters.Find(BasePackageName);
+	if (!Counters || Counters->Num() <= 0)
+		return false;
+
+	OutCounter = (*Counters)[0];
+	Counters->RemoveAt(0, 1, false);
+	if (Counters->Num() <= 0)
+		ReservedCounters.Remove(BasePackageName);
+
+	return true;
+}
+
+void
+FHoudiniPackageNameAllocator::ReleaseReservedCounters()
+{
+	for (const auto& Pair : ReservedCounters)
+	{
+		const FString BasePackageName = Pair.Key.ToString();
+		for (const int32& Counter : Pair.Value)
+			RemoveUsedPackageName(FName(*MakePackageName(BasePackageName, Counter)));
+	}
+	ReservedCounters.Empty();
+}
+
+void
+FHoudiniPackageNameAllocator::ReservePackageName(const FString& InPackageName)
+{
+	if (InPackageName.IsEmpty())
+		return;
+
+	IndexFolderIfNeeded(FPackageName::GetLongPackagePath(InPackageName));
+	AddUsedPackageName(FName(*InPackageName));
+}
+
+FString
+FHoudiniPackageNameAllocator::MakePackageName(const FString& InBasePackageName, const int32& InCounter)
+{
+	if (InCounter <= 0)
+		return InBasePackageName;
+
+	return InBasePackageName + TEXT("_") + FString::FromInt(InCounter);
+}
+
+bool
+FHoudiniPackageNameAllocator::SplitPackageName(const FString& InPackageName, FString& OutBasePackageName, int32& OutCounter)
+{
+	OutBasePackageName = InPackageName;
+	OutCounter = 0;
+
+	int32 SeparatorIdx = INDEX_NONE;
+	if (!InPackageName.FindLastChar(TEXT('_'), SeparatorIdx) || SeparatorIdx <= 0)
+		return false;
+
+	const FString Suffix = InPackageName.Mid(SeparatorIdx + 1);
+	if (Suffix.IsEmpty() || !Suffix.IsNumeric())
+		return false;
+
+	// Ignore suffixes that are not plain positive integers
+	for (const TCHAR& Char : Suffix)
+	{
+		if (!FChar::IsDigit(Char))
+			return false;
+	}
+
+	OutBasePackageName = InPackageName.Left(SeparatorIdx);
+	OutCounter = FCString::Atoi(*Suffix);
+	return true;
+}
+
+void
+FHoudiniPackageNameAllocator::Reset()
+{
+	IndexedFolders.Empty();
+	UsedPackageNames.Empty();
+	HighestCounters.Empty();
+	ReservedCounters.Empty();
+}
+
+void
+FHoudiniPackageNameAllocator::Shutdown()
+{
+	if (OnAssetAddedHandle.IsValid() || OnAssetRemovedHandle.IsValid() || OnAssetRenamedHandle.IsValid())
+	{
+		FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry");
+		if (AssetRegistryModule)
+		{
+			IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+			AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+			AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+			AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		}
+
+		OnAssetAddedHandle.Reset();
+		OnAssetRemovedHandle.Reset();
+		OnAssetRenamedHandle.Reset();
+	}
+
+	Reset();
+}
+
+void
+FHoudiniPackageNameAllocator::IndexFolderIfNeeded(const FString& InPackagePath)
+{
+	if (InPackagePath.IsEmpty())
+		return;
+
+	const FName PackagePath(*InPackagePath);
+	if (IndexedFolders.Contains(PackagePath))
+		return;
+
+	IndexedFolders.Add(PackagePath);
+
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	// Keep track of assets created/deleted/renamed outside of the plugin
+	if (!OnAssetAddedHandle.IsValid())
+		OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FHoudiniPackageNameAllocator::OnAssetAdded);
+	if (!OnAssetRemovedHandle.IsValid())
+		OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FHoudiniPackageNameAllocator::OnAssetRemoved);
+	if (!OnAssetRenamedHandle.IsValid())
+		OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FHoudiniPackageNameAllocator::OnAssetRenamed);
+
+	// The registry might not have scanned that folder yet
+	if (AssetRegistry.IsLoadingAssets())
+		AssetRegistry.ScanPathsSynchronous({ InPackagePath });
+
+	TArray<FAssetData> AssetDatas;
+	AssetRegistry.GetAssetsByPath(PackagePath, AssetDatas, false, false);
+	for (const FAssetData& AssetData : AssetDatas)
+		AddUsedPackageName(AssetData.PackageName);
+}
+
+void
+FHoudiniPackageNameAllocator::AddUsedPackageName(const FName& InPackageName)
+{
+	UsedPackageNames.Add(InPackageName);
+
+	FString BasePackageName;
+	int32 Counter = 0;
+	if (!SplitPackageName(InPackageName.ToString(), BasePackageName, Counter))
+		return;
+
+	int32& HighestCounter = HighestCounters.FindOrAdd(FName(*BasePackageName), 0);
+	HighestCounter = FMath::Max(HighestCounter, Counter);
+}
+
+void
+FHoudiniPackageNameAllocator::RemoveUsedPackageName(const FName& InPackageName)
+{
+	if (UsedPackageNames.Remove(InPackageName) <= 0)
+		return;
+
+	FString BasePackageName;
+	int32 Counter = 0;
+	if (!SplitPackageName(InPackageName.ToString(), BasePackageName, Counter))
+		return;
+
+	const FName BaseName(*BasePackageName);
+	int32* HighestCounter = HighestCounters.Find(BaseName);
+	if (!HighestCounter || *HighestCounter != Counter)
+		return;
+
+	// The highest counter was released, find the previous one still in use
+	int32 NewHighestCounter = Counter - 1;
+	while (NewHighestCounter > 0 && !UsedPackageNames.Contains(FName(*MakePackageName(BasePackageName, NewHighestCounter))))
+		NewHighestCounter--;
+
+	if (NewHighestCounter > 0)
+		*HighestCounter = NewHighestCounter;
+	else
+		HighestCounters.Remove(BaseName);
+}
+
+void
+FHoudiniPackageNameAllocator::OnAssetAdded(const FAssetData& InAssetData)
+{
+	if (IndexedFolders.Contains(InAssetData.PackagePath))
+		AddUsedPackageName(InAssetData.PackageName);
+}
+
+void
+FHoudiniPackageNameAllocator::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	if (IndexedFolders.Contains(InAssetData.PackagePath))
+		RemoveUsedPackageName(InAssetData.PackageName);
+}
+
+void
+FHoudiniPackageNameAllocator::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	// Release the old package name
+	const FString OldPackageName = FPackageName::ObjectPathToPackageName(InOldObjectPath);
+	const FName OldPackagePath(*FPackageName::GetLongPackagePath(OldPackageName));
+	if (IndexedFolders.Contains(OldPackagePath))
+		RemoveUsedPackageName(FName(*OldPackageName));
+
+	OnAssetAdded(InAssetData);
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+
+// Keeps track of the package names used in the folders we create packages in,
+// so that free package names / bake counters can be found without probing packages on disk.
+// The folders are indexed from the AssetRegistry the first time they are used, and then kept
+// up to date with the packages we reserve and the assets added/removed/renamed in the registry.
+class HOUDINIENGINE_API FHoudiniPackageNameAllocator
+{
+	public:
+
+		FHoudiniPackageNameAllocator();
+		~FHoudiniPackageNameAllocator();
+
+		static FHoudiniPackageNameAllocator& Get();
+
+		// Returns true if a package with that (long) name exists or has been reserved
+		bool IsPackageNameUsed(const FString& InPackageName);
+
+		// Returns the next free counter for InBasePackageName: if InStartCounter is free it is returned,
+		// otherwise the highest counter used for that base name + 1.
+		// The returned counter is NOT reserved, use ReservePackageName once the package has been created.
+		int32 GetNextFreeCounter(const FString& InBasePackageName, const int32& InStartCounter = 0);
+
+		// Reserves the next free counter of each base name of a batch in one call, in order (a base name can appear
+		// several times). The reserved names are used until they are claimed with ClaimReservedCounter, or released.
+		void ReserveCounters(const TArray<FString>& InBasePackageNames, TArray<int32>& OutCounters, const int32& InStartCounter = 0);
+
+		// Takes the first counter reserved by ReserveCounters for InBasePackageName, returns false if there is none
+		bool ClaimReservedCounter(const FString& InBasePackageName, int32& OutCounter);
+
+		// Frees the names reserved by ReserveCounters that were not claimed
+		void ReleaseReservedCounters();
+
+		// Marks a package name as used
+		void ReservePackageName(const FString& InPackageName);
+
+		// Returns the package name for a base name and a counter
+		static FString MakePackageName(const FString& InBasePackageName, const int32& InCounter);
+
+		// Splits a package name into its base name and counter, returns false if the name has no counter suffix
+		static bool SplitPackageName(const FString& InPackageName, FString& OutBasePackageName, int32& OutCounter);
+
+		// Forget all the indexed folders
+		void Reset();
+
+		// Unbinds from the asset registry and resets the allocator, called when the module shuts down
+		void Shutdown();
+
+	protected:
+
+		// Indexes the assets in a folder from the asset registry, if not done yet
+		void IndexFolderIfNeeded(const FString& InPackagePath);
+
+		// Add a package name to the used names / counters
+		void AddUsedPackageName(const FName& InPackageName);
+
+		// Remove a package name from the used names / counters, so it can be allocated again
+		void RemoveUsedPackageName(const FName& InPackageName);
+
+		// Asset registry callbacks
+		void OnAssetAdded(const FAssetData& InAssetData);
+		void OnAssetRemoved(const FAssetData& InAssetData);
+		void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+	protected:
+
+		// Folders that have been indexed
+		TSet<FName> IndexedFolders;
+
+		// All the used (long) package names in the indexed folders
+		TSet<FName> UsedPackageNames;
+
+		// Highest counter used per (long) base package name
+		TMap<FName, int32> HighestCounters;
+
+		// Counters reserved by ReserveCounters and not claimed yet, per (long) base package name
+		TMap<FName, TArray<int32>> ReservedCounters;
+
+		// Asset registry delegate handles
+		FDelegateHandle OnAssetAddedHandle;
+		FDelegateHandle OnAssetRemovedHandle;
+		FDelegateHandle OnAssetRenamedHandle;
+};
\ No newline at end of file
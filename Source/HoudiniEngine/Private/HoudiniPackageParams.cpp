@@ -31,6 +31,8 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniStaticMesh.h"
 #include "HoudiniStringResolver.h"
+#include "HoudiniPackageNameAllocator.h"
+#include "HoudiniTempPackageTracker.h"
 
 #include "PackageTools.h"
 #include "ObjectTools.h"
@@ -296,6 +298,19 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 	FString PackageName = GetPackageName();
 	FString PackagePath = GetPackagePath();
 	   
+	// Use the counter reserved for this package by the bake batch, if any
+	bool bUseReservedCounter = false;
+	if (PackageMode == EPackageMode::Bake && ReplaceMode == EPackageReplaceMode::CreateNewAssets)
+	{
+		const FString BasePackageName = UPackageTools::SanitizePackageName(PackagePath + TEXT("/") + PackageName);
+		int32 ReservedCounter = 0;
+		if (FHoudiniPackageNameAllocator::Get().ClaimReservedCounter(BasePackageName, ReservedCounter))
+		{
+			BakeCounter = ReservedCounter;
+			bUseReservedCounter = true;
+		}
+	}
+
 	// Iterate until we find a suitable name for the package
 	UPackage * NewPackage = nullptr;
 	while (true)
@@ -316,20 +331,30 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		FinalPackageName = UPackageTools::SanitizePackageName(FinalPackageName);
 
 		// If we are set to create new assets, check if a package named similarly already exists
+		// Packages on disk are tracked by the package name allocator, so we don't need to probe/load them
 		if (ReplaceMode == EPackageReplaceMode::CreateNewAssets)
 		{
+			// A reserved name is marked as used in the allocator by its reservation
 			UPackage* FoundPackage = FindPackage(nullptr, *FinalPackageName);
-			if (FoundPackage == nullptr)
-			{
-				// Package might not be in memory, check if it exists on disk
-				FoundPackage = LoadPackage(nullptr, *FinalPackageName, LOAD_Verify | LOAD_NoWarn);
-			}
-			
-			if (FoundPackage && !FoundPackage->IsPendingKill())
+			const bool bNameIsUsed = (FoundPackage && !FoundPackage->IsPendingKill())
+				|| (!bUseReservedCounter && FHoudiniPackageNameAllocator::Get().IsPackageNameUsed(FinalPackageName));
+
+			if (bNameIsUsed)
 			{
+				bUseReservedCounter = false;
 				// we need to generate a new name for it
 				CurrentGuid = FGuid::NewGuid();
-				BakeCounter++;
+				if (PackageMode == EPackageMode::Bake)
+				{
+					// Jump directly to the next free bake counter
+					const FString BasePackageName = UPackageTools::SanitizePackageName(PackagePath + TEXT("/") + PackageName);
+					BakeCounter = FMath::Max(
+						BakeCounter + 1, FHoudiniPackageNameAllocator::Get().GetNextFreeCounter(BasePackageName, BakeCounter));
+				}
+				else
+				{
+					BakeCounter++;
+				}
 				continue;
 			}
 		}
@@ -338,6 +363,12 @@ FHoudiniPackageParams::CreatePackageForObject(FString& OutPackageName, int32 InB
 		NewPackage = CreatePackage(*FinalPackageName);
 		if (IsValid(NewPackage))
 		{
+			FHoudiniPackageNameAllocator::Get().ReservePackageName(FinalPackageName);
+
+			// Track the temporary packages created by cooks so stale ones can be reclaimed incrementally
+			if (PackageMode == EPackageMode::CookToTemp)
+				FHoudiniTempPackageTracker::Get().AddTempPackage(ComponentGUID, FinalPackageName);
+
 			// Record bake counter / temp GUID in package metadata
 			UMetaData* MetaData = NewPackage->GetMetaData();
 			if (IsValid(MetaData))
@@ -52,6 +52,7 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineTrace.h"
 #include "HoudiniEngineString.h"
 #include "HoudiniParameter.h"
 #include "HoudiniAssetComponent.h"
@@ -74,6 +75,8 @@
 bool 
 FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniParameterTranslator::UpdateParameters"), IsValid(HAC) ? HAC->GetAssetId() : -1, -1);
+
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
@@ -206,6 +209,8 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	const bool& bUpdateValues,
 	const bool& InForceFullUpdate)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniParameterTranslator::BuildAllParameters"), AssetId, -1);
+
 	// Ensure the asset has a valid node ID
 	if (AssetId < 0)
 	{	
@@ -484,7 +489,12 @@ FHoudiniParameterTranslator::BuildAllParameters(
 		}
 	}
 
-	FHoudiniEngineUtils::UpdateEditorProperties(Outer, true);
+	// Parameters owned by a component only need a full details update if their layout changed
+	UHoudiniAssetComponent* OuterHAC = Cast<UHoudiniAssetComponent>(Outer);
+	if (OuterHAC)
+		FHoudiniEngineUtils::UpdateEditorPropertiesAfterCook(OuterHAC);
+	else
+		FHoudiniEngineUtils::UpdateEditorProperties(Outer, true);
 
 	return true;
 }
@@ -2170,6 +2180,8 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 bool
 FHoudiniParameterTranslator::UploadParameterValue(UHoudiniParameter* InParam)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniParameterTranslator::UploadParameterValue"), IsValid(InParam) ? InParam->GetNodeId() : -1, -1);
+
 	if (!InParam || InParam->IsPendingKill())
 		return false;
 
@@ -2481,6 +2493,7 @@ FHoudiniParameterTranslator::GetFolderTypeFromParamInfo(const HAPI_ParmInfo* Par
 bool
 FHoudiniParameterTranslator::SyncMultiParmValuesAtLoad(UHoudiniParameter* InParam, TArray<UHoudiniParameter*> &OldParams, const int32& InAssetId, const int32 CurrentIndex)
 {
+	HOUDINI_TRACE_SCOPE_NODE(TEXT("FHoudiniParameterTranslator::SyncMultiParmValuesAtLoad"), InAssetId, -1);
 
 	UHoudiniParameterMultiParm* MultiParam = Cast<UHoudiniParameterMultiParm>(InParam);
 
@@ -30,6 +30,156 @@
 
 #include "HoudiniEnginePrivatePCH.h"
 #include "HAL/FileManager.h"
+#include "Misc/ScopeRWLock.h"
+
+// Compiled templates are shared by all resolvers. The cache is flushed when it grows past this size, as
+// templates coming from attribute values can be unique per output object.
+#define HOUDINI_STRING_TEMPLATE_CACHE_MAX_SIZE 4096
+
+static TMap<FString, TSharedRef<const FHoudiniStringTemplate>> StringTemplateCache;
+static FRWLock StringTemplateCacheLock;
+
+// Token values are stored as strings by the resolver, but the map is public and can hold any argument type
+static void AppendFormatArg(FString& OutString, const FStringFormatArg& InArg)
+{
+	switch (InArg.Type)
+	{
+		case FStringFormatArg::Int:
+			OutString.Append(LexToString(InArg.IntValue));
+			break;
+		case FStringFormatArg::UInt:
+			OutString.Append(LexToString(InArg.UIntValue));
+			break;
+		case FStringFormatArg::Double:
+			OutString.Append(FString::SanitizeFloat(InArg.DoubleValue));
+			break;
+		case FStringFormatArg::String:
+			OutString.Append(InArg.StringValue);
+			break;
+		case FStringFormatArg::StringLiteral:
+			OutString.Append(InArg.StringLiteralValue);
+			break;
+	}
+}
+
+void FHoudiniStringTemplate::Compile(const FString& InTemplate)
+{
+	Segments.Empty();
+	LiteralLength = 0;
+	bHasTokens = false;
+
+	FString Literal;
+	auto FlushLiteral = [this, &Literal]()
+	{
+		if (Literal.IsEmpty())
+			return;
+
+		LiteralLength += Literal.Len();
+		FSegment& Segment = Segments.AddDefaulted_GetRef();
+		Segment.Text = MoveTemp(Literal);
+		Literal.Reset();
+	};
+
+	const int32 Len = InTemplate.Len();
+	const TCHAR* Chars = *InTemplate;
+	for (int32 Idx = 0; Idx < Len; Idx++)
+	{
+		const TCHAR Char = Chars[Idx];
+		if (Char == TEXT('`') && Idx + 1 < Len && (Chars[Idx + 1] == TEXT('{') || Chars[Idx + 1] == TEXT('}')))
+		{
+			// Escaped brace
+			Literal.AppendChar(Chars[++Idx]);
+			continue;
+		}
+
+		if (Char == TEXT('{'))
+		{
+			// Look for the end of the token, a token can't contain another opening brace
+			int32 EndIdx = Idx + 1;
+			while (EndIdx < Len && Chars[EndIdx] != TEXT('}') && Chars[EndIdx] != TEXT('{'))
+				EndIdx++;
+
+			if (EndIdx < Len && Chars[EndIdx] == TEXT('}'))
+			{
+				FlushLiteral();
+				FSegment& Segment = Segments.AddDefaulted_GetRef();
+				Segment.Text = InTemplate.Mid(Idx + 1, EndIdx - Idx - 1);
+				Segment.bIsToken = true;
+				bHasTokens = true;
+				Idx = EndIdx;
+				continue;
+			}
+		}
+
+		Literal.AppendChar(Char);
+	}
+
+	FlushLiteral();
+}
+
+TSharedRef<const FHoudiniStringTemplate> FHoudiniStringTemplate::FindOrCompile(const FString& InTemplate)
+{
+	{
+		FReadScopeLock ReadLock(StringTemplateCacheLock);
+		if (const TSharedRef<const FHoudiniStringTemplate>* Found = StringTemplateCache.Find(InTemplate))
+			return *Found;
+	}
+
+	TSharedRef<FHoudiniStringTemplate> NewTemplate = MakeShared<FHoudiniStringTemplate>();
+	NewTemplate->Compile(InTemplate);
+
+	FWriteScopeLock WriteLock(StringTemplateCacheLock);
+	if (StringTemplateCache.Num() >= HOUDINI_STRING_TEMPLATE_CACHE_MAX_SIZE)
+		StringTemplateCache.Empty();
+
+	StringTemplateCache.Add(InTemplate, NewTemplate);
+	return NewTemplate;
+}
+
+FString FHoudiniStringTemplate::Resolve(const TMap<FString, FStringFormatArg>& InTokens) const
+{
+	// Look the tokens up once, to size the buffer before appending
+	TArray<const FStringFormatArg*, TInlineAllocator<8>> TokenValues;
+	TokenValues.SetNumZeroed(Segments.Num());
+
+	int32 ResultLength = LiteralLength;
+	for (int32 Idx = 0; Idx < Segments.Num(); Idx++)
+	{
+		const FSegment& Segment = Segments[Idx];
+		if (!Segment.bIsToken)
+			continue;
+
+		TokenValues[Idx] = InTokens.Find(Segment.Text);
+		if (!TokenValues[Idx])
+			ResultLength += Segment.Text.Len() + 2;
+		else if (TokenValues[Idx]->Type == FStringFormatArg::String)
+			ResultLength += TokenValues[Idx]->StringValue.Len();
+	}
+
+	FString Result;
+	Result.Reserve(ResultLength);
+	for (int32 Idx = 0; Idx < Segments.Num(); Idx++)
+	{
+		const FSegment& Segment = Segments[Idx];
+		if (!Segment.bIsToken)
+		{
+			Result.Append(Segment.Text);
+		}
+		else if (TokenValues[Idx])
+		{
+			AppendFormatArg(Result, *TokenValues[Idx]);
+		}
+		else
+		{
+			// Unknown tokens are left untouched
+			Result.AppendChar(TEXT('{'));
+			Result.Append(Segment.Text);
+			Result.AppendChar(TEXT('}'));
+		}
+	}
+
+	return Result;
+}
 
 void FHoudiniStringResolver::GetTokensAsStringMap(TMap<FString,FString>& OutTokens) const
 {
@@ -42,6 +192,10 @@ void FHoudiniStringResolver::GetTokensAsStringMap(TMap<FString,FString>& OutToke
 FString FHoudiniStringResolver::SanitizeTokenValue(const FString& InValue)
 {
 	// Replace {} characters with __
+	int32 BraceIndex = INDEX_NONE;
+	if (!InValue.FindChar(TEXT('{'), BraceIndex) && !InValue.FindChar(TEXT('}'), BraceIndex))
+		return InValue;
+
 	FString OutString = InValue;
 	OutString.ReplaceInline(ANSI_TO_TCHAR("{"), ANSI_TO_TCHAR("__"));
 	OutString.ReplaceInline(ANSI_TO_TCHAR("}"), ANSI_TO_TCHAR("__"));
@@ -72,8 +226,16 @@ void FHoudiniStringResolver::SetTokensFromStringMap(const TMap<FString, FString>
 FString FHoudiniStringResolver::ResolveString(
 	const FString& InString) const
 {
-	const FString Result = FString::Format(*InString, CachedTokens);
-	return Result;
+	// Strings without braces are returned as is, without looking up their template
+	int32 BraceIndex = INDEX_NONE;
+	if (!InString.FindChar(TEXT('{'), BraceIndex) && !InString.FindChar(TEXT('}'), BraceIndex))
+		return InString;
+
+	const TSharedRef<const FHoudiniStringTemplate> Template = FHoudiniStringTemplate::FindOrCompile(InString);
+	if (!Template->bHasTokens)
+		return InString;
+
+	return Template->Resolve(CachedTokens);
 }
 
 //void FHoudiniStringResolver::SetCurrentWorld(UWorld* InWorld)
@@ -85,12 +247,12 @@ FString FHoudiniAttributeResolver::ResolveAttribute(
 	const FString& InAttrName,
 	const FString& InDefaultValue) const
 {
-	if (!CachedAttributes.Contains(InAttrName))
+	const FString* AttrStr = CachedAttributes.Find(InAttrName);
+	if (!AttrStr)
 	{
 		return ResolveString(InDefaultValue);
 	}
-	FString AttrStr = CachedAttributes.FindChecked(InAttrName);
-	return ResolveString(AttrStr);
+	return ResolveString(*AttrStr);
 }
 
 //FString FHoudiniStringResolver::GetTempFolderArgument() const
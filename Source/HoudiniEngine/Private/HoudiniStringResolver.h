@@ -30,6 +30,36 @@
 
 #include "HoudiniStringResolver.generated.h"
 
+// A template string (such as "{bake}/{hda_name}") split into literal and token segments.
+// Templates are compiled once per unique string and shared by all resolvers, so resolving the same
+// template for every output object of a cook/bake doesn't parse it again.
+// Follows the named argument rules of FString::Format: unknown tokens are left as is, and `{ `} are escaped braces.
+struct HOUDINIENGINE_API FHoudiniStringTemplate
+{
+	struct FSegment
+	{
+		// The literal text, or the name of the token
+		FString Text;
+		bool bIsToken = false;
+	};
+
+	TArray<FSegment> Segments;
+
+	// Total length of the literal segments
+	int32 LiteralLength = 0;
+
+	bool bHasTokens = false;
+
+	// Returns the compiled template for the given string, compiling it if needed
+	static TSharedRef<const FHoudiniStringTemplate> FindOrCompile(const FString& InTemplate);
+
+	// Substitutes the tokens in a single pre-sized buffer
+	FString Resolve(const TMap<FString, FStringFormatArg>& InTokens) const;
+
+	// Splits the template string in segments
+	void Compile(const FString& InTemplate);
+};
+
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniStringResolver
 {
@@ -0,0 +1,93 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniTempPackageTracker.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+FHoudiniTempPackageTracker::FHoudiniTempPackageTracker()
+{}
+
+FHoudiniTempPackageTracker::~FHoudiniTempPackageTracker()
+{}
+
+FHoudiniTempPackageTracker&
+FHoudiniTempPackageTracker::Get()
+{
+	static FHoudiniTempPackageTracker Tracker;
+	return Tracker;
+}
+
+void
+FHoudiniTempPackageTracker::AddTempPackage(const FGuid& InComponentGUID, const FString& InPackageName)
+{
+	if (!InComponentGUID.IsValid() || InPackageName.IsEmpty())
+		return;
+
+	const FName PackageName(*InPackageName);
+	CurrentCookPackages.FindOrAdd(InComponentGUID).Add(PackageName);
+
+	// The package is in use again (replaced assets keep their package name)
+	StalePackages.Remove(PackageName);
+}
+
+void
+FHoudiniTempPackageTracker::OnCookFinished(const FGuid& InComponentGUID)
+{
+	if (!InComponentGUID.IsValid())
+		return;
+
+	TSet<FName> NewPackages;
+	CurrentCookPackages.RemoveAndCopyValue(InComponentGUID, NewPackages);
+
+	// Cooks that didn't recreate any package (no output changes) still use the previous cook's packages
+	if (NewPackages.Num() <= 0)
+		return;
+
+	TSet<FName>& OldPackages = PreviousCookPackages.FindOrAdd(InComponentGUID);
+	for (const FName& OldPackage : OldPackages)
+	{
+		if (!NewPackages.Contains(OldPackage))
+			StalePackages.Add(OldPackage);
+	}
+
+	OldPackages = MoveTemp(NewPackages);
+}
+
+void
+FHoudiniTempPackageTracker::ConsumeStalePackages(TSet<FName>& OutPackageNames)
+{
+	OutPackageNames.Append(StalePackages);
+	StalePackages.Empty();
+}
+
+void
+FHoudiniTempPackageTracker::Reset()
+{
+	CurrentCookPackages.Empty();
+	PreviousCookPackages.Empty();
+	StalePackages.Empty();
+}
@@ -0,0 +1,70 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Keeps track of the temporary packages created by the cooks of each component, so that the packages
+// that were only used by previous cooks can be reclaimed incrementally instead of scanning the whole
+// temporary cook folders. Packages become stale candidates when the next cook of their component finishes
+// without recreating them: they still have to be checked for references before being deleted.
+class HOUDINIENGINE_API FHoudiniTempPackageTracker
+{
+	public:
+
+		FHoudiniTempPackageTracker();
+		~FHoudiniTempPackageTracker();
+
+		static FHoudiniTempPackageTracker& Get();
+
+		// Records a temporary package created while cooking the component
+		void AddTempPackage(const FGuid& InComponentGUID, const FString& InPackageName);
+
+		// Called when a cook of the component has finished: the packages created by its previous cook
+		// that haven't been recreated by this one become stale
+		void OnCookFinished(const FGuid& InComponentGUID);
+
+		// Returns true if there are stale packages waiting to be reclaimed
+		bool HasStalePackages() const { return StalePackages.Num() > 0; };
+
+		// Moves the stale packages to OutPackageNames
+		void ConsumeStalePackages(TSet<FName>& OutPackageNames);
+
+		// Forget all the tracked packages
+		void Reset();
+
+	protected:
+
+		// Packages created by the cook in progress, per component
+		TMap<FGuid, TSet<FName>> CurrentCookPackages;
+
+		// Packages created by the last finished cook, per component
+		TMap<FGuid, TSet<FName>> PreviousCookPackages;
+
+		// Packages that are no longer used by the cooks that created them
+		TSet<FName> StalePackages;
+};
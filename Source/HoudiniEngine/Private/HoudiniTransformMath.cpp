@@ -0,0 +1,392 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniTransformMath.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Math/QuatRotationTranslationMatrix.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineValidateTransformMath(
+	TEXT("HoudiniEngine.ValidateTransformMath"),
+	0,
+	TEXT("Compares the native transform conversions with the HAPI ones, and logs the differences.\n")
+	TEXT("0: Disabled (Default)\n")
+	TEXT("1: Enabled\n")
+);
+
+namespace
+{
+	// Tolerance used when comparing the native conversions with HAPI's
+	const float TransformMathValidationTolerance = 1.0e-3f;
+
+	bool HasShear(const float InShear[3])
+	{
+		return !FMath::IsNearlyZero(InShear[0]) || !FMath::IsNearlyZero(InShear[1]) || !FMath::IsNearlyZero(InShear[2]);
+	}
+
+	// Axis indices, in the order they are applied
+	void GetRotationAxes(const HAPI_XYZOrder& InXYZOrder, int32 OutAxes[3])
+	{
+		static const int32 Axes[6][3] = {
+			{ 0, 1, 2 },	// HAPI_XYZ
+			{ 0, 2, 1 },	// HAPI_XZY
+			{ 1, 0, 2 },	// HAPI_YXZ
+			{ 1, 2, 0 },	// HAPI_YZX
+			{ 2, 0, 1 },	// HAPI_ZXY
+			{ 2, 1, 0 }		// HAPI_ZYX
+		};
+
+		const int32 Order = FMath::Clamp((int32)InXYZOrder, 0, 5);
+		OutAxes[0] = Axes[Order][0];
+		OutAxes[1] = Axes[Order][1];
+		OutAxes[2] = Axes[Order][2];
+	}
+
+	// Transform components (T = 0, R = 1, S = 2), in the order they are applied
+	void GetComponentOrder(const HAPI_RSTOrder& InRSTOrder, int32 OutComponents[3])
+	{
+		static const int32 Components[6][3] = {
+			{ 0, 1, 2 },	// HAPI_TRS
+			{ 0, 2, 1 },	// HAPI_TSR
+			{ 1, 0, 2 },	// HAPI_RTS
+			{ 1, 2, 0 },	// HAPI_RST
+			{ 2, 0, 1 },	// HAPI_STR
+			{ 2, 1, 0 }		// HAPI_SRT
+		};
+
+		const int32 Order = FMath::Clamp((int32)InRSTOrder, 0, 5);
+		OutComponents[0] = Components[Order][0];
+		OutComponents[1] = Components[Order][1];
+		OutComponents[2] = Components[Order][2];
+	}
+
+	// Rotation around a single axis, for row vectors
+	FMatrix AxisRotationMatrix(const int32& InAxis, const float& InRadians)
+	{
+		float S, C;
+		FMath::SinCos(&S, &C, InRadians);
+
+		FMatrix Rotation = FMatrix::Identity;
+		const int32 A = (InAxis + 1) % 3;
+		const int32 B = (InAxis + 2) % 3;
+		Rotation.M[A][A] = C;
+		Rotation.M[A][B] = S;
+		Rotation.M[B][A] = -S;
+		Rotation.M[B][B] = C;
+
+		return Rotation;
+	}
+
+	FMatrix ToFMatrix(const float InMatrix[16])
+	{
+		FMatrix Matrix;
+		for (int32 Row = 0; Row < 4; Row++)
+		{
+			for (int32 Col = 0; Col < 4; Col++)
+				Matrix.M[Row][Col] = InMatrix[Row * 4 + Col];
+		}
+
+		return Matrix;
+	}
+
+	void FromFMatrix(const FMatrix& InMatrix, float OutMatrix[16])
+	{
+		for (int32 Row = 0; Row < 4; Row++)
+		{
+			for (int32 Col = 0; Col < 4; Col++)
+				OutMatrix[Row * 4 + Col] = InMatrix.M[Row][Col];
+		}
+	}
+}
+
+FMatrix
+FHoudiniTransformMath::EulerToRotationMatrix(const float InDegrees[3], const HAPI_XYZOrder& InXYZOrder)
+{
+	int32 Axes[3];
+	GetRotationAxes(InXYZOrder, Axes);
+
+	// With row vectors, the first rotation applied is the leftmost one
+	FMatrix Rotation = AxisRotationMatrix(Axes[0], FMath::DegreesToRadians(InDegrees[Axes[0]]));
+	Rotation = Rotation * AxisRotationMatrix(Axes[1], FMath::DegreesToRadians(InDegrees[Axes[1]]));
+	Rotation = Rotation * AxisRotationMatrix(Axes[2], FMath::DegreesToRadians(InDegrees[Axes[2]]));
+
+	return Rotation;
+}
+
+void
+FHoudiniTransformMath::RotationMatrixToEuler(const FMatrix& InRotation, const HAPI_XYZOrder& InXYZOrder, float OutRadians[3])
+{
+	// Rotations around fixed axes I, then J, then K.
+	// Work on the column vector form of the matrix (its transpose): M = Rk * Rj * Ri
+	int32 Axes[3];
+	GetRotationAxes(InXYZOrder, Axes);
+	const int32 I = Axes[0];
+	const int32 J = Axes[1];
+	const int32 K = Axes[2];
+
+	// Orders that aren't a cyclic permutation of XYZ have an odd parity
+	const bool bOddParity = (J != (I + 1) % 3);
+
+	auto M = [&InRotation](const int32& Row, const int32& Col) { return InRotation.M[Col][Row]; };
+
+	float AngleI, AngleJ, AngleK;
+	const float CosJ = FMath::Sqrt(M(I, I) * M(I, I) + M(J, I) * M(J, I));
+	if (CosJ > 16.0f * FLT_EPSILON)
+	{
+		AngleI = FMath::Atan2(M(K, J), M(K, K));
+		AngleJ = FMath::Atan2(-M(K, I), CosJ);
+		AngleK = FMath::Atan2(M(J, I), M(I, I));
+	}
+	else
+	{
+		// Gimbal lock, put all the rotation on the first axis
+		AngleI = FMath::Atan2(-M(J, K), M(J, J));
+		AngleJ = FMath::Atan2(-M(K, I), CosJ);
+		AngleK = 0.0f;
+	}
+
+	if (bOddParity)
+	{
+		AngleI = -AngleI;
+		AngleJ = -AngleJ;
+		AngleK = -AngleK;
+	}
+
+	OutRadians[I] = AngleI;
+	OutRadians[J] = AngleJ;
+	OutRadians[K] = AngleK;
+}
+
+FMatrix
+FHoudiniTransformMath::ComposeMatrix(const FVector& InTranslation, const FMatrix& InRotation, const FVector& InScale, const HAPI_RSTOrder& InRSTOrder)
+{
+	const FMatrix ComponentMatrices[3] = { FTranslationMatrix(InTranslation), InRotation, FScaleMatrix(InScale) };
+
+	int32 Components[3];
+	GetComponentOrder(InRSTOrder, Components);
+
+	// With row vectors, the first component applied is the leftmost one
+	return ComponentMatrices[Components[0]] * ComponentMatrices[Components[1]] * ComponentMatrices[Components[2]];
+}
+
+bool
+FHoudiniTransformMath::DecomposeMatrix(const FMatrix& InMatrix, const HAPI_RSTOrder& InRSTOrder, FVector& OutTranslation, FMatrix& OutRotation, FVector& OutScale)
+{
+	int32 Components[3];
+	GetComponentOrder(InRSTOrder, Components);
+
+	const int32 TranslationIdx = Components[0] == 0 ? 0 : (Components[1] == 0 ? 1 : 2);
+	const int32 RotationIdx = Components[0] == 1 ? 0 : (Components[1] == 1 ? 1 : 2);
+	const int32 ScaleIdx = Components[0] == 2 ? 0 : (Components[1] == 2 ? 1 : 2);
+
+	// The translation doesn't affect the 3x3 part, which is either S * R or R * S
+	const bool bScaleFirst = ScaleIdx < RotationIdx;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		// S * R scales the rows of R, R * S scales its columns
+		const FVector Vector = bScaleFirst
+			? FVector(InMatrix.M[Axis][0], InMatrix.M[Axis][1], InMatrix.M[Axis][2])
+			: FVector(InMatrix.M[0][Axis], InMatrix.M[1][Axis], InMatrix.M[2][Axis]);
+		OutScale[Axis] = Vector.Size();
+	}
+
+	if (OutScale.X <= SMALL_NUMBER || OutScale.Y <= SMALL_NUMBER || OutScale.Z <= SMALL_NUMBER)
+		return false;
+
+	// Mirrored matrices get a negative X scale
+	if (InMatrix.RotDeterminant() < 0.0f)
+		OutScale.X = -OutScale.X;
+
+	OutRotation = FMatrix::Identity;
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Col = 0; Col < 3; Col++)
+			OutRotation.M[Row][Col] = InMatrix.M[Row][Col] / OutScale[bScaleFirst ? Row : Col];
+	}
+
+	// The last row is the translation transformed by the components applied after it
+	FMatrix AppliedAfterTranslation = FMatrix::Identity;
+	for (int32 Idx = TranslationIdx + 1; Idx < 3; Idx++)
+		AppliedAfterTranslation = AppliedAfterTranslation * (Components[Idx] == 1 ? OutRotation : FScaleMatrix(OutScale));
+
+	const FVector LastRow(InMatrix.M[3][0], InMatrix.M[3][1], InMatrix.M[3][2]);
+	OutTranslation = AppliedAfterTranslation.InverseFast().TransformVector(LastRow);
+
+	return true;
+}
+
+bool
+FHoudiniTransformMath::TransformEulerToMatrix(const HAPI_TransformEuler& InTransform, float OutMatrix[16])
+{
+	if (HasShear(InTransform.shear))
+		return false;
+
+	const FMatrix Rotation = EulerToRotationMatrix(InTransform.rotationEuler, InTransform.rotationOrder);
+	const FVector Translation(InTransform.position[0], InTransform.position[1], InTransform.position[2]);
+	const FVector Scale(InTransform.scale[0], InTransform.scale[1], InTransform.scale[2]);
+
+	FromFMatrix(ComposeMatrix(Translation, Rotation, Scale, InTransform.rstOrder), OutMatrix);
+	return true;
+}
+
+bool
+FHoudiniTransformMath::TransformQuatToMatrix(const HAPI_Transform& InTransform, float OutMatrix[16])
+{
+	if (HasShear(InTransform.shear))
+		return false;
+
+	const FQuat Quat(
+		InTransform.rotationQuaternion[0], InTransform.rotationQuaternion[1],
+		InTransform.rotationQuaternion[2], InTransform.rotationQuaternion[3]);
+	const FMatrix Rotation = FQuatRotationMatrix(Quat.GetNormalized());
+	const FVector Translation(InTransform.position[0], InTransform.position[1], InTransform.position[2]);
+	const FVector Scale(InTransform.scale[0], InTransform.scale[1], InTransform.scale[2]);
+
+	FromFMatrix(ComposeMatrix(Translation, Rotation, Scale, InTransform.rstOrder), OutMatrix);
+	return true;
+}
+
+bool
+FHoudiniTransformMath::MatrixToQuat(const float InMatrix[16], const HAPI_RSTOrder& InRSTOrder, HAPI_Transform& OutTransform)
+{
+	FVector Translation, Scale;
+	FMatrix Rotation;
+	if (!DecomposeMatrix(ToFMatrix(InMatrix), InRSTOrder, Translation, Rotation, Scale))
+		return false;
+
+	const FQuat Quat(Rotation);
+
+	FMemory::Memzero<HAPI_Transform>(OutTransform);
+	OutTransform.rstOrder = InRSTOrder;
+	for (int32 Idx = 0; Idx < 3; Idx++)
+	{
+		OutTransform.position[Idx] = Translation[Idx];
+		OutTransform.scale[Idx] = Scale[Idx];
+	}
+
+	OutTransform.rotationQuaternion[0] = Quat.X;
+	OutTransform.rotationQuaternion[1] = Quat.Y;
+	OutTransform.rotationQuaternion[2] = Quat.Z;
+	OutTransform.rotationQuaternion[3] = Quat.W;
+
+	return true;
+}
+
+bool
+FHoudiniTransformMath::MatrixToEuler(
+	const float InMatrix[16], const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder, HAPI_TransformEuler& OutTransform)
+{
+	FVector Translation, Scale;
+	FMatrix Rotation;
+	if (!DecomposeMatrix(ToFMatrix(InMatrix), InRSTOrder, Translation, Rotation, Scale))
+		return false;
+
+	FMemory::Memzero<HAPI_TransformEuler>(OutTransform);
+	OutTransform.rstOrder = InRSTOrder;
+	OutTransform.rotationOrder = InXYZOrder;
+	for (int32 Idx = 0; Idx < 3; Idx++)
+	{
+		OutTransform.position[Idx] = Translation[Idx];
+		OutTransform.scale[Idx] = Scale[Idx];
+	}
+
+	RotationMatrixToEuler(Rotation, InXYZOrder, OutTransform.rotationEuler);
+
+	return true;
+}
+
+bool
+FHoudiniTransformMath::TransformEulerToQuat(const HAPI_TransformEuler& InTransform, const HAPI_RSTOrder& InRSTOrder, HAPI_Transform& OutTransform)
+{
+	float Matrix[16];
+	if (!TransformEulerToMatrix(InTransform, Matrix))
+		return false;
+
+	return MatrixToQuat(Matrix, InRSTOrder, OutTransform);
+}
+
+bool
+FHoudiniTransformMath::TransformQuatToEuler(
+	const HAPI_Transform& InTransform, const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder, HAPI_TransformEuler& OutTransform)
+{
+	float Matrix[16];
+	if (!TransformQuatToMatrix(InTransform, Matrix))
+		return false;
+
+	return MatrixToEuler(Matrix, InRSTOrder, InXYZOrder, OutTransform);
+}
+
+bool
+FHoudiniTransformMath::TransformEulerToQuat(
+	const TArray<HAPI_TransformEuler>& InTransforms, const HAPI_RSTOrder& InRSTOrder, TArray<HAPI_Transform>& OutTransforms)
+{
+	OutTransforms.SetNumUninitialized(InTransforms.Num());
+
+	bool bSuccess = true;
+	for (int32 Idx = 0; Idx < InTransforms.Num(); Idx++)
+		bSuccess &= TransformEulerToQuat(InTransforms[Idx], InRSTOrder, OutTransforms[Idx]);
+
+	return bSuccess;
+}
+
+bool
+FHoudiniTransformMath::TransformQuatToEuler(
+	const TArray<HAPI_Transform>& InTransforms, const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder, TArray<HAPI_TransformEuler>& OutTransforms)
+{
+	OutTransforms.SetNumUninitialized(InTransforms.Num());
+
+	bool bSuccess = true;
+	for (int32 Idx = 0; Idx < InTransforms.Num(); Idx++)
+		bSuccess &= TransformQuatToEuler(InTransforms[Idx], InRSTOrder, InXYZOrder, OutTransforms[Idx]);
+
+	return bSuccess;
+}
+
+bool
+FHoudiniTransformMath::IsValidationEnabled()
+{
+	return CVarHoudiniEngineValidateTransformMath.GetValueOnAnyThread() > 0;
+}
+
+bool
+FHoudiniTransformMath::ValidateMatrix(const float InNativeMatrix[16], const float InHapiMatrix[16], const TCHAR* InContext)
+{
+	for (int32 Idx = 0; Idx < 16; Idx++)
+	{
+		// Compare relatively to the magnitude of the values (translations can be large)
+		const float Tolerance = TransformMathValidationTolerance * FMath::Max(1.0f, FMath::Abs(InHapiMatrix[Idx]));
+		if (FMath::IsNearlyEqual(InNativeMatrix[Idx], InHapiMatrix[Idx], Tolerance))
+			continue;
+
+		HOUDINI_LOG_WARNING(TEXT("%s: the native transform conversion differs from HAPI's (element %d: %f instead of %f)."),
+			InContext, Idx, InNativeMatrix[Idx], InHapiMatrix[Idx]);
+		return false;
+	}
+
+	return true;
+}
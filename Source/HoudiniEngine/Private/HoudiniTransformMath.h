@@ -0,0 +1,90 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "HAPI/HAPI_Common.h"
+
+#include "CoreMinimal.h"
+
+// Native implementation of the HAPI transform conversion functions (HAPI_ConvertTransformEulerToMatrix,
+// HAPI_ConvertTransformQuatToMatrix, HAPI_ConvertMatrixToQuat and HAPI_ConvertMatrixToEuler), so that converting
+// transforms doesn't require a round trip to the Houdini Engine session.
+// All the HAPI_RSTOrder and HAPI_XYZOrder combinations are supported, the transforms are in Houdini's space.
+// As with HAPI: matrices are row-major and use row vectors (translation in the last row), Euler rotations are in
+// degrees when converted to matrices, but are returned in radians when converted from matrices.
+// Shears are not supported: the conversions fail if a transform has shears, so the caller can fall back to HAPI.
+struct HOUDINIENGINE_API FHoudiniTransformMath
+{
+	public:
+
+		// Equivalent of HAPI_ConvertTransformEulerToMatrix
+		static bool TransformEulerToMatrix(const HAPI_TransformEuler& InTransform, float OutMatrix[16]);
+
+		// Equivalent of HAPI_ConvertTransformQuatToMatrix
+		static bool TransformQuatToMatrix(const HAPI_Transform& InTransform, float OutMatrix[16]);
+
+		// Equivalent of HAPI_ConvertMatrixToQuat
+		static bool MatrixToQuat(const float InMatrix[16], const HAPI_RSTOrder& InRSTOrder, HAPI_Transform& OutTransform);
+
+		// Equivalent of HAPI_ConvertMatrixToEuler (the rotations are returned in radians)
+		static bool MatrixToEuler(
+			const float InMatrix[16], const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder, HAPI_TransformEuler& OutTransform);
+
+		// Converts an Euler transform to a quaternion transform with the given RST order
+		static bool TransformEulerToQuat(const HAPI_TransformEuler& InTransform, const HAPI_RSTOrder& InRSTOrder, HAPI_Transform& OutTransform);
+
+		// Converts a quaternion transform to an Euler transform with the given orders (the rotations are returned in radians)
+		static bool TransformQuatToEuler(
+			const HAPI_Transform& InTransform, const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder, HAPI_TransformEuler& OutTransform);
+
+		// Batch versions of the above, returns false if any of the transforms couldn't be converted.
+		// They replace one HAPI_ConvertTransform round trip per element when arrays of transforms are converted.
+		static bool TransformEulerToQuat(
+			const TArray<HAPI_TransformEuler>& InTransforms, const HAPI_RSTOrder& InRSTOrder, TArray<HAPI_Transform>& OutTransforms);
+		static bool TransformQuatToEuler(
+			const TArray<HAPI_Transform>& InTransforms, const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder, TArray<HAPI_TransformEuler>& OutTransforms);
+
+		// Returns true if the native conversions should be compared with HAPI's (HoudiniEngine.ValidateTransformMath)
+		static bool IsValidationEnabled();
+
+		// Logs a warning if the matrices differ, used to validate the native conversions against HAPI
+		static bool ValidateMatrix(const float InNativeMatrix[16], const float InHapiMatrix[16], const TCHAR* InContext);
+
+	protected:
+
+		// Builds a (row vector) matrix from its components, applied in the given order
+		static FMatrix ComposeMatrix(const FVector& InTranslation, const FMatrix& InRotation, const FVector& InScale, const HAPI_RSTOrder& InRSTOrder);
+
+		// Extracts the components of a matrix that was built with the given order
+		static bool DecomposeMatrix(const FMatrix& InMatrix, const HAPI_RSTOrder& InRSTOrder, FVector& OutTranslation, FMatrix& OutRotation, FVector& OutScale);
+
+		// Builds the rotation matrix of Euler angles in degrees
+		static FMatrix EulerToRotationMatrix(const float InDegrees[3], const HAPI_XYZOrder& InXYZOrder);
+
+		// Extracts the Euler angles, in radians, of a rotation matrix
+		static void RotationMatrixToEuler(const FMatrix& InRotation, const HAPI_XYZOrder& InXYZOrder, float OutRadians[3]);
+};
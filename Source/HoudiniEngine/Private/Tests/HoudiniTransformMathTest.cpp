@@ -0,0 +1,327 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniTransformMath.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Tolerance used to compare the matrices, relative to the magnitude of the expected values
+	const float TransformMathTestTolerance = 1.0e-4f;
+
+	// The reference matrices below were NOT recorded from HAPI: they were generated by a standalone script that
+	// applies the scale, rotation (one axis at a time) and translation to points step by step, following HAPI's
+	// conventions (row vectors, right-handed rotations in degrees, components and axes applied in the given order).
+	// They are self-consistency checks of the native conversions and should be compared with the output of
+	// HAPI_ConvertTransformEulerToMatrix / HAPI_ConvertTransformQuatToMatrix when a session is available.
+
+	// Matrices for each [HAPI_RSTOrder][HAPI_XYZOrder] with:
+	// position (1.5, -2, 3.25), rotation (30, -45, 60) degrees, scale (2, 0.5, 1.25)
+	const float EulerReferenceMatrices[6][6][16] = {
+		{
+			{ 0.707107f, 0.306186f, 0.883883f, 0.000000f, -1.853553f, 0.063413f, 0.441942f, 0.000000f, 0.253653f, -0.390165f, 0.765466f, 0.000000f, 5.592139f, -0.935584f, 2.929705f, 1.000000f },	// HAPI_TRS, HAPI_XYZ
+			{ 0.707107f, 0.433013f, 0.441942f, 0.000000f, -1.767767f, 0.216506f, -0.220971f, 0.000000f, -0.612372f, -0.125000f, 1.148198f, 0.000000f, 2.605984f, -0.189744f, 4.836499f, 1.000000f },	// HAPI_TRS, HAPI_XZY
+			{ 1.319479f, 0.217798f, 0.765466f, 0.000000f, -1.500000f, 0.216506f, 0.625000f, 0.000000f, -0.094734f, -0.394575f, 0.765466f, 0.000000f, 4.671332f, -1.388683f, 2.385961f, 1.000000f },	// HAPI_TRS, HAPI_YXZ
+			{ 0.707107f, 0.088388f, 1.148198f, 0.000000f, -1.732051f, 0.216506f, 0.312500f, 0.000000f, -0.707107f, -0.441942f, 0.382733f, 0.000000f, 2.226665f, -1.736741f, 2.341179f, 1.000000f },	// HAPI_TRS, HAPI_YZX
+			{ 0.094734f, 0.375000f, 0.824675f, 0.000000f, -1.578298f, 0.216506f, -0.544495f, 0.000000f, -1.224745f, -0.250000f, 0.765466f, 0.000000f, -0.681723f, -0.683013f, 4.813764f, 1.000000f },	// HAPI_TRS, HAPI_ZXY
+			{ 0.707107f, 0.286612f, 0.923999f, 0.000000f, -1.224745f, 0.369599f, -0.350413f, 0.000000f, -1.414214f, -0.176777f, 0.765466f, 0.000000f, -1.086044f, -0.883806f, 4.574586f, 1.000000f }	// HAPI_TRS, HAPI_ZYX
+		},
+		{
+			{ 0.707107f, 1.224745f, 1.414214f, 0.000000f, -0.463388f, 0.063413f, 0.176777f, 0.000000f, 0.158533f, -0.975413f, 0.765466f, 0.000000f, 2.502669f, -1.459800f, 4.255530f, 1.000000f },	// HAPI_TSR, HAPI_XYZ
+			{ 0.707107f, 1.732051f, 0.707107f, 0.000000f, -0.441942f, 0.216506f, -0.088388f, 0.000000f, -0.382733f, -0.312500f, 1.148198f, 0.000000f, 0.700662f, 1.149439f, 4.969081f, 1.000000f },	// HAPI_TSR, HAPI_XZY
+			{ 1.319479f, 0.871191f, 1.224745f, 0.000000f, -0.375000f, 0.216506f, 0.250000f, 0.000000f, -0.059209f, -0.986436f, 0.765466f, 0.000000f, 2.536790f, -2.332144f, 3.824880f, 1.000000f },	// HAPI_TSR, HAPI_YXZ
+			{ 0.707107f, 0.353553f, 1.837117f, 0.000000f, -0.433013f, 0.216506f, 0.125000f, 0.000000f, -0.441942f, -1.104854f, 0.382733f, 0.000000f, 0.490375f, -3.493459f, 3.749557f, 1.000000f },	// HAPI_TSR, HAPI_YZX
+			{ 0.094734f, 1.500000f, 1.319479f, 0.000000f, -0.394575f, 0.216506f, -0.217798f, 0.000000f, -0.765466f, -0.625000f, 0.765466f, 0.000000f, -1.556512f, -0.214263f, 4.902578f, 1.000000f },	// HAPI_TSR, HAPI_ZXY
+			{ 0.707107f, 1.146447f, 1.478398f, 0.000000f, -0.306186f, 0.369599f, -0.140165f, 0.000000f, -0.883883f, -0.441942f, 0.765466f, 0.000000f, -1.199589f, -0.455840f, 4.985690f, 1.000000f }	// HAPI_TSR, HAPI_ZYX
+		},
+		{
+			{ 0.707107f, 0.306186f, 0.883883f, 0.000000f, -1.853553f, 0.063413f, 0.441942f, 0.000000f, 0.253653f, -0.390165f, 0.765466f, 0.000000f, 3.000000f, -1.000000f, 4.062500f, 1.000000f },	// HAPI_RTS, HAPI_XYZ
+			{ 0.707107f, 0.433013f, 0.441942f, 0.000000f, -1.767767f, 0.216506f, -0.220971f, 0.000000f, -0.612372f, -0.125000f, 1.148198f, 0.000000f, 3.000000f, -1.000000f, 4.062500f, 1.000000f },	// HAPI_RTS, HAPI_XZY
+			{ 1.319479f, 0.217798f, 0.765466f, 0.000000f, -1.500000f, 0.216506f, 0.625000f, 0.000000f, -0.094734f, -0.394575f, 0.765466f, 0.000000f, 3.000000f, -1.000000f, 4.062500f, 1.000000f },	// HAPI_RTS, HAPI_YXZ
+			{ 0.707107f, 0.088388f, 1.148198f, 0.000000f, -1.732051f, 0.216506f, 0.312500f, 0.000000f, -0.707107f, -0.441942f, 0.382733f, 0.000000f, 3.000000f, -1.000000f, 4.062500f, 1.000000f },	// HAPI_RTS, HAPI_YZX
+			{ 0.094734f, 0.375000f, 0.824675f, 0.000000f, -1.578298f, 0.216506f, -0.544495f, 0.000000f, -1.224745f, -0.250000f, 0.765466f, 0.000000f, 3.000000f, -1.000000f, 4.062500f, 1.000000f },	// HAPI_RTS, HAPI_ZXY
+			{ 0.707107f, 0.286612f, 0.923999f, 0.000000f, -1.224745f, 0.369599f, -0.350413f, 0.000000f, -1.414214f, -0.176777f, 0.765466f, 0.000000f, 3.000000f, -1.000000f, 4.062500f, 1.000000f }	// HAPI_RTS, HAPI_ZYX
+		},
+		{
+			{ 0.707107f, 0.306186f, 0.883883f, 0.000000f, -1.853553f, 0.063413f, 0.441942f, 0.000000f, 0.253653f, -0.390165f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_RST, HAPI_XYZ
+			{ 0.707107f, 0.433013f, 0.441942f, 0.000000f, -1.767767f, 0.216506f, -0.220971f, 0.000000f, -0.612372f, -0.125000f, 1.148198f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_RST, HAPI_XZY
+			{ 1.319479f, 0.217798f, 0.765466f, 0.000000f, -1.500000f, 0.216506f, 0.625000f, 0.000000f, -0.094734f, -0.394575f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_RST, HAPI_YXZ
+			{ 0.707107f, 0.088388f, 1.148198f, 0.000000f, -1.732051f, 0.216506f, 0.312500f, 0.000000f, -0.707107f, -0.441942f, 0.382733f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_RST, HAPI_YZX
+			{ 0.094734f, 0.375000f, 0.824675f, 0.000000f, -1.578298f, 0.216506f, -0.544495f, 0.000000f, -1.224745f, -0.250000f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_RST, HAPI_ZXY
+			{ 0.707107f, 0.286612f, 0.923999f, 0.000000f, -1.224745f, 0.369599f, -0.350413f, 0.000000f, -1.414214f, -0.176777f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f }	// HAPI_RST, HAPI_ZYX
+		},
+		{
+			{ 0.707107f, 1.224745f, 1.414214f, 0.000000f, -0.463388f, 0.063413f, 0.176777f, 0.000000f, 0.158533f, -0.975413f, 0.765466f, 0.000000f, 2.796070f, -1.871167f, 2.343764f, 1.000000f },	// HAPI_STR, HAPI_XYZ
+			{ 0.707107f, 1.732051f, 0.707107f, 0.000000f, -0.441942f, 0.216506f, -0.088388f, 0.000000f, -0.382733f, -0.312500f, 1.148198f, 0.000000f, 1.302992f, -0.379487f, 3.869199f, 1.000000f },	// HAPI_STR, HAPI_XZY
+			{ 1.319479f, 0.871191f, 1.224745f, 0.000000f, -0.375000f, 0.216506f, 0.250000f, 0.000000f, -0.059209f, -0.986436f, 0.765466f, 0.000000f, 2.335666f, -2.777366f, 1.908769f, 1.000000f },	// HAPI_STR, HAPI_YXZ
+			{ 0.707107f, 0.353553f, 1.837117f, 0.000000f, -0.433013f, 0.216506f, 0.125000f, 0.000000f, -0.441942f, -1.104854f, 0.382733f, 0.000000f, 1.113332f, -3.473482f, 1.872943f, 1.000000f },	// HAPI_STR, HAPI_YZX
+			{ 0.094734f, 1.500000f, 1.319479f, 0.000000f, -0.394575f, 0.216506f, -0.217798f, 0.000000f, -0.765466f, -0.625000f, 0.765466f, 0.000000f, -0.340861f, -1.366025f, 3.851011f, 1.000000f },	// HAPI_STR, HAPI_ZXY
+			{ 0.707107f, 1.146447f, 1.478398f, 0.000000f, -0.306186f, 0.369599f, -0.140165f, 0.000000f, -0.883883f, -0.441942f, 0.765466f, 0.000000f, -0.543022f, -1.767611f, 3.659669f, 1.000000f }	// HAPI_STR, HAPI_ZYX
+		},
+		{
+			{ 0.707107f, 1.224745f, 1.414214f, 0.000000f, -0.463388f, 0.063413f, 0.176777f, 0.000000f, 0.158533f, -0.975413f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_SRT, HAPI_XYZ
+			{ 0.707107f, 1.732051f, 0.707107f, 0.000000f, -0.441942f, 0.216506f, -0.088388f, 0.000000f, -0.382733f, -0.312500f, 1.148198f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_SRT, HAPI_XZY
+			{ 1.319479f, 0.871191f, 1.224745f, 0.000000f, -0.375000f, 0.216506f, 0.250000f, 0.000000f, -0.059209f, -0.986436f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_SRT, HAPI_YXZ
+			{ 0.707107f, 0.353553f, 1.837117f, 0.000000f, -0.433013f, 0.216506f, 0.125000f, 0.000000f, -0.441942f, -1.104854f, 0.382733f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_SRT, HAPI_YZX
+			{ 0.094734f, 1.500000f, 1.319479f, 0.000000f, -0.394575f, 0.216506f, -0.217798f, 0.000000f, -0.765466f, -0.625000f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f },	// HAPI_SRT, HAPI_ZXY
+			{ 0.707107f, 1.146447f, 1.478398f, 0.000000f, -0.306186f, 0.369599f, -0.140165f, 0.000000f, -0.883883f, -0.441942f, 0.765466f, 0.000000f, 1.500000f, -2.000000f, 3.250000f, 1.000000f }	// HAPI_SRT, HAPI_ZYX
+		}
+	};
+
+	// Matrix for: position (4, 5, -6), rotation (15, 25, -35) degrees, scale (1.5, -2, 0.75), HAPI_SRT, HAPI_ZXY
+	const float MirroredReferenceMatrix[16] = { 1.019498f, -0.831048f, -0.721098f, 0.000000f, -1.218874f, -1.582480f, 0.100511f, 0.000000f, 0.306163f, -0.194114f, 0.656570f, 0.000000f, 4.000000f, 5.000000f, -6.000000f, 1.000000f };
+
+	// Matrix for: position (0, 1, 2), rotation (10, 90, 20) degrees, scale (1, 1, 1), HAPI_SRT, HAPI_XYZ
+	const float GimbalLockReferenceMatrix[16] = { 0.000000f, 0.000000f, -1.000000f, 0.000000f, -0.173648f, 0.984808f, 0.000000f, 0.000000f, 0.984808f, 0.173648f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 2.000000f, 1.000000f };
+
+	// Matrix for: position (-1, 2.5, 7), quaternion (0.1, -0.3, 0.5, 0.8), scale (3, 1, 0.5), HAPI_TRS
+	const float QuatReferenceMatrix[16] = { 0.939394f, 0.747475f, 0.292929f, 0.000000f, -2.606061f, 0.474747f, -0.070707f, 0.000000f, -1.151515f, -0.464646f, 0.398990f, 0.000000f, -15.515152f, -2.813131f, 2.323232f, 1.000000f };
+
+	HAPI_TransformEuler MakeTransformEuler(
+		const FVector& InPosition, const FVector& InRotation, const FVector& InScale, const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder)
+	{
+		HAPI_TransformEuler Transform;
+		FMemory::Memzero<HAPI_TransformEuler>(Transform);
+		for (int32 Idx = 0; Idx < 3; Idx++)
+		{
+			Transform.position[Idx] = InPosition[Idx];
+			Transform.rotationEuler[Idx] = InRotation[Idx];
+			Transform.scale[Idx] = InScale[Idx];
+		}
+		Transform.rstOrder = InRSTOrder;
+		Transform.rotationOrder = InXYZOrder;
+
+		return Transform;
+	}
+
+	bool MatricesAreEqual(FAutomationTestBase& InTest, const FString& InContext, const float InMatrix[16], const float InExpectedMatrix[16])
+	{
+		for (int32 Idx = 0; Idx < 16; Idx++)
+		{
+			const float Tolerance = TransformMathTestTolerance * FMath::Max(1.0f, FMath::Abs(InExpectedMatrix[Idx]));
+			if (FMath::IsNearlyEqual(InMatrix[Idx], InExpectedMatrix[Idx], Tolerance))
+				continue;
+
+			InTest.AddError(FString::Printf(TEXT("%s: element %d is %f instead of %f."), *InContext, Idx, InMatrix[Idx], InExpectedMatrix[Idx]));
+			return false;
+		}
+
+		return true;
+	}
+
+	// Converts the matrix back to an Euler transform, and checks that it results in the same matrix
+	bool EulerRoundTripIsEqual(
+		FAutomationTestBase& InTest, const FString& InContext, const float InMatrix[16], 
+		const HAPI_RSTOrder& InRSTOrder, const HAPI_XYZOrder& InXYZOrder, HAPI_TransformEuler& OutTransform)
+	{
+		if (!FHoudiniTransformMath::MatrixToEuler(InMatrix, InRSTOrder, InXYZOrder, OutTransform))
+		{
+			InTest.AddError(FString::Printf(TEXT("%s: MatrixToEuler failed."), *InContext));
+			return false;
+		}
+
+		// MatrixToEuler returns radians, TransformEulerToMatrix expects degrees
+		HAPI_TransformEuler TransformDegrees = OutTransform;
+		for (int32 Idx = 0; Idx < 3; Idx++)
+			TransformDegrees.rotationEuler[Idx] = FMath::RadiansToDegrees(OutTransform.rotationEuler[Idx]);
+
+		float RoundTripMatrix[16];
+		if (!FHoudiniTransformMath::TransformEulerToMatrix(TransformDegrees, RoundTripMatrix))
+		{
+			InTest.AddError(FString::Printf(TEXT("%s: TransformEulerToMatrix failed."), *InContext));
+			return false;
+		}
+
+		return MatricesAreEqual(InTest, InContext + TEXT(" (round trip)"), RoundTripMatrix, InMatrix);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FHoudiniTransformMathTest, 
+	"Houdini.TransformMath", 
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool
+FHoudiniTransformMathTest::RunTest(const FString& Parameters)
+{
+	static const TCHAR* RSTOrderNames[6] = { TEXT("TRS"), TEXT("TSR"), TEXT("RTS"), TEXT("RST"), TEXT("STR"), TEXT("SRT") };
+	static const TCHAR* XYZOrderNames[6] = { TEXT("XYZ"), TEXT("XZY"), TEXT("YXZ"), TEXT("YZX"), TEXT("ZXY"), TEXT("ZYX") };
+
+	// All the RST / XYZ order combinations
+	const FVector Position(1.5f, -2.0f, 3.25f);
+	const FVector Rotation(30.0f, -45.0f, 60.0f);
+	const FVector Scale(2.0f, 0.5f, 1.25f);
+	for (int32 RSTIdx = 0; RSTIdx < 6; RSTIdx++)
+	{
+		for (int32 XYZIdx = 0; XYZIdx < 6; XYZIdx++)
+		{
+			const HAPI_RSTOrder RSTOrder = (HAPI_RSTOrder)RSTIdx;
+			const HAPI_XYZOrder XYZOrder = (HAPI_XYZOrder)XYZIdx;
+			const FString Context = FString::Printf(TEXT("HAPI_%s / HAPI_%s"), RSTOrderNames[RSTIdx], XYZOrderNames[XYZIdx]);
+
+			float Matrix[16];
+			const HAPI_TransformEuler Transform = MakeTransformEuler(Position, Rotation, Scale, RSTOrder, XYZOrder);
+			if (!TestTrue(Context + TEXT(": TransformEulerToMatrix"), FHoudiniTransformMath::TransformEulerToMatrix(Transform, Matrix)))
+				continue;
+
+			if (!MatricesAreEqual(*this, Context, Matrix, EulerReferenceMatrices[RSTIdx][XYZIdx]))
+				continue;
+
+			// Without mirroring or gimbal lock, the original components are recovered
+			HAPI_TransformEuler RoundTripTransform;
+			if (!EulerRoundTripIsEqual(*this, Context, Matrix, RSTOrder, XYZOrder, RoundTripTransform))
+				continue;
+
+			for (int32 Idx = 0; Idx < 3; Idx++)
+			{
+				TestEqual(Context + TEXT(": position"), RoundTripTransform.position[Idx], Position[Idx], TransformMathTestTolerance);
+				TestEqual(Context + TEXT(": rotation"), FMath::RadiansToDegrees(RoundTripTransform.rotationEuler[Idx]), Rotation[Idx], 1.0e-2f);
+				TestEqual(Context + TEXT(": scale"), RoundTripTransform.scale[Idx], Scale[Idx], TransformMathTestTolerance);
+			}
+		}
+	}
+
+	// Mirrored scale: the mirroring is moved to the X scale, but the matrix is preserved
+	{
+		const FString Context = TEXT("Mirrored scale");
+		float Matrix[16];
+		const HAPI_TransformEuler Transform = MakeTransformEuler(
+			FVector(4.0f, 5.0f, -6.0f), FVector(15.0f, 25.0f, -35.0f), FVector(1.5f, -2.0f, 0.75f), HAPI_SRT, HAPI_ZXY);
+		if (TestTrue(Context + TEXT(": TransformEulerToMatrix"), FHoudiniTransformMath::TransformEulerToMatrix(Transform, Matrix))
+			&& MatricesAreEqual(*this, Context, Matrix, MirroredReferenceMatrix))
+		{
+			HAPI_TransformEuler RoundTripTransform;
+			if (EulerRoundTripIsEqual(*this, Context, Matrix, HAPI_SRT, HAPI_ZXY, RoundTripTransform))
+				TestTrue(Context + TEXT(": negative X scale"), RoundTripTransform.scale[0] < 0.0f);
+		}
+	}
+
+	// Gimbal lock: the rotation is put on the first axis, but the matrix is preserved
+	{
+		const FString Context = TEXT("Gimbal lock");
+		float Matrix[16];
+		const HAPI_TransformEuler Transform = MakeTransformEuler(
+			FVector(0.0f, 1.0f, 2.0f), FVector(10.0f, 90.0f, 20.0f), FVector(1.0f, 1.0f, 1.0f), HAPI_SRT, HAPI_XYZ);
+		if (TestTrue(Context + TEXT(": TransformEulerToMatrix"), FHoudiniTransformMath::TransformEulerToMatrix(Transform, Matrix))
+			&& MatricesAreEqual(*this, Context, Matrix, GimbalLockReferenceMatrix))
+		{
+			HAPI_TransformEuler RoundTripTransform;
+			if (EulerRoundTripIsEqual(*this, Context, Matrix, HAPI_SRT, HAPI_XYZ, RoundTripTransform))
+			{
+				TestEqual(Context + TEXT(": Y rotation"), FMath::RadiansToDegrees(RoundTripTransform.rotationEuler[1]), 90.0f, 1.0e-2f);
+				TestEqual(Context + TEXT(": Z rotation"), RoundTripTransform.rotationEuler[2], 0.0f, TransformMathTestTolerance);
+			}
+		}
+	}
+
+	// Quaternions
+	{
+		const FString Context = TEXT("Quaternion");
+		HAPI_Transform Transform;
+		FMemory::Memzero<HAPI_Transform>(Transform);
+		const FVector Position(-1.0f, 2.5f, 7.0f);
+		const FQuat Quat(0.1f, -0.3f, 0.5f, 0.8f);
+		const FVector Scale(3.0f, 1.0f, 0.5f);
+		for (int32 Idx = 0; Idx < 3; Idx++)
+		{
+			Transform.position[Idx] = Position[Idx];
+			Transform.scale[Idx] = Scale[Idx];
+		}
+		Transform.rotationQuaternion[0] = Quat.X;
+		Transform.rotationQuaternion[1] = Quat.Y;
+		Transform.rotationQuaternion[2] = Quat.Z;
+		Transform.rotationQuaternion[3] = Quat.W;
+		Transform.rstOrder = HAPI_TRS;
+
+		float Matrix[16];
+		if (TestTrue(Context + TEXT(": TransformQuatToMatrix"), FHoudiniTransformMath::TransformQuatToMatrix(Transform, Matrix))
+			&& MatricesAreEqual(*this, Context, Matrix, QuatReferenceMatrix))
+		{
+			HAPI_Transform RoundTripTransform;
+			if (TestTrue(Context + TEXT(": MatrixToQuat"), FHoudiniTransformMath::MatrixToQuat(Matrix, HAPI_TRS, RoundTripTransform)))
+			{
+				const FQuat RoundTripQuat(
+					RoundTripTransform.rotationQuaternion[0], RoundTripTransform.rotationQuaternion[1],
+					RoundTripTransform.rotationQuaternion[2], RoundTripTransform.rotationQuaternion[3]);
+
+				// q and -q are the same rotation
+				TestTrue(Context + TEXT(": rotation"), RoundTripQuat.Equals(Quat.GetNormalized(), TransformMathTestTolerance)
+					|| RoundTripQuat.Equals(-Quat.GetNormalized(), TransformMathTestTolerance));
+
+				for (int32 Idx = 0; Idx < 3; Idx++)
+				{
+					TestEqual(Context + TEXT(": position"), RoundTripTransform.position[Idx], Position[Idx], TransformMathTestTolerance);
+					TestEqual(Context + TEXT(": scale"), RoundTripTransform.scale[Idx], Scale[Idx], TransformMathTestTolerance);
+				}
+			}
+		}
+	}
+
+	// Batch conversions: Euler -> quaternion -> Euler must preserve the matrix of each transform
+	{
+		const FString Context = TEXT("Batch");
+		TArray<HAPI_TransformEuler> EulerTransforms;
+		EulerTransforms.Add(MakeTransformEuler(Position, Rotation, Scale, HAPI_TRS, HAPI_XYZ));
+		EulerTransforms.Add(MakeTransformEuler(Position, Rotation, Scale, HAPI_STR, HAPI_YZX));
+		EulerTransforms.Add(MakeTransformEuler(Position, Rotation, Scale, HAPI_SRT, HAPI_ZXY));
+		const float* ExpectedMatrices[3] = {
+			EulerReferenceMatrices[HAPI_TRS][HAPI_XYZ], EulerReferenceMatrices[HAPI_STR][HAPI_YZX], EulerReferenceMatrices[HAPI_SRT][HAPI_ZXY] };
+
+		TArray<HAPI_Transform> QuatTransforms;
+		TArray<HAPI_TransformEuler> RoundTripTransforms;
+		if (TestTrue(Context + TEXT(": TransformEulerToQuat"), FHoudiniTransformMath::TransformEulerToQuat(EulerTransforms, HAPI_SRT, QuatTransforms))
+			&& TestEqual(Context + TEXT(": number of quaternion transforms"), QuatTransforms.Num(), EulerTransforms.Num())
+			&& TestTrue(Context + TEXT(": TransformQuatToEuler"), FHoudiniTransformMath::TransformQuatToEuler(QuatTransforms, HAPI_SRT, HAPI_XYZ, RoundTripTransforms))
+			&& TestEqual(Context + TEXT(": number of Euler transforms"), RoundTripTransforms.Num(), EulerTransforms.Num()))
+		{
+			for (int32 TransformIdx = 0; TransformIdx < EulerTransforms.Num(); TransformIdx++)
+			{
+				const FString TransformContext = FString::Printf(TEXT("%s %d"), *Context, TransformIdx);
+
+				float Matrix[16];
+				if (TestTrue(TransformContext + TEXT(": TransformQuatToMatrix"), FHoudiniTransformMath::TransformQuatToMatrix(QuatTransforms[TransformIdx], Matrix)))
+					MatricesAreEqual(*this, TransformContext + TEXT(" (quaternion)"), Matrix, ExpectedMatrices[TransformIdx]);
+
+				// TransformQuatToEuler returns radians, TransformEulerToMatrix expects degrees
+				HAPI_TransformEuler RoundTripTransform = RoundTripTransforms[TransformIdx];
+				for (int32 Idx = 0; Idx < 3; Idx++)
+					RoundTripTransform.rotationEuler[Idx] = FMath::RadiansToDegrees(RoundTripTransform.rotationEuler[Idx]);
+
+				if (TestTrue(TransformContext + TEXT(": TransformEulerToMatrix"), FHoudiniTransformMath::TransformEulerToMatrix(RoundTripTransform, Matrix)))
+					MatricesAreEqual(*this, TransformContext + TEXT(" (Euler)"), Matrix, ExpectedMatrices[TransformIdx]);
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -30,6 +30,7 @@
 #include "HoudiniAsset.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniDetailsLayoutCache.h"
 #include "HoudiniParameter.h"
 #include "HoudiniHandleComponent.h"
 #include "HoudiniParameterDetails.h"
@@ -280,7 +281,13 @@ FHoudiniAssetComponentDetails::CustomizeDetails(IDetailLayoutBuilder& DetailBuil
 			{
 				UHoudiniAssetComponent * HAC = Cast< UHoudiniAssetComponent >(Object);
 				if (HAC && !HAC->IsPendingKill())
+				{
 					HoudiniAssetComponents.Add(HAC);
+
+					// Remember the layout we're building the details with,
+					// so the next cooks can skip rebuilding them when it doesn't change
+					FHoudiniDetailsLayoutCache::Get().NotifyDetailsBuilt(HAC);
+				}
 			}
 		}
 	}
@@ -36,6 +36,7 @@
 #include "HoudiniSplineComponent.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniPackageParams.h"
+#include "HoudiniPackageNameAllocator.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniEngineUtils.h"
@@ -48,6 +49,8 @@
 #include "HoudiniEngineCommands.h"
 
 #include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshSocket.h"
+#include "StaticMeshResources.h"
 #include "Engine/World.h"
 #include "RawMesh.h"
 #include "UObject/Package.h"
@@ -91,6 +94,22 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Sound/SoundBase.h"
 #include "UObject/UnrealType.h"
+#include "UObject/ObjectRedirector.h"
+#include "UObject/UObjectIterator.h"
+#include "Materials/MaterialExpressionTextureSample.h"
+#include "Materials/MaterialExpressionConstant.h"
+#include "Materials/MaterialExpressionConstant3Vector.h"
+#include "Materials/MaterialExpressionConstant4Vector.h"
+#include "Materials/MaterialExpressionScalarParameter.h"
+#include "Materials/MaterialExpressionVectorParameter.h"
+#include "Materials/MaterialInstance.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Misc/PackageName.h"
+#include "Containers/Ticker.h"
+#include "ISourceControlModule.h"
+#include "ISourceControlProvider.h"
+#include "SourceControlOperations.h"
 #include "Math/Box.h"
 
 HOUDINI_BAKING_DEFINE_LOG_CATEGORY();
@@ -134,6 +153,204 @@ FHoudiniEngineBakedActor::FHoudiniEngineBakedActor(
 {
 }
 
+FHoudiniBakeTransaction* FHoudiniBakeTransaction::ActiveTransaction = nullptr;
+
+FHoudiniBakeTransaction::FHoudiniBakeTransaction()
+	: bSaveCurrentWorld(false)
+	, bCollectGarbage(false)
+	, bIsOutermost(ActiveTransaction == nullptr)
+	, bCommitted(false)
+{
+	if (bIsOutermost)
+		ActiveTransaction = this;
+}
+
+FHoudiniBakeTransaction::~FHoudiniBakeTransaction()
+{
+	Commit();
+}
+
+FHoudiniBakeTransaction*
+FHoudiniBakeTransaction::GetOrCreateDeferredTransaction()
+{
+	if (ActiveTransaction)
+		return ActiveTransaction;
+
+	FHoudiniBakeTransaction* DeferredTransaction = new FHoudiniBakeTransaction();
+	FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([DeferredTransaction](float DeltaTime)
+	{
+		// Commit and delete the transaction on the next tick
+		delete DeferredTransaction;
+		return false;
+	}));
+
+	return DeferredTransaction;
+}
+
+void
+FHoudiniBakeTransaction::AddPackagesToSave(const TArray<UPackage*>& InPackages, bool bInSaveCurrentWorld)
+{
+	for (UPackage* Package : InPackages)
+	{
+		if (IsValid(Package))
+			PackagesToSave.AddUnique(TWeakObjectPtr<UPackage>(Package));
+	}
+
+	bSaveCurrentWorld |= bInSaveCurrentWorld;
+}
+
+void
+FHoudiniBakeTransaction::Commit()
+{
+	if (bCommitted)
+		return;
+
+	bCommitted = true;
+
+	// Only the outermost transaction saves
+	if (!bIsOutermost)
+		return;
+
+	if (ActiveTransaction == this)
+		ActiveTransaction = nullptr;
+
+	// Skip the packages that were destroyed since they were added
+	TArray<UPackage*> ValidPackagesToSave;
+	ValidPackagesToSave.Reserve(PackagesToSave.Num());
+	for (const TWeakObjectPtr<UPackage>& Package : PackagesToSave)
+	{
+		if (Package.IsValid())
+			ValidPackagesToSave.Add(Package.Get());
+	}
+	PackagesToSave.Empty();
+
+	FHoudiniEngineBakeUtils::SavePackagesBatched(ValidPackagesToSave, bSaveCurrentWorld);
+	LastAssignedNameNumbers.Empty();
+
+	if (bCollectGarbage)
+		TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+FHoudiniBakePromotionScope* FHoudiniBakePromotionScope::ActiveScope = nullptr;
+
+FHoudiniBakePromotionScope::FHoudiniBakePromotionScope(UHoudiniAssetComponent* InHAC)
+	: PreviousScope(ActiveScope)
+{
+	// Gather all the objects used by the outputs of the other HACs
+	for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
+	{
+		UHoudiniAssetComponent* HAC = *Itr;
+		if (HAC == InHAC || !IsValid(HAC))
+			continue;
+
+		const int32 NumOutputs = HAC->GetNumOutputs();
+		for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
+		{
+			UHoudiniOutput* Output = HAC->GetOutputAt(OutputIdx);
+			if (!IsValid(Output))
+				continue;
+
+			for (auto& OutputObjectPair : Output->GetOutputObjects())
+			{
+				AddSharedObject(OutputObjectPair.Value.OutputObject);
+				AddSharedObject(OutputObjectPair.Value.ProxyObject);
+			}
+
+			for (auto& InstancedOutputPair : Output->GetInstancedOutputs())
+			{
+				AddSharedObject(InstancedOutputPair.Value.OriginalObject.Get());
+				for (const TSoftObjectPtr<UObject>& VariationObject : InstancedOutputPair.Value.VariationObjects)
+					AddSharedObject(VariationObject.Get());
+			}
+
+			for (auto& MaterialPair : Output->GetAssignementMaterials())
+				AddSharedObject(MaterialPair.Value);
+
+			for (auto& MaterialPair : Output->GetReplacementMaterials())
+				AddSharedObject(MaterialPair.Value);
+		}
+	}
+
+	ActiveScope = this;
+}
+
+FHoudiniBakePromotionScope::~FHoudiniBakePromotionScope()
+{
+	ActiveScope = PreviousScope;
+}
+
+void
+FHoudiniBakePromotionScope::AddPromotedObject(
+	UObject* InObject, UPackage* InSourcePackage, const FName& InSourceName, UObjectRedirector* InRedirector)
+{
+	FPromotedObject& PromotedObject = PromotedObjects.AddDefaulted_GetRef();
+	PromotedObject.Object = InObject;
+	PromotedObject.SourcePackage = InSourcePackage;
+	PromotedObject.SourceName = InSourceName;
+	PromotedObject.Redirector = InRedirector;
+}
+
+void
+FHoudiniBakePromotionScope::RevertPromotedObjects()
+{
+	// Last promoted first
+	for (int32 Idx = PromotedObjects.Num() - 1; Idx >= 0; Idx--)
+	{
+		const FPromotedObject& PromotedObject = PromotedObjects[Idx];
+		UObject* Object = PromotedObject.Object.Get();
+		UPackage* SourcePackage = PromotedObject.SourcePackage.Get();
+		if (!IsValid(Object) || !IsValid(SourcePackage))
+			continue;
+
+		// The redirector is using the name of the object in its temporary package
+		UObjectRedirector* Redirector = PromotedObject.Redirector.Get();
+		if (IsValid(Redirector))
+		{
+			Redirector->DestinationObject = nullptr;
+			Redirector->ClearFlags(RF_Public | RF_Standalone);
+			Redirector->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+			FAssetRegistryModule::AssetDeleted(Redirector);
+			Redirector->MarkPendingKill();
+		}
+
+		if (StaticFindObjectFast(nullptr, SourcePackage, PromotedObject.SourceName))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Could not move %s back to %s: the name is used."), *Object->GetPathName(), *SourcePackage->GetName());
+			continue;
+		}
+
+		const FString BakedPathName = Object->GetPathName();
+		if (Object->Rename(*PromotedObject.SourceName.ToString(), SourcePackage, REN_DontCreateRedirectors))
+			HOUDINI_BAKING_MESSAGE(TEXT("Moved %s back to temporary asset %s"), *BakedPathName, *Object->GetPathName());
+	}
+
+	PromotedObjects.Empty();
+}
+
+void
+FHoudiniBakePromotionScope::AddSharedObject(UObject* InObject)
+{
+	if (!IsValid(InObject) || SharedObjects.Contains(InObject))
+		return;
+
+	SharedObjects.Add(InObject);
+
+	if (UStaticMesh* StaticMesh = Cast<UStaticMesh>(InObject))
+	{
+		for (const FStaticMaterial& StaticMaterial : StaticMesh->GetStaticMaterials())
+			AddSharedObject(StaticMaterial.MaterialInterface);
+	}
+	else if (UMaterial* Material = Cast<UMaterial>(InObject))
+	{
+		for (UMaterialExpression* Expression : Material->Expressions)
+		{
+			UMaterialExpressionTextureSample* TextureSample = Cast<UMaterialExpressionTextureSample>(Expression);
+			if (IsValid(TextureSample))
+				AddSharedObject(TextureSample->Texture);
+		}
+	}
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 	UHoudiniAssetComponent* InHACToBake,
@@ -152,6 +369,12 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 		return false;
 	}
 
+	// The HAC's outputs are removed after the bake, so its temporary assets can be moved to the bake folder
+	// instead of being duplicated
+	TUniquePtr<FHoudiniBakePromotionScope> PromotionScope;
+	if (bInRemoveHACOutputOnSuccess)
+		PromotionScope = MakeUnique<FHoudiniBakePromotionScope>(InHACToBake);
+
 	bool bSuccess = false;
 	switch (InBakeOption)
 	{
@@ -182,6 +405,12 @@ FHoudiniEngineBakeUtils::BakeHoudiniAssetComponent(
 
 	}
 
+	// The HAC keeps its outputs when the bake failed: give them their temporary assets back
+	if (!bSuccess && PromotionScope.IsValid())
+		PromotionScope->RevertPromotedObjects();
+
+	PromotionScope.Reset();
+
 	if (bSuccess && bInRemoveHACOutputOnSuccess)
 	{
 		TArray<UHoudiniOutput*> DeferredClearOutputs;
@@ -326,6 +555,13 @@ FHoudiniEngineBakeUtils::BakeHoudiniOutputsToActors(
 	// Ensure that InBakedOutputs is the same size as InOutputs
 	if (InBakedOutputs.Num() != NumOutputs)
 		InBakedOutputs.SetNum(NumOutputs);
+
+	// Allocate the names of the new mesh packages for the whole batch up front
+	if (!bInReplaceAssets)
+	{
+		ReserveStaticMeshBakePackageNames(
+			HoudiniAssetComponent, InOutputs, InHoudiniAssetName, InBakeFolder, InTempCookFolder, InOutputTypesToBake);
+	}
 	
 	// First bake everything except instancers, then bake instancers. Since instancers might use meshes in
 	// from the other outputs.
@@ -460,11 +696,71 @@ FHoudiniEngineBakeUtils::BakeHoudiniOutputsToActors(
 		}
 	}
 
+	// Names reserved for outputs that were skipped or reused their previous bake
+	FHoudiniPackageNameAllocator::Get().ReleaseReservedCounters();
+
 	OutNewActors.Append(BakedActors);
 	
 	return true;
 }
 
+void
+FHoudiniEngineBakeUtils::ReserveStaticMeshBakePackageNames(
+	const UHoudiniAssetComponent* HoudiniAssetComponent,
+	const TArray<UHoudiniOutput*>& InOutputs,
+	const FString& InHoudiniAssetName,
+	const FDirectoryPath& InBakeFolder,
+	const FDirectoryPath& InTempCookFolder,
+	TArray<EHoudiniOutputType> const* InOutputTypesToBake)
+{
+	if (InOutputTypesToBake && InOutputTypesToBake->Find(EHoudiniOutputType::Mesh) == INDEX_NONE)
+		return;
+
+	// Resolve the package names the same way BakeStaticMeshOutputToActors does
+	TArray<FString> BasePackageNames;
+	for (UHoudiniOutput* Output : InOutputs)
+	{
+		if (!IsValid(Output) || Output->GetType() != EHoudiniOutputType::Mesh)
+			continue;
+
+		const TArray<FHoudiniGeoPartObject>& HGPOs = Output->GetHoudiniGeoPartObjects();
+		for (const auto& Pair : Output->GetOutputObjects())
+		{
+			const FHoudiniOutputObjectIdentifier& Identifier = Pair.Key;
+			const FHoudiniOutputObject& OutputObject = Pair.Value;
+
+			UStaticMesh* StaticMesh = Cast<UStaticMesh>(OutputObject.OutputObject);
+			if (!IsValid(StaticMesh) || !IsValid(OutputObject.OutputComponent))
+				continue;
+
+			// Only temporary meshes are duplicated to new packages
+			if (!IsObjectTemporary(StaticMesh, EHoudiniOutputType::Mesh, InOutputs, InTempCookFolder.Path))
+				continue;
+
+			const FHoudiniGeoPartObject* FoundHGPO = nullptr;
+			FindHGPO(Identifier, HGPOs, FoundHGPO);
+			if (FoundHGPO && FoundHGPO->bIsTemplated)
+				continue;
+
+			FHoudiniAttributeResolver Resolver;
+			FHoudiniPackageParams PackageParams;
+			FHoudiniEngineUtils::FillInPackageParamsForBakingOutputWithResolver(
+				Output->GetWorld(), HoudiniAssetComponent, Identifier, OutputObject,
+				FHoudiniPackageParams::GetPackageNameExcludingGUID(StaticMesh), InHoudiniAssetName,
+				PackageParams, Resolver, InBakeFolder.Path, EPackageReplaceMode::CreateNewAssets);
+
+			BasePackageNames.Add(UPackageTools::SanitizePackageName(
+				PackageParams.GetPackagePath() + TEXT("/") + PackageParams.GetPackageName()));
+		}
+	}
+
+	if (BasePackageNames.Num() <= 0)
+		return;
+
+	TArray<int32> Counters;
+	FHoudiniPackageNameAllocator::Get().ReserveCounters(BasePackageNames, Counters);
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeInstancerOutputToFoliage(
 	const UHoudiniAssetComponent* HoudiniAssetComponent,
@@ -650,40 +946,44 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToFoliage(
 	if (!FoliageInfo)
 		return false;
 
-	int32 CurrentInstanceCount = 0;
+	// Gather the instances first, so they can be added in bulk
+	TArray<FFoliageInstance> FoliageInstances;
 	if (SMC->IsA<UInstancedStaticMeshComponent>())
 	{
 		UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(SMC);
 		const int32 NumInstances = ISMC->GetInstanceCount();
+		FoliageInstances.Reserve(NumInstances);
 		for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
 		{
 			FTransform InstanceTransform;
 			const bool bWorldSpace = true;
 			if (ISMC->GetInstanceTransform(InstanceIndex, InstanceTransform, bWorldSpace))
 			{
-				FFoliageInstance FoliageInstance;
+				FFoliageInstance& FoliageInstance = FoliageInstances.AddDefaulted_GetRef();
 				FoliageInstance.Location = InstanceTransform.GetLocation();
 				FoliageInstance.Rotation = InstanceTransform.GetRotation().Rotator();
 				FoliageInstance.DrawScale3D = InstanceTransform.GetScale3D();
-
-				FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-
-				CurrentInstanceCount++;
 			}
 		}
 	}
 	else
 	{
 		const FTransform ComponentToWorldTransform = SMC->GetComponentToWorld();
-		FFoliageInstance FoliageInstance;
+		FFoliageInstance& FoliageInstance = FoliageInstances.AddDefaulted_GetRef();
 		FoliageInstance.Location = ComponentToWorldTransform.GetLocation();
 		FoliageInstance.Rotation = ComponentToWorldTransform.GetRotation().Rotator();
 		FoliageInstance.DrawScale3D = ComponentToWorldTransform.GetScale3D();
+	}
 
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
+	TArray<const FFoliageInstance*> FoliageInstancesToAdd;
+	FoliageInstancesToAdd.Reserve(FoliageInstances.Num());
+	for (const FFoliageInstance& FoliageInstance : FoliageInstances)
+		FoliageInstancesToAdd.Add(&FoliageInstance);
 
-		CurrentInstanceCount++;
-	}
+	if (FoliageInstancesToAdd.Num() > 0)
+		FoliageInfo->AddInstances(InstancedFoliageActor, FoliageType, FoliageInstancesToAdd);
+
+	const int32 CurrentInstanceCount = FoliageInstancesToAdd.Num();
 
 	// TODO: This was due to a bug in UE4.22-20, check if still needed! 
 	if (FoliageInfo->GetComponent())
@@ -845,6 +1145,11 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors(
 	const TMap<FHoudiniBakedOutputObjectIdentifier, FHoudiniBakedOutputObject>& OldBakedOutputObjects = InBakedOutputs[InOutputIndex].BakedOutputObjects;
 	TMap<FHoudiniBakedOutputObjectIdentifier, FHoudiniBakedOutputObject> NewBakedOutputObjects;
 
+	// When bulk baking, the ISMC/HISMC/MSIC output objects are baked together after the loop
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bBulkBake = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bBulkBakeInstancers;
+	TArray<FHoudiniOutputObjectIdentifier> BulkBakeIdentifiers;
+
 	// Iterate on the output objects, baking their object/component as we go
 	for (auto& Pair : OutputObjects)
 	{
@@ -889,6 +1194,12 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors(
 			else if (!InInstancerComponentTypesToBake ||
 				InInstancerComponentTypesToBake->Contains(EHoudiniInstancerComponentType::FoliageAsHierarchicalInstancedStaticMeshComponent))
 			{
+				if (bBulkBake)
+				{
+					BulkBakeIdentifiers.Add(Identifier);
+					continue;
+				}
+
 				BakeInstancerOutputToActors_ISMC(
 					HoudiniAssetComponent,
 					InOutputIndex,
@@ -911,6 +1222,12 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors(
 		else if (CurrentOutputObject.OutputComponent->IsA<UInstancedStaticMeshComponent>()
 			&& (!InInstancerComponentTypesToBake || InInstancerComponentTypesToBake->Contains(EHoudiniInstancerComponentType::InstancedStaticMeshComponent)))
 		{
+			if (bBulkBake)
+			{
+				BulkBakeIdentifiers.Add(Identifier);
+				continue;
+			}
+
 			BakeInstancerOutputToActors_ISMC(
 				HoudiniAssetComponent,
 				InOutputIndex,
@@ -947,6 +1264,12 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors(
 		else if (CurrentOutputObject.OutputComponent->IsA<UHoudiniMeshSplitInstancerComponent>()
 		 		 && (!InInstancerComponentTypesToBake || InInstancerComponentTypesToBake->Contains(EHoudiniInstancerComponentType::MeshSplitInstancerComponent)))
 		{
+			if (bBulkBake)
+			{
+				BulkBakeIdentifiers.Add(Identifier);
+				continue;
+			}
+
 			BakeInstancerOutputToActors_MSIC(
 				HoudiniAssetComponent,
 				InOutputIndex,
@@ -992,6 +1315,25 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors(
 
 	}
 
+	if (BulkBakeIdentifiers.Num() > 0)
+	{
+		BakeInstancerOutputToActors_Bulk(
+			HoudiniAssetComponent,
+			InOutputIndex,
+			InAllOutputs,
+			BulkBakeIdentifiers,
+			NewBakedOutputObjects,
+			InTransform,
+			InBakeFolder,
+			InTempCookFolder,
+			bInReplaceActors,
+			bInReplaceAssets,
+			OutActors,
+			OutPackagesToSave,
+			InFallbackActor,
+			InFallbackWorldOutlinerFolder);
+	}
+
 	// Update the cached baked output data
 	InBakedOutputs[InOutputIndex].BakedOutputObjects = NewBakedOutputObjects;
 
@@ -1322,6 +1664,481 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_ISMC(
 	return true;
 }
 
+// Returns true if two instancer components can be merged in one baked component: same class, and same values for
+// all the editable properties (custom data floats, cull distances, collision, generic uproperty attributes...)
+// except the ones that are set per baked component or per instance.
+static bool
+HaveSameInstancerProperties(const UStaticMeshComponent* InComponentA, const UStaticMeshComponent* InComponentB)
+{
+	if (InComponentA == InComponentB)
+		return true;
+
+	if (!IsValid(InComponentA) || !IsValid(InComponentB) || InComponentA->GetClass() != InComponentB->GetClass())
+		return false;
+
+	static const TSet<FName> IgnoredProperties = {
+		TEXT("StaticMesh"),
+		TEXT("OverrideMaterials"),
+		TEXT("PerInstanceSMData"),
+		TEXT("PerInstanceSMCustomData"),
+		TEXT("RelativeLocation"),
+		TEXT("RelativeRotation"),
+		TEXT("RelativeScale3D")
+	};
+
+	for (TFieldIterator<FProperty> PropIt(InComponentA->GetClass(), EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
+	{
+		FProperty* Property = *PropIt;
+		if (!Property || !Property->HasAnyPropertyFlags(CPF_Edit) || Property->HasAnyPropertyFlags(CPF_Transient))
+			continue;
+
+		if (IgnoredProperties.Contains(Property->GetFName()))
+			continue;
+
+		if (!Property->Identical_InContainer(InComponentA, InComponentB))
+			return false;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_Bulk(
+	const UHoudiniAssetComponent* HoudiniAssetComponent,
+	int32 InOutputIndex,
+	const TArray<UHoudiniOutput*>& InAllOutputs,
+	const TArray<FHoudiniOutputObjectIdentifier>& InOutputObjectIdentifiers,
+	TMap<FHoudiniBakedOutputObjectIdentifier, FHoudiniBakedOutputObject>& InBakedOutputObjects,
+	const FTransform& InTransform,
+	const FDirectoryPath& InBakeFolder,
+	const FDirectoryPath& InTempCookFolder,
+	bool bInReplaceActors,
+	bool bInReplaceAssets,
+	TArray<FHoudiniEngineBakedActor>& OutActors,
+	TArray<UPackage*>& OutPackagesToSave,
+	AActor* InFallbackActor,
+	const FString& InFallbackWorldOutlinerFolder)
+{
+	if (!InAllOutputs.IsValidIndex(InOutputIndex))
+		return false;
+
+	UHoudiniOutput* InOutput = InAllOutputs[InOutputIndex];
+	if (!IsValid(InOutput))
+		return false;
+
+	const EPackageReplaceMode AssetPackageReplaceMode = bInReplaceAssets ?
+		EPackageReplaceMode::ReplaceExistingAssets : EPackageReplaceMode::CreateNewAssets;
+
+	// An instancer output object, with its baked mesh and the actor it is baked to
+	struct FBulkBakeInstancer
+	{
+		FHoudiniOutputObjectIdentifier Identifier;
+		const FHoudiniOutputObject* OutputObject = nullptr;
+		USceneComponent* SourceComponent = nullptr;
+		// The component we copy the properties of the baked component from
+		UStaticMeshComponent* PropertySourceComponent = nullptr;
+		UStaticMesh* StaticMesh = nullptr;
+		UStaticMesh* BakedStaticMesh = nullptr;
+		TArray<UMaterialInterface*> Materials;
+		bool bHierarchical = false;
+		bool bFoundMeshOutput = false;
+		FHoudiniPackageParams MeshPackageParams;
+		FHoudiniPackageParams InstancerPackageParams;
+		FName WorldOutlinerFolderPath;
+		int32 BakeActorIndex = INDEX_NONE;
+	};
+
+	// An actor the instancers are baked to
+	struct FBulkBakeActor
+	{
+		ULevel* Level = nullptr;
+		FName BakeActorName;
+		AActor* Actor = nullptr;
+		USceneComponent* RootComponent = nullptr;
+		bool bSpawnedActor = false;
+		int32 FirstInstancerIndex = INDEX_NONE;
+	};
+
+	// The instancers merged in one baked component: same actor, mesh, materials and component properties
+	struct FBulkBakeComponent
+	{
+		int32 BakeActorIndex = INDEX_NONE;
+		UStaticMesh* BakedStaticMesh = nullptr;
+		TArray<UMaterialInterface*> Materials;
+		bool bHierarchical = false;
+		UStaticMeshComponent* PropertySourceComponent = nullptr;
+		TArray<int32> InstancerIndices;
+	};
+
+	TArray<FBulkBakeInstancer> Instancers;
+	Instancers.Reserve(InOutputObjectIdentifiers.Num());
+	TArray<FBulkBakeActor> BakeActors;
+	// Temporary meshes baked by this function, instancers often share the same mesh
+	TMap<UStaticMesh*, UStaticMesh*> BakedStaticMeshes;
+
+	// First, bake the instanced meshes and find the actor of each instancer
+	for (const FHoudiniOutputObjectIdentifier& Identifier : InOutputObjectIdentifiers)
+	{
+		const FHoudiniOutputObject* OutputObject = InOutput->GetOutputObjects().Find(Identifier);
+		FHoudiniBakedOutputObject* BakedOutputObject = InBakedOutputObjects.Find(Identifier);
+		if (!OutputObject || !BakedOutputObject)
+			continue;
+
+		FBulkBakeInstancer Instancer;
+		Instancer.Identifier = Identifier;
+		Instancer.OutputObject = OutputObject;
+		if (UInstancedStaticMeshComponent* InISMC = Cast<UInstancedStaticMeshComponent>(OutputObject->OutputComponent))
+		{
+			Instancer.SourceComponent = InISMC;
+			Instancer.PropertySourceComponent = InISMC;
+			Instancer.StaticMesh = InISMC->GetStaticMesh();
+			Instancer.Materials = InISMC->OverrideMaterials;
+			Instancer.bHierarchical = InISMC->IsA<UHierarchicalInstancedStaticMeshComponent>();
+		}
+		else if (UHoudiniMeshSplitInstancerComponent* InMSIC = Cast<UHoudiniMeshSplitInstancerComponent>(OutputObject->OutputComponent))
+		{
+			Instancer.SourceComponent = InMSIC;
+			Instancer.StaticMesh = InMSIC->GetStaticMesh();
+			for (UStaticMeshComponent* CurrentSMC : InMSIC->GetInstances())
+			{
+				if (!IsValid(CurrentSMC))
+					continue;
+
+				Instancer.PropertySourceComponent = CurrentSMC;
+				Instancer.Materials = CurrentSMC->OverrideMaterials;
+				break;
+			}
+		}
+
+		if (!IsValid(Instancer.SourceComponent) || !IsValid(Instancer.StaticMesh))
+			continue;
+
+		AActor* OwnerActor = Instancer.SourceComponent->GetOwner();
+		if (!IsValid(OwnerActor))
+			continue;
+
+		UWorld* DesiredWorld = OwnerActor->GetWorld();
+
+		// Determine if the incoming mesh is temporary by looking for it in the mesh outputs, and bake it if needed
+		FString ObjectName = FHoudiniPackageParams::GetPackageNameExcludingGUID(Instancer.StaticMesh);
+		int32 MeshOutputIndex = INDEX_NONE;
+		FHoudiniOutputObjectIdentifier MeshIdentifier;
+		Instancer.bFoundMeshOutput = FindOutputObject(Instancer.StaticMesh, EHoudiniOutputType::Mesh, InAllOutputs, MeshOutputIndex, MeshIdentifier);
+		if (Instancer.bFoundMeshOutput)
+		{
+			const FHoudiniOutputObject& MeshOutputObject = InAllOutputs[MeshOutputIndex]->GetOutputObjects().FindChecked(MeshIdentifier);
+			FHoudiniAttributeResolver MeshResolver;
+			FHoudiniEngineUtils::FillInPackageParamsForBakingOutputWithResolver(
+				DesiredWorld, HoudiniAssetComponent, MeshIdentifier, MeshOutputObject, ObjectName,
+				OwnerActor->GetName(), Instancer.MeshPackageParams, MeshResolver,
+				InBakeFolder.Path, AssetPackageReplaceMode);
+			ObjectName = Instancer.MeshPackageParams.ObjectName;
+
+			UStaticMesh** FoundBakedStaticMesh = BakedStaticMeshes.Find(Instancer.StaticMesh);
+			if (FoundBakedStaticMesh)
+			{
+				Instancer.BakedStaticMesh = *FoundBakedStaticMesh;
+			}
+			else
+			{
+				UStaticMesh* PreviousStaticMesh = Cast<UStaticMesh>(BakedOutputObject->GetBakedObjectIfValid());
+				Instancer.BakedStaticMesh = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
+					Instancer.StaticMesh, PreviousStaticMesh, Instancer.MeshPackageParams, InAllOutputs, OutActors, InTempCookFolder.Path, OutPackagesToSave);
+				BakedStaticMeshes.Add(Instancer.StaticMesh, Instancer.BakedStaticMesh);
+			}
+		}
+		else
+		{
+			Instancer.BakedStaticMesh = Instancer.StaticMesh;
+		}
+
+		if (!IsValid(Instancer.BakedStaticMesh))
+			continue;
+
+		BakedOutputObject->BakedObject = FSoftObjectPath(Instancer.BakedStaticMesh).ToString();
+
+		const FString BaseName = OwnerActor->GetName();
+		Instancer.WorldOutlinerFolderPath = GetOutlinerFolderPath(*OutputObject, FName(InFallbackWorldOutlinerFolder.IsEmpty() ? BaseName : InFallbackWorldOutlinerFolder));
+
+		FHoudiniAttributeResolver InstancerResolver;
+		FHoudiniEngineUtils::FillInPackageParamsForBakingOutputWithResolver(
+			DesiredWorld, HoudiniAssetComponent, Identifier, *OutputObject, ObjectName,
+			BaseName, Instancer.InstancerPackageParams, InstancerResolver,
+			InBakeFolder.Path, AssetPackageReplaceMode);
+
+		// By default spawn in the current level unless specified via the unreal_level_path attribute
+		ULevel* DesiredLevel = GWorld->GetCurrentLevel();
+		if (OutputObject->CachedAttributes.Contains(HAPI_UNREAL_ATTRIB_LEVEL_PATH))
+		{
+			bool bCreatedPackage = false;
+			if (!FHoudiniEngineBakeUtils::FindOrCreateDesiredLevelFromLevelPath(
+				InstancerResolver.ResolveFullLevelPath(),
+				DesiredLevel,
+				DesiredWorld,
+				bCreatedPackage))
+			{
+				continue;
+			}
+
+			if (bCreatedPackage && DesiredLevel)
+				OutPackagesToSave.Add(DesiredLevel->GetOutermost());
+		}
+
+		if (!DesiredLevel)
+			continue;
+
+		// All the instancers of the output are baked to the same default actor so they can be merged
+		const FString DefaultActorName = BaseName + TEXT("_instancers");
+		FName BakeActorName;
+		AActor* FoundActor = nullptr;
+		bool bHasBakeActorName = false;
+		if (!FindUnrealBakeActor(*OutputObject, *BakedOutputObject, OutActors, DesiredLevel, *DefaultActorName, bInReplaceActors, InFallbackActor, FoundActor, bHasBakeActorName, BakeActorName))
+			continue;
+
+		if (IsValid(FoundActor))
+		{
+			// Remove the components previously baked for this output object from the actor
+			if (bInReplaceAssets)
+			{
+				UActorComponent* PrevComponent = Cast<UActorComponent>(BakedOutputObject->GetBakedComponentIfValid());
+				if (IsValid(PrevComponent) && PrevComponent->GetOwner() == FoundActor)
+					RemovePreviouslyBakedComponent(PrevComponent);
+			}
+
+			for (const FString& PrevComponentPathStr : BakedOutputObject->InstancedComponents)
+			{
+				const FSoftObjectPath PrevComponentPath(PrevComponentPathStr);
+				if (!PrevComponentPath.IsValid())
+					continue;
+
+				UActorComponent* PrevComponent = Cast<UActorComponent>(PrevComponentPath.TryLoad());
+				if (IsValid(PrevComponent) && PrevComponent->GetOwner() == FoundActor)
+					RemovePreviouslyBakedComponent(PrevComponent);
+			}
+		}
+
+		const int32 InstancerIndex = Instancers.Num();
+		Instancer.BakeActorIndex = BakeActors.IndexOfByPredicate([DesiredLevel, BakeActorName, FoundActor](const FBulkBakeActor& BakeActor)
+		{
+			return BakeActor.Level == DesiredLevel && BakeActor.BakeActorName == BakeActorName
+				&& (!FoundActor || !BakeActor.Actor || BakeActor.Actor == FoundActor);
+		});
+
+		if (Instancer.BakeActorIndex == INDEX_NONE)
+		{
+			Instancer.BakeActorIndex = BakeActors.AddDefaulted();
+			FBulkBakeActor& BakeActor = BakeActors[Instancer.BakeActorIndex];
+			BakeActor.Level = DesiredLevel;
+			BakeActor.BakeActorName = BakeActorName;
+			BakeActor.FirstInstancerIndex = InstancerIndex;
+		}
+
+		if (!BakeActors[Instancer.BakeActorIndex].Actor)
+			BakeActors[Instancer.BakeActorIndex].Actor = FoundActor;
+
+		Instancers.Add(MoveTemp(Instancer));
+	}
+
+	// Spawn the missing actors, their construction is finished once all the components have been added
+	for (FBulkBakeActor& BakeActor : BakeActors)
+	{
+		if (!IsValid(BakeActor.Actor))
+		{
+			FActorSpawnParameters SpawnInfo;
+			SpawnInfo.OverrideLevel = BakeActor.Level;
+			SpawnInfo.ObjectFlags = RF_Transactional;
+			SpawnInfo.Name = FName(MakeUniqueObjectNameIfNeeded(BakeActor.Level, AActor::StaticClass(), BakeActor.BakeActorName.ToString()));
+			SpawnInfo.bDeferConstruction = true;
+
+			BakeActor.Actor = BakeActor.Level->OwningWorld->SpawnActor<AActor>(SpawnInfo);
+			if (!IsValid(BakeActor.Actor))
+				continue;
+
+			BakeActor.bSpawnedActor = true;
+			BakeActor.Actor->SetActorLabel(BakeActor.Actor->GetName());
+		}
+		else
+		{
+			const FString UniqueActorNameStr = MakeUniqueObjectNameIfNeeded(BakeActor.Level, AActor::StaticClass(), BakeActor.BakeActorName.ToString(), BakeActor.Actor);
+			RenameAndRelabelActor(BakeActor.Actor, UniqueActorNameStr, false);
+		}
+
+		const FBulkBakeInstancer& FirstInstancer = Instancers[BakeActor.FirstInstancerIndex];
+		SetOutlinerFolderPath(BakeActor.Actor, *FirstInstancer.OutputObject, FirstInstancer.WorldOutlinerFolderPath);
+
+		const bool bCreateIfMissing = true;
+		BakeActor.RootComponent = GetActorRootComponent(BakeActor.Actor, bCreateIfMissing);
+		if (BakeActor.bSpawnedActor && IsValid(BakeActor.RootComponent))
+			BakeActor.RootComponent->SetWorldTransform(InTransform);
+	}
+
+	// Group the instancers that can be merged in one component
+	TArray<FBulkBakeComponent> BakeComponents;
+	for (int32 InstancerIndex = 0; InstancerIndex < Instancers.Num(); InstancerIndex++)
+	{
+		const FBulkBakeInstancer& Instancer = Instancers[InstancerIndex];
+		if (!IsValid(BakeActors[Instancer.BakeActorIndex].Actor))
+			continue;
+
+		FBulkBakeComponent* BakeComponent = BakeComponents.FindByPredicate([&Instancer](const FBulkBakeComponent& Component)
+		{
+			return Component.BakeActorIndex == Instancer.BakeActorIndex
+				&& Component.BakedStaticMesh == Instancer.BakedStaticMesh
+				&& Component.bHierarchical == Instancer.bHierarchical
+				&& Component.Materials == Instancer.Materials
+				&& HaveSameInstancerProperties(Component.PropertySourceComponent, Instancer.PropertySourceComponent);
+		});
+
+		if (!BakeComponent)
+		{
+			BakeComponent = &BakeComponents.AddDefaulted_GetRef();
+			BakeComponent->BakeActorIndex = Instancer.BakeActorIndex;
+			BakeComponent->BakedStaticMesh = Instancer.BakedStaticMesh;
+			BakeComponent->Materials = Instancer.Materials;
+			BakeComponent->bHierarchical = Instancer.bHierarchical;
+			BakeComponent->PropertySourceComponent = Instancer.PropertySourceComponent;
+		}
+
+		BakeComponent->InstancerIndices.Add(InstancerIndex);
+	}
+
+	// Create one instanced component per group, directly from the instance transforms and custom data
+	TArray<FTransform> InstanceTransforms;
+	TArray<float> InstanceCustomData;
+	for (const FBulkBakeComponent& BakeComponent : BakeComponents)
+	{
+		const FBulkBakeActor& BakeActor = BakeActors[BakeComponent.BakeActorIndex];
+		const FBulkBakeInstancer& FirstInstancer = Instancers[BakeComponent.InstancerIndices[0]];
+
+		UClass* ComponentClass = BakeComponent.bHierarchical ?
+			UHierarchicalInstancedStaticMeshComponent::StaticClass() : UInstancedStaticMeshComponent::StaticClass();
+		UInstancedStaticMeshComponent* NewISMC = NewObject<UInstancedStaticMeshComponent>(
+			BakeActor.Actor,
+			ComponentClass,
+			FName(MakeUniqueObjectNameIfNeeded(BakeActor.Actor, ComponentClass, FirstInstancer.SourceComponent->GetName())),
+			RF_Transactional);
+		if (!IsValid(NewISMC))
+			continue;
+
+		// Copy the properties of the first instancer (they are the same for all the merged instancers), but not its instances
+		CopyPropertyToNewActorAndComponent(BakeActor.Actor, NewISMC, FirstInstancer.PropertySourceComponent);
+		NewISMC->ClearInstances();
+
+		// Mesh split instancers have no per instance custom data
+		UInstancedStaticMeshComponent* FirstISMC = Cast<UInstancedStaticMeshComponent>(FirstInstancer.SourceComponent);
+		const int32 NumCustomDataFloats = FirstISMC ? FirstISMC->NumCustomDataFloats : 0;
+		NewISMC->SetNumCustomDataFloats(NumCustomDataFloats);
+		NewISMC->SetStaticMesh(BakeComponent.BakedStaticMesh);
+		NewISMC->OverrideMaterials = BakeComponent.Materials;
+
+		BakeActor.Actor->AddInstanceComponent(NewISMC);
+		if (IsValid(BakeActor.RootComponent))
+			NewISMC->AttachToComponent(BakeActor.RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+		NewISMC->SetWorldTransform(FirstInstancer.SourceComponent->GetComponentTransform());
+		NewISMC->RegisterComponent();
+
+		// Gather the instances of all the merged instancers, relative to the new component
+		const FTransform ComponentTransform = NewISMC->GetComponentTransform();
+		InstanceTransforms.Reset();
+		InstanceCustomData.Reset();
+		for (int32 InstancerIndex : BakeComponent.InstancerIndices)
+		{
+			const FBulkBakeInstancer& Instancer = Instancers[InstancerIndex];
+			if (UInstancedStaticMeshComponent* InISMC = Cast<UInstancedStaticMeshComponent>(Instancer.SourceComponent))
+			{
+				const int32 NumInstances = InISMC->GetInstanceCount();
+				InstanceTransforms.Reserve(InstanceTransforms.Num() + NumInstances);
+				for (int32 InstanceIdx = 0; InstanceIdx < NumInstances; InstanceIdx++)
+				{
+					FTransform InstanceTransform;
+					InISMC->GetInstanceTransform(InstanceIdx, InstanceTransform, true);
+					InstanceTransforms.Add(InstanceTransform.GetRelativeTransform(ComponentTransform));
+				}
+
+				// Keep the custom data aligned with the transforms, even if it is missing on the source
+				const int32 FirstCustomDataIdx = InstanceCustomData.AddZeroed(NumInstances * NumCustomDataFloats);
+				const int32 NumSourceCustomData = FMath::Min(InISMC->PerInstanceSMCustomData.Num(), NumInstances * NumCustomDataFloats);
+				if (NumSourceCustomData > 0)
+					FMemory::Memcpy(&InstanceCustomData[FirstCustomDataIdx], InISMC->PerInstanceSMCustomData.GetData(), NumSourceCustomData * sizeof(float));
+			}
+			else if (UHoudiniMeshSplitInstancerComponent* InMSIC = Cast<UHoudiniMeshSplitInstancerComponent>(Instancer.SourceComponent))
+			{
+				InstanceTransforms.Reserve(InstanceTransforms.Num() + InMSIC->GetInstances().Num());
+				for (UStaticMeshComponent* CurrentSMC : InMSIC->GetInstances())
+				{
+					if (IsValid(CurrentSMC))
+						InstanceTransforms.Add(CurrentSMC->GetComponentTransform().GetRelativeTransform(ComponentTransform));
+				}
+			}
+		}
+
+		const bool bShouldReturnIndices = false;
+		NewISMC->AddInstances(InstanceTransforms, bShouldReturnIndices);
+
+		// Copy the per instance custom data (unreal_per_instance_custom_data)
+		if (NumCustomDataFloats > 0 && InstanceCustomData.Num() == InstanceTransforms.Num() * NumCustomDataFloats)
+		{
+			TArray<float> CustomData;
+			CustomData.SetNumUninitialized(NumCustomDataFloats);
+			for (int32 InstanceIdx = 0; InstanceIdx < InstanceTransforms.Num(); InstanceIdx++)
+			{
+				FMemory::Memcpy(CustomData.GetData(), &InstanceCustomData[InstanceIdx * NumCustomDataFloats], NumCustomDataFloats * sizeof(float));
+				NewISMC->SetCustomData(InstanceIdx, CustomData);
+			}
+			NewISMC->MarkRenderStateDirty();
+		}
+
+		// Update the baked outputs of the merged instancers
+		for (int32 InstancerIndex : BakeComponent.InstancerIndices)
+		{
+			const FBulkBakeInstancer& Instancer = Instancers[InstancerIndex];
+			FHoudiniBakedOutputObject& BakedOutputObject = InBakedOutputObjects.FindChecked(Instancer.Identifier);
+			BakedOutputObject.BakedComponent = FSoftObjectPath(NewISMC).ToString();
+			BakedOutputObject.Actor = FSoftObjectPath(BakeActor.Actor).ToString();
+
+			FHoudiniEngineBakedActor& OutputEntry = OutActors.Add_GetRef(FHoudiniEngineBakedActor(
+				BakeActor.Actor,
+				BakeActor.BakeActorName,
+				Instancer.WorldOutlinerFolderPath,
+				InOutputIndex,
+				Instancer.Identifier,
+				Instancer.BakedStaticMesh,
+				Instancer.StaticMesh,
+				NewISMC,
+				Instancer.bFoundMeshOutput ? Instancer.MeshPackageParams.BakeFolder : FString(),
+				Instancer.MeshPackageParams));
+			OutputEntry.bInstancerOutput = true;
+			OutputEntry.InstancerPackageParams = Instancer.InstancerPackageParams;
+
+			// If we are baking in replace mode, remove previously baked instanced actors/components
+			if (bInReplaceActors && bInReplaceAssets)
+			{
+				const bool bInDestroyBakedComponent = false;
+				const bool bInDestroyBakedInstancedActors = true;
+				const bool bInDestroyBakedInstancedComponents = true;
+				DestroyPreviousBakeOutput(
+					BakedOutputObject, bInDestroyBakedComponent, bInDestroyBakedInstancedActors, bInDestroyBakedInstancedComponents);
+			}
+		}
+	}
+
+	// Finish spawning the new actors now that they have all their components
+	for (FBulkBakeActor& BakeActor : BakeActors)
+	{
+		if (!IsValid(BakeActor.Actor))
+			continue;
+
+		if (BakeActor.bSpawnedActor)
+			BakeActor.Actor->FinishSpawning(InTransform);
+
+		BakeActor.Actor->InvalidateLightingCache();
+		BakeActor.Actor->PostEditMove(true);
+		BakeActor.Actor->MarkPackageDirty();
+	}
+
+	return true;
+}
+
 bool
 FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_SMC(
 	const UHoudiniAssetComponent* HoudiniAssetComponent,
@@ -1641,16 +2458,60 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 	// Empty and reserve enough space for new instanced actors
 	InBakedOutputObject.InstancedActors.Empty(InIAC->GetInstancedActors().Num());
 
+	// When bulk baking, actors instancing a class/blueprint are spawned with deferred construction, and their
+	// construction is finished in batches, once their properties have been copied
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const bool bBulkBake = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bBulkBakeInstancers;
+	UClass* InstancedActorClass = nullptr;
+	int32 SpawnBatchSize = 1;
+	if (bBulkBake)
+	{
+		SpawnBatchSize = FMath::Max(1, HoudiniRuntimeSettings->BulkBakeActorSpawnBatchSize);
+
+		UBlueprint* InstancedBlueprint = Cast<UBlueprint>(InstancedObject);
+		InstancedActorClass = InstancedBlueprint ? *InstancedBlueprint->GeneratedClass : Cast<UClass>(InstancedObject);
+		if (InstancedActorClass && !InstancedActorClass->IsChildOf(AActor::StaticClass()))
+			InstancedActorClass = nullptr;
+	}
+
+	TArray<TPair<AActor*, FTransform>> DeferredActors;
+	auto FinishSpawningDeferredActors = [&DeferredActors]()
+	{
+		for (auto& DeferredActor : DeferredActors)
+		{
+			if (IsValid(DeferredActor.Key))
+				DeferredActor.Key->FinishSpawning(DeferredActor.Value);
+		}
+		DeferredActors.Reset();
+	};
+
 	// Iterates on all the instances of the IAC
+	int32 InstanceIdx = 0;
 	for (AActor* CurrentInstancedActor : InIAC->GetInstancedActors())
 	{
 		if (!CurrentInstancedActor || CurrentInstancedActor->IsPendingKill())
 			continue;
 
-		const FString NewNameStr = MakeUniqueObjectNameIfNeeded(DesiredLevel, InstancedObject->StaticClass(), BaseName.ToString());
+		// Labels don't need to be unique, avoid searching for a unique name for each instance when bulk baking
+		const FString NewNameStr = bBulkBake ?
+			FString::Printf(TEXT("%s_%d"), *BaseName.ToString(), InstanceIdx++)
+			: MakeUniqueObjectNameIfNeeded(DesiredLevel, InstancedObject->StaticClass(), BaseName.ToString());
 
 		FTransform CurrentTransform = CurrentInstancedActor->GetTransform();
-		AActor* NewActor = FHoudiniInstanceTranslator::SpawnInstanceActor(CurrentTransform, DesiredLevel, InIAC);
+		AActor* NewActor = nullptr;
+		if (InstancedActorClass)
+		{
+			FActorSpawnParameters SpawnInfo;
+			SpawnInfo.OverrideLevel = DesiredLevel;
+			SpawnInfo.ObjectFlags = RF_Transactional;
+			SpawnInfo.bDeferConstruction = true;
+			NewActor = DesiredLevel->OwningWorld->SpawnActor<AActor>(InstancedActorClass, CurrentTransform, SpawnInfo);
+		}
+		else
+		{
+			NewActor = FHoudiniInstanceTranslator::SpawnInstanceActor(CurrentTransform, DesiredLevel, InIAC);
+		}
+
 		if (!NewActor || NewActor->IsPendingKill())
 			continue;
 
@@ -1664,7 +2525,16 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 
 		NewActor->SetActorLabel(NewNameStr);
 		SetOutlinerFolderPath(NewActor, InOutputObject, WorldOutlinerFolderPath);
-		NewActor->SetActorTransform(CurrentTransform);
+		if (InstancedActorClass)
+		{
+			DeferredActors.Emplace(NewActor, CurrentTransform);
+			if (DeferredActors.Num() >= SpawnBatchSize)
+				FinishSpawningDeferredActors();
+		}
+		else
+		{
+			NewActor->SetActorTransform(CurrentTransform);
+		}
 
 		InBakedOutputObject.InstancedActors.Add(FSoftObjectPath(NewActor).ToString());
 		
@@ -1683,6 +2553,8 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 		OutputEntry.InstancerPackageParams = PackageParams;
 	}
 
+	FinishSpawningDeferredActors();
+
 	// TODO:
 	// Move Actors to DesiredLevel if needed??
 
@@ -2129,6 +3001,31 @@ FHoudiniEngineBakeUtils::BakeStaticMeshOutputToActors(
 			}
 		}
 
+		// Compare this output object with its previous bake, and skip it / only update its transform if possible
+		const uint32 ContentHash = ComputeStaticMeshContentHash(StaticMesh);
+		const uint32 TransformHash = ComputeTransformsHash({ InSMC->GetComponentTransform() });
+		const uint32 AttributesHash = ComputeOutputObjectAttributesHash(OutputObject, PackageParams);
+		const EHoudiniBakePlanAction BakeAction = PlanOutputObjectBake(
+			BakedOutputObject, ContentHash, TransformHash, AttributesHash, bInReplaceActors, bInReplaceAssets);
+		if (BakeAction != EHoudiniBakePlanAction::Rebake)
+		{
+			// PlanOutputObjectBake has made sure the previous actor, component and asset are valid
+			AActor* PreviousActor = BakedOutputObject.GetActorIfValid();
+			UStaticMeshComponent* PreviousSMC = Cast<UStaticMeshComponent>(BakedOutputObject.GetBakedComponentIfValid());
+			UStaticMesh* PreviousSM = Cast<UStaticMesh>(BakedOutputObject.GetBakedObjectIfValid());
+
+			if (BakeAction == EHoudiniBakePlanAction::UpdateTransform)
+			{
+				PreviousSMC->SetWorldTransform(InSMC->GetComponentTransform());
+				BakedOutputObject.BakedTransformHash = TransformHash;
+			}
+
+			OutActors.Add(FHoudiniEngineBakedActor(
+				PreviousActor, BakedOutputObject.ActorBakeName, WorldOutlinerFolderPath, InOutputIndex, Identifier, PreviousSM, StaticMesh, PreviousSMC,
+				PackageParams.BakeFolder, PackageParams));
+			continue;
+		}
+
 		// Bake the static mesh if it is still temporary
 		UStaticMesh* BakedSM = FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 			StaticMesh,
@@ -2216,10 +3113,16 @@ FHoudiniEngineBakeUtils::BakeStaticMeshOutputToActors(
 		}
 		
 		BakedOutputObject.Actor = FSoftObjectPath(FoundActor).ToString();
+		BakedOutputObject.ActorBakeName = BakeActorName;
 		OutActors.Add(FHoudiniEngineBakedActor(
 			FoundActor, BakeActorName, WorldOutlinerFolderPath, InOutputIndex, Identifier, BakedSM, StaticMesh, SMC,
 			PackageParams.BakeFolder, PackageParams));
 
+		// Record the fingerprints of this bake
+		BakedOutputObject.BakedContentHash = ContentHash;
+		BakedOutputObject.BakedTransformHash = TransformHash;
+		BakedOutputObject.BakedAttributesHash = AttributesHash;
+
 		// If we are baking in replace mode, remove previously baked components/instancers
 		if (bInReplaceActors && bInReplaceAssets)
 		{
@@ -2429,7 +3332,7 @@ FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniAssetComponent* HoudiniAssetComp
 		FHoudiniEngine::Get().FinishTaskSlateNotification( FText::FromString(Msg) );
 	}
 	
-	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	CollectGarbageAfterBake();
 
 	return bSuccess;
 }
@@ -2867,6 +3770,81 @@ FHoudiniEngineBakeUtils::BakeLandscapeObject(
 	return true;
 }
 
+bool
+FHoudiniEngineBakeUtils::CanPromoteTemporaryObject(UObject* InObject, UPackage* InPackage, const FString& InName)
+{
+	FHoudiniBakePromotionScope* PromotionScope = FHoudiniBakePromotionScope::GetActive();
+	if (!PromotionScope)
+		return false;
+
+	if (!IsValid(InObject) || !IsValid(InPackage))
+		return false;
+
+	// The object must be a top level asset
+	UPackage* SourcePackage = Cast<UPackage>(InObject->GetOuter());
+	if (!IsValid(SourcePackage) || SourcePackage == InPackage)
+		return false;
+
+	// Other HACs are still using the temporary object
+	if (PromotionScope->IsObjectShared(InObject))
+		return false;
+
+	// We can't rename over an existing object, the existing asset has to be replaced in place
+	if (StaticFindObjectFast(nullptr, InPackage, FName(*InName)))
+		return false;
+
+	return true;
+}
+
+bool
+FHoudiniEngineBakeUtils::PromoteTemporaryObject(
+	UObject* InObject, UPackage* InPackage, const FString& InName, TArray<UPackage*>& OutCreatedPackages)
+{
+	if (!IsValid(InObject) || !IsValid(InPackage))
+		return false;
+
+	UPackage* SourcePackage = InObject->GetOutermost();
+	const FName SourceName = InObject->GetFName();
+	const EObjectFlags SourceFlags = InObject->GetFlags();
+
+	FHoudiniBakePromotionScope* PromotionScope = FHoudiniBakePromotionScope::GetActive();
+	if (!PromotionScope)
+		return false;
+
+	// Transactional, so that undoing the bake also moves the asset back
+	if (!InObject->Rename(*InName, InPackage, REN_DontCreateRedirectors))
+		return false;
+
+	// If the temporary package was saved and is referenced by other packages on disk, leave a redirector behind
+	UObjectRedirector* Redirector = nullptr;
+	if (IsValid(SourcePackage) && FPackageName::DoesPackageExist(SourcePackage->GetName()))
+	{
+		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		TArray<FName> Referencers;
+		AssetRegistryModule.Get().GetReferencers(SourcePackage->GetFName(), Referencers);
+		Referencers.Remove(SourcePackage->GetFName());
+		if (Referencers.Num() > 0)
+		{
+			Redirector = NewObject<UObjectRedirector>(
+				SourcePackage, SourceName, SourceFlags & (RF_Public | RF_Standalone));
+			if (IsValid(Redirector))
+			{
+				Redirector->DestinationObject = InObject;
+				FAssetRegistryModule::AssetCreated(Redirector);
+				Redirector->MarkPackageDirty();
+				OutCreatedPackages.Add(SourcePackage);
+			}
+		}
+	}
+
+	// Moved back if the bake fails
+	PromotionScope->AddPromotedObject(InObject, SourcePackage, SourceName, Redirector);
+
+	HOUDINI_BAKING_MESSAGE(TEXT("Moved temporary asset %s to %s"), *SourceName.ToString(), *InObject->GetPathName());
+
+	return true;
+}
+
 UStaticMesh * 
 FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 	UStaticMesh * InStaticMesh,
@@ -2917,6 +3895,15 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 			PreviousBakeMaterials = InPreviousBakeStaticMesh->GetStaticMaterials();
 		}
 	}
+
+	// If we are replacing the previous bake and the mesh hasn't changed since then, simply reuse the previous bake
+	const uint32 ContentHash = ComputeStaticMeshContentHash(InStaticMesh);
+	if (bPreviousBakeStaticMeshValid && PackageParams.ReplaceMode == EPackageReplaceMode::ReplaceExistingAssets)
+	{
+		uint32 PreviousContentHash = 0;
+		if (GetBakedContentHashFromBakedAsset(InPreviousBakeStaticMesh, PreviousContentHash) && PreviousContentHash == ContentHash)
+			return InPreviousBakeStaticMesh;
+	}
 	FString CreatedPackageName;
 	UPackage* MeshPackage = PackageParams.CreatePackageForObject(CreatedPackageName, BakeCounter);
 	if (!MeshPackage || MeshPackage->IsPendingKill())
@@ -2943,7 +3930,13 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 	UStaticMesh * DuplicatedStaticMesh = nullptr;
 	UStaticMesh* ExistingMesh = FindObject<UStaticMesh>(MeshPackage, *CreatedPackageName);
 	bool bFoundExistingMesh = false;
-	if (IsValid(ExistingMesh))
+	if (CanPromoteTemporaryObject(InStaticMesh, MeshPackage, CreatedPackageName)
+		&& PromoteTemporaryObject(InStaticMesh, MeshPackage, CreatedPackageName, OutCreatedPackages))
+	{
+		// The temporary mesh is not needed anymore, move it instead of duplicating it
+		DuplicatedStaticMesh = InStaticMesh;
+	}
+	else if (IsValid(ExistingMesh))
 	{
 		FStaticMeshComponentRecreateRenderStateContext SMRecreateContext(ExistingMesh);	
 		DuplicatedStaticMesh = DuplicateObject<UStaticMesh>(InStaticMesh, MeshPackage, *CreatedPackageName);
@@ -3020,6 +4013,9 @@ FHoudiniEngineBakeUtils::DuplicateStaticMeshAndCreatePackageIfNeeded(
 	// Assign duplicated materials.
 	DuplicatedStaticMesh->SetStaticMaterials(DuplicatedMaterials);
 
+	// Record the content hash of the temporary mesh, so we can skip it in the next bake if it doesn't change
+	SetBakedContentHashOnBakedAsset(DuplicatedStaticMesh, ContentHash);
+
 	// Notify registry that we have created a new duplicate mesh.
 	if (!bFoundExistingMesh)
 		FAssetRegistryModule::AssetCreated(DuplicatedStaticMesh);
@@ -3591,8 +4587,17 @@ FHoudiniEngineBakeUtils::DuplicateMaterialAndCreatePackage(
 	if (!MaterialPackage || MaterialPackage->IsPendingKill())
 		return nullptr;
 
-	// Clone material.
-	DuplicatedMaterial = DuplicateObject< UMaterial >(Material, MaterialPackage, *CreatedMaterialName);
+	// Clone material, or move it if the temporary material is not needed anymore
+	if (CanPromoteTemporaryObject(Material, MaterialPackage, CreatedMaterialName)
+		&& PromoteTemporaryObject(Material, MaterialPackage, CreatedMaterialName, OutGeneratedPackages))
+	{
+		DuplicatedMaterial = Material;
+	}
+	else
+	{
+		DuplicatedMaterial = DuplicateObject< UMaterial >(Material, MaterialPackage, *CreatedMaterialName);
+	}
+
 	if (!DuplicatedMaterial || DuplicatedMaterial->IsPendingKill())
 		return nullptr;
 
@@ -3721,8 +4726,17 @@ FHoudiniEngineBakeUtils::DuplicateTextureAndCreatePackage(
 		if (!NewTexturePackage || NewTexturePackage->IsPendingKill())
 			return nullptr;
 		
-		// Clone texture.
-		DuplicatedTexture = DuplicateObject< UTexture2D >(Texture, NewTexturePackage, *CreatedTextureName);
+		// Clone texture, or move it if the temporary texture is not needed anymore
+		if (CanPromoteTemporaryObject(Texture, NewTexturePackage, CreatedTextureName)
+			&& PromoteTemporaryObject(Texture, NewTexturePackage, CreatedTextureName, OutCreatedPackages))
+		{
+			DuplicatedTexture = Texture;
+		}
+		else
+		{
+			DuplicatedTexture = DuplicateObject< UTexture2D >(Texture, NewTexturePackage, *CreatedTextureName);
+		}
+
 		if (!DuplicatedTexture || DuplicatedTexture->IsPendingKill())
 			return nullptr;
 
@@ -3774,6 +4788,28 @@ FHoudiniEngineBakeUtils::DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent* Ho
 void 
 FHoudiniEngineBakeUtils::SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld) 
 {
+	// Defer the save to the end of the bake transaction if we have one
+	FHoudiniBakeTransaction* BakeTransaction = FHoudiniBakeTransaction::GetActive();
+	if (BakeTransaction)
+	{
+		BakeTransaction->AddPackagesToSave(PackagesToSave, bSaveCurrentWorld);
+		return;
+	}
+
+	SavePackagesBatched(PackagesToSave, bSaveCurrentWorld);
+}
+
+void
+FHoudiniEngineBakeUtils::SavePackagesBatched(const TArray<UPackage*>& InPackagesToSave, bool bSaveCurrentWorld)
+{
+	TArray<UPackage*> PackagesToSave;
+	PackagesToSave.Reserve(InPackagesToSave.Num() + 1);
+	for (UPackage* Package : InPackagesToSave)
+	{
+		if (IsValid(Package) && Package->IsDirty())
+			PackagesToSave.AddUnique(Package);
+	}
+
 	UWorld * CurrentWorld = nullptr;
 	if (bSaveCurrentWorld && GEditor)
 		CurrentWorld = GEditor->GetEditorWorldContext().World();
@@ -3787,11 +4823,74 @@ FHoudiniEngineBakeUtils::SaveBakedPackages(TArray<UPackage*> & PackagesToSave, b
 		if (CurrentWorldPackage)
 		{
 			CurrentWorldPackage->MarkPackageDirty();
-			PackagesToSave.Add(CurrentWorldPackage);
+			PackagesToSave.AddUnique(CurrentWorldPackage);
+		}
+	}
+
+	if (PackagesToSave.Num() <= 0)
+		return;
+
+	// Check out / make writable all the packages in a single pass
+	TArray<UPackage*> WritablePackages;
+	TArray<UPackage*> PackagesNotNeedingCheckout;
+	const ECommandResult::Type CheckoutResult = FEditorFileUtils::PromptToCheckoutPackages(
+		false, PackagesToSave, &WritablePackages, &PackagesNotNeedingCheckout);
+	if (CheckoutResult == ECommandResult::Cancelled)
+		return;
+
+	WritablePackages.Append(PackagesNotNeedingCheckout);
+
+	// Maps need to go through the editor's map saving path, assets can be saved directly with async file writes
+	TArray<UPackage*> MapPackages;
+	TArray<FString> NewFiles;
+	for (UPackage* Package : WritablePackages)
+	{
+		if (!IsValid(Package))
+			continue;
+
+		if (UWorld::FindWorldInPackage(Package))
+		{
+			MapPackages.Add(Package);
+			continue;
+		}
+
+		const FString PackageFilename = FPackageName::LongPackageNameToFilename(
+			Package->GetName(), FPackageName::GetAssetPackageExtension());
+		const bool bIsNewFile = !IFileManager::Get().FileExists(*PackageFilename);
+
+		if (!UPackage::SavePackage(Package, nullptr, RF_Standalone, *PackageFilename, GError, nullptr, false, true, SAVE_NoError | SAVE_Async))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to save baked package %s"), *Package->GetName());
+			continue;
 		}
+
+		if (bIsNewFile)
+			NewFiles.Add(FPaths::ConvertRelativePathToFull(PackageFilename));
+	}
+
+	if (MapPackages.Num() > 0)
+		FEditorFileUtils::PromptForCheckoutAndSave(MapPackages, true, false);
+
+	// Wait for all the async writes to complete
+	UPackage::WaitForAsyncFileWrites();
+
+	// Add the new files to source control in one operation
+	ISourceControlModule& SourceControlModule = ISourceControlModule::Get();
+	if (NewFiles.Num() > 0 && SourceControlModule.IsEnabled() && SourceControlModule.GetProvider().IsAvailable())
+		SourceControlModule.GetProvider().Execute(ISourceControlOperation::Create<FMarkForAdd>(), NewFiles);
+}
+
+void
+FHoudiniEngineBakeUtils::CollectGarbageAfterBake()
+{
+	FHoudiniBakeTransaction* BakeTransaction = FHoudiniBakeTransaction::GetActive();
+	if (BakeTransaction)
+	{
+		BakeTransaction->RequestGarbageCollection();
+		return;
 	}
 
-	FEditorFileUtils::PromptForCheckoutAndSave(PackagesToSave, true, false);
+	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
 }
 
 bool
@@ -4240,6 +5339,12 @@ FHoudiniEngineBakeUtils::BakePDGWorkResultObject(
 			return true;
 		}
 
+		if (bInIsAutoBake && WorkResultObject.bWaitingForLoadBudget)
+		{
+			HOUDINI_LOG_MESSAGE(TEXT("[FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors]: WorkResultObject (%s) is waiting for the load budget, it will be auto-baked once loaded."), *WorkResultObject.Name);
+			return true;
+		}
+
 		HOUDINI_LOG_WARNING(TEXT("[FHoudiniEngineBakeUtils::BakePDGTOPNodeOutputsKeepActors]: WorkResultObject (%s) is not loaded, cannot bake it."), *WorkResultObject.Name);
 		return false;
 	}
@@ -4365,12 +5470,13 @@ FHoudiniEngineBakeUtils::CheckPDGAutoBakeAfterResultObjectLoaded(
 	if (!InNode->AreAllWorkItemsComplete() || InNode->AnyWorkItemsFailed())
 		return;
 
-	// Check if the node is ready for baking: all work items must be loaded
+	// Check if the node is ready for baking: all work items must be loaded. Results held back or unloaded
+	// by the load budget can't all be loaded at once: they are baked when the budget loads them.
 	for (const FTOPWorkResult& WorkResult : InNode->WorkResult)
 	{
 		for (const FTOPWorkResultObject& WRO : WorkResult.ResultObjects)
 		{
-			if (WRO.State != EPDGWorkResultState::Loaded && !WRO.AutoBakedSinceLastLoad())
+			if (WRO.State != EPDGWorkResultState::Loaded && !WRO.AutoBakedSinceLastLoad() && !WRO.bWaitingForLoadBudget)
 				return;
 		}
 	}
@@ -4406,6 +5512,10 @@ FHoudiniEngineBakeUtils::CheckPDGAutoBakeAfterResultObjectLoaded(
 			break;
 	}
 
+	// Auto-bakes are triggered as work result objects are loaded: batch all the saves and garbage collections
+	// of the auto-bakes of this frame and do them on the next tick
+	FHoudiniBakeTransaction::GetOrCreateDeferredTransaction();
+
 	const bool bIsAutoBake = true;
 	switch (InPDGAssetLink->HoudiniEngineBakeOption)
 	{
@@ -4952,7 +6062,7 @@ FHoudiniEngineBakeUtils::BakePDGTOPNodeBlueprints(UHoudiniPDGAssetLink* InPDGAss
 		FHoudiniEngine::Get().FinishTaskSlateNotification( FText::FromString(Msg) );
 	}
 	
-	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	CollectGarbageAfterBake();
 
 	return bSuccess;
 }
@@ -5050,7 +6160,7 @@ FHoudiniEngineBakeUtils::BakePDGAssetLinkBlueprints(UHoudiniPDGAssetLink* InPDGA
 		FHoudiniEngine::Get().FinishTaskSlateNotification( FText::FromString(Msg) );
 	}
 	
-	TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	CollectGarbageAfterBake();
 
 	return bSuccess;
 }
@@ -5446,6 +6556,15 @@ FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(UObject* InOuter, const UC
 			return CurrentName.ToString();
 	}
 
+	// During a bake, resume the search after the last number suffix we assigned for a given outer/name
+	// instead of probing every suffix again for each object. This is scoped to the bake transaction so
+	// suffixes freed between bakes are reused.
+	FHoudiniBakeTransaction* BakeTransaction = FHoudiniBakeTransaction::GetActive();
+	TMap<FString, int32>* LastAssignedNumbers = BakeTransaction ? &BakeTransaction->GetLastAssignedNameNumbers() : nullptr;
+	const FString NumberKey = LastAssignedNumbers
+		? (InOuter == ANY_PACKAGE ? FString(TEXT("ANY_PACKAGE")) : (IsValid(InOuter) ? InOuter->GetPathName() : FString())) + TEXT(":") + InName
+		: FString();
+
 	UObject* ExistingObject = nullptr;
 	FName CandidateName(InName);
 	bool bAppendedNumber = false;
@@ -5468,7 +6587,8 @@ FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(UObject* InOuter, const UC
 			if (!bAppendedNumber)
 			{
 				const bool bSplitName = false;
-				CandidateName = FName(*InName, NAME_EXTERNAL_TO_INTERNAL(1), FNAME_Add, bSplitName);
+				const int32* LastNumber = LastAssignedNumbers ? LastAssignedNumbers->Find(NumberKey) : nullptr;
+				CandidateName = FName(*InName, NAME_EXTERNAL_TO_INTERNAL(LastNumber ? *LastNumber + 1 : 1), FNAME_Add, bSplitName);
 				bAppendedNumber = true;
 			}
 			else
@@ -5479,6 +6599,9 @@ FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded(UObject* InOuter, const UC
 		}
 	} while (ExistingObject);
 
+	if (bAppendedNumber && LastAssignedNumbers)
+		LastAssignedNumbers->Add(NumberKey, NAME_INTERNAL_TO_EXTERNAL(CandidateName.GetNumber()));
+
 	return CandidateName.ToString();
 }
 
@@ -5573,4 +6696,377 @@ FHoudiniEngineBakeUtils::DestroyPreviousBakeOutput(
 	return NumDeleted;
 }
 
+// Returns true if the asset was created by a cook in the temporary folder, its path then changes with every cook
+static bool
+IsTemporaryCookAsset(const UObject* InAsset)
+{
+	FString TempGUID;
+	return FHoudiniPackageParams::GetGUIDFromTempAsset(InAsset, TempGUID);
+}
+
+// Fingerprint of a texture: its source data for the textures created by cooks, its path otherwise
+static uint32
+ComputeTextureContentHash(UTexture* InTexture)
+{
+	if (!IsValid(InTexture))
+		return 0;
+
+	if (!IsTemporaryCookAsset(InTexture))
+		return GetTypeHash(InTexture->GetPathName());
+
+	FTextureSource& Source = InTexture->Source;
+	uint32 Hash = HashCombine(GetTypeHash(Source.GetSizeX()), GetTypeHash(Source.GetSizeY()));
+	Hash = HashCombine(Hash, GetTypeHash((int32)Source.GetFormat()));
+	if (!Source.IsValid())
+		return Hash;
+
+	const int64 MipSize = Source.CalcMipSize(0);
+	const uint8* MipData = Source.LockMip(0);
+	if (MipData && MipSize > 0)
+		Hash = FCrc::MemCrc32(MipData, MipSize, Hash);
+	Source.UnlockMip(0);
+
+	return Hash;
+}
+
+// Fingerprint of a material: for the materials (and instances) created by cooks, the source material they're
+// based on and the values/textures they assign, as their own paths change with every cook.
+static uint32
+ComputeMaterialContentHash(UMaterialInterface* InMaterial)
+{
+	if (!IsValid(InMaterial))
+		return 0;
+
+	if (!IsTemporaryCookAsset(InMaterial))
+		return GetTypeHash(InMaterial->GetPathName());
+
+	uint32 Hash = 0;
+	if (UMaterialInstance* MaterialInstance = Cast<UMaterialInstance>(InMaterial))
+	{
+		Hash = ComputeMaterialContentHash(MaterialInstance->Parent);
+
+		for (const FScalarParameterValue& Param : MaterialInstance->ScalarParameterValues)
+			Hash = HashCombine(Hash, HashCombine(GetTypeHash(Param.ParameterInfo.Name), GetTypeHash(Param.ParameterValue)));
+
+		for (const FVectorParameterValue& Param : MaterialInstance->VectorParameterValues)
+			Hash = FCrc::MemCrc32(&Param.ParameterValue, sizeof(FLinearColor), HashCombine(Hash, GetTypeHash(Param.ParameterInfo.Name)));
+
+		for (const FTextureParameterValue& Param : MaterialInstance->TextureParameterValues)
+			Hash = HashCombine(Hash, HashCombine(GetTypeHash(Param.ParameterInfo.Name), ComputeTextureContentHash(Param.ParameterValue)));
+	}
+	else if (UMaterial* Material = Cast<UMaterial>(InMaterial))
+	{
+		// Materials generated from Houdini's material nodes: their constants and textures
+		for (UMaterialExpression* Expression : Material->Expressions)
+		{
+			if (!IsValid(Expression))
+				continue;
+
+			Hash = HashCombine(Hash, GetTypeHash(Expression->GetClass()->GetFName()));
+			if (UMaterialExpressionTextureSample* TextureSample = Cast<UMaterialExpressionTextureSample>(Expression))
+				Hash = HashCombine(Hash, ComputeTextureContentHash(TextureSample->Texture));
+			else if (UMaterialExpressionConstant* Constant = Cast<UMaterialExpressionConstant>(Expression))
+				Hash = HashCombine(Hash, GetTypeHash(Constant->R));
+			else if (UMaterialExpressionConstant3Vector* Constant3 = Cast<UMaterialExpressionConstant3Vector>(Expression))
+				Hash = FCrc::MemCrc32(&Constant3->Constant, sizeof(FLinearColor), Hash);
+			else if (UMaterialExpressionConstant4Vector* Constant4 = Cast<UMaterialExpressionConstant4Vector>(Expression))
+				Hash = FCrc::MemCrc32(&Constant4->Constant, sizeof(FLinearColor), Hash);
+			else if (UMaterialExpressionScalarParameter* ScalarParam = Cast<UMaterialExpressionScalarParameter>(Expression))
+				Hash = HashCombine(Hash, GetTypeHash(ScalarParam->DefaultValue));
+			else if (UMaterialExpressionVectorParameter* VectorParam = Cast<UMaterialExpressionVectorParameter>(Expression))
+				Hash = FCrc::MemCrc32(&VectorParam->DefaultValue, sizeof(FLinearColor), Hash);
+		}
+	}
+
+	return Hash;
+}
+
+// Fingerprint of a mesh description's geometry
+static uint32
+ComputeMeshDescriptionHash(const FMeshDescription& InMeshDescription, uint32 InHash)
+{
+	FStaticMeshConstAttributes Attributes(InMeshDescription);
+	TVertexAttributesConstRef<FVector> VertexPositions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesConstRef<FVector> VertexInstanceNormals = Attributes.GetVertexInstanceNormals();
+	TVertexInstanceAttributesConstRef<FVector4> VertexInstanceColors = Attributes.GetVertexInstanceColors();
+	TVertexInstanceAttributesConstRef<FVector2D> VertexInstanceUVs = Attributes.GetVertexInstanceUVs();
+
+	uint32 Hash = HashCombine(InHash, GetTypeHash(InMeshDescription.Vertices().Num()));
+	Hash = HashCombine(Hash, GetTypeHash(InMeshDescription.Triangles().Num()));
+
+	if (VertexPositions.IsValid())
+	{
+		for (const FVertexID VertexID : InMeshDescription.Vertices().GetElementIDs())
+		{
+			const FVector Position = VertexPositions[VertexID];
+			Hash = FCrc::MemCrc32(&Position, sizeof(FVector), Hash);
+		}
+	}
+
+	const int32 NumUVChannels = VertexInstanceUVs.IsValid() ? VertexInstanceUVs.GetNumIndices() : 0;
+	for (const FVertexInstanceID VertexInstanceID : InMeshDescription.VertexInstances().GetElementIDs())
+	{
+		const FVertexID VertexID = InMeshDescription.GetVertexInstanceVertex(VertexInstanceID);
+		Hash = HashCombine(Hash, GetTypeHash(VertexID.GetValue()));
+
+		if (VertexInstanceNormals.IsValid())
+		{
+			const FVector Normal = VertexInstanceNormals[VertexInstanceID];
+			Hash = FCrc::MemCrc32(&Normal, sizeof(FVector), Hash);
+		}
+		if (VertexInstanceColors.IsValid())
+		{
+			const FVector4 Color = VertexInstanceColors[VertexInstanceID];
+			Hash = FCrc::MemCrc32(&Color, sizeof(FVector4), Hash);
+		}
+		for (int32 UVIndex = 0; UVIndex < NumUVChannels; UVIndex++)
+		{
+			const FVector2D UV = VertexInstanceUVs.Get(VertexInstanceID, UVIndex);
+			Hash = FCrc::MemCrc32(&UV, sizeof(FVector2D), Hash);
+		}
+	}
+
+	for (const FTriangleID TriangleID : InMeshDescription.Triangles().GetElementIDs())
+	{
+		for (const FVertexInstanceID VertexInstanceID : InMeshDescription.GetTriangleVertexInstances(TriangleID))
+			Hash = HashCombine(Hash, GetTypeHash(VertexInstanceID.GetValue()));
+		Hash = HashCombine(Hash, GetTypeHash(InMeshDescription.GetTrianglePolygonGroup(TriangleID).GetValue()));
+	}
+
+	return Hash;
+}
+
+// Fingerprint of the exported values of a struct's/object's properties.
+// Only the properties in InPropertyNames are hashed, if it isn't empty.
+static uint32
+ComputePropertiesHash(const UStruct* InStruct, const void* InContainer, const TArray<FName>& InPropertyNames, uint32 InHash)
+{
+	if (!InStruct || !InContainer)
+		return InHash;
+
+	uint32 Hash = InHash;
+	for (TFieldIterator<FProperty> PropIt(InStruct); PropIt; ++PropIt)
+	{
+		FProperty* Property = *PropIt;
+		if (!Property || Property->HasAnyPropertyFlags(CPF_Transient))
+			continue;
+
+		if (InPropertyNames.Num() > 0 && !InPropertyNames.Contains(Property->GetFName()))
+			continue;
+
+		for (int32 Idx = 0; Idx < Property->ArrayDim; Idx++)
+		{
+			FString ValueStr;
+			Property->ExportTextItem(ValueStr, Property->ContainerPtrToValuePtr<void>(InContainer, Idx), nullptr, nullptr, PPF_None);
+			Hash = HashCombine(Hash, GetTypeHash(Property->GetFName()));
+			Hash = HashCombine(Hash, GetTypeHash(ValueStr));
+		}
+	}
+
+	return Hash;
+}
+
+uint32
+FHoudiniEngineBakeUtils::ComputeStaticMeshContentHash(UStaticMesh* InStaticMesh)
+{
+	if (!IsValid(InStaticMesh))
+		return 0;
+
+	// Geometry of all the LODs: hash the source mesh descriptions, which are identical for identical cooks
+	// (the render data's DDC key can't be used, it changes with every cook), and the LODs' build/reduction settings.
+	const int32 NumSourceModels = InStaticMesh->GetNumSourceModels();
+	uint32 Hash = GetTypeHash(NumSourceModels);
+	bool bHasMeshDescriptions = false;
+	for (int32 LODIndex = 0; LODIndex < NumSourceModels; LODIndex++)
+	{
+		Hash = ComputePropertiesHash(FStaticMeshSourceModel::StaticStruct(), &InStaticMesh->GetSourceModel(LODIndex), TArray<FName>(), Hash);
+
+		const FMeshDescription* MeshDescription = InStaticMesh->GetMeshDescription(LODIndex);
+		if (!MeshDescription)
+			continue;
+
+		Hash = ComputeMeshDescriptionHash(*MeshDescription, Hash);
+		bHasMeshDescriptions = true;
+	}
+
+	if (!bHasMeshDescriptions)
+	{
+		// No mesh description, fallback to hashing the vertices and indices of all the LODs
+		FStaticMeshRenderData* RenderData = InStaticMesh->GetRenderData();
+		if (RenderData)
+		{
+			TArray<uint32> Indices;
+			for (const FStaticMeshLODResources& LODResources : RenderData->LODResources)
+			{
+				const FPositionVertexBuffer& Positions = LODResources.VertexBuffers.PositionVertexBuffer;
+				if (Positions.GetNumVertices() > 0 && Positions.GetVertexData())
+					Hash = FCrc::MemCrc32(Positions.GetVertexData(), Positions.GetNumVertices() * Positions.GetStride(), Hash);
+
+				Indices.Reset();
+				LODResources.IndexBuffer.GetCopy(Indices);
+				if (Indices.Num() > 0)
+					Hash = FCrc::MemCrc32(Indices.GetData(), Indices.Num() * sizeof(uint32), Hash);
+			}
+		}
+	}
+
+	// Simple and complex collision
+	UBodySetup* BodySetup = InStaticMesh->GetBodySetup();
+	if (IsValid(BodySetup))
+	{
+		static const TArray<FName> BodySetupProperties = { TEXT("AggGeom"), TEXT("CollisionTraceFlag"), TEXT("bDoubleSidedGeometry") };
+		Hash = ComputePropertiesHash(UBodySetup::StaticClass(), BodySetup, BodySetupProperties, Hash);
+	}
+
+	// Sockets
+	for (const UStaticMeshSocket* Socket : InStaticMesh->Sockets)
+	{
+		if (IsValid(Socket))
+			Hash = ComputePropertiesHash(UStaticMeshSocket::StaticClass(), Socket, TArray<FName>(), Hash);
+	}
+
+	// Build, lightmap and LOD settings of the mesh
+	static const TArray<FName> StaticMeshProperties = {
+		TEXT("LightMapResolution"),
+		TEXT("LightMapCoordinateIndex"),
+		TEXT("LightmapUVDensity"),
+		TEXT("LODGroup"),
+		TEXT("MinLOD"),
+		TEXT("bAutoComputeLODScreenSize"),
+		TEXT("bGenerateMeshDistanceField"),
+		TEXT("bAllowCPUAccess"),
+		TEXT("bSupportUniformlyDistributedSampling"),
+		TEXT("DistanceFieldSelfShadowBias"),
+		TEXT("PositiveBoundsExtension"),
+		TEXT("NegativeBoundsExtension")
+	};
+	Hash = ComputePropertiesHash(UStaticMesh::StaticClass(), InStaticMesh, StaticMeshProperties, Hash);
+
+	// Materials: the source materials and the values/textures assigned by the cook
+	for (const FStaticMaterial& StaticMaterial : InStaticMesh->GetStaticMaterials())
+	{
+		Hash = HashCombine(Hash, GetTypeHash(StaticMaterial.MaterialSlotName));
+		Hash = HashCombine(Hash, ComputeMaterialContentHash(StaticMaterial.MaterialInterface));
+	}
+
+	return Hash;
+}
+
+uint32
+FHoudiniEngineBakeUtils::ComputeTransformsHash(const TArray<FTransform>& InTransforms)
+{
+	uint32 Hash = GetTypeHash(InTransforms.Num());
+	for (const FTransform& Transform : InTransforms)
+	{
+		const FVector Translation = Transform.GetTranslation();
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector Scale = Transform.GetScale3D();
+		Hash = FCrc::MemCrc32(&Translation, sizeof(FVector), Hash);
+		Hash = FCrc::MemCrc32(&Rotation, sizeof(FQuat), Hash);
+		Hash = FCrc::MemCrc32(&Scale, sizeof(FVector), Hash);
+	}
+
+	return Hash;
+}
+
+uint32
+FHoudiniEngineBakeUtils::ComputeOutputObjectAttributesHash(const FHoudiniOutputObject& InOutputObject, const FHoudiniPackageParams& InPackageParams)
+{
+	uint32 Hash = GetTypeHash(InOutputObject.BakeName);
+	Hash = HashCombine(Hash, GetTypeHash(InPackageParams.ObjectName));
+	Hash = HashCombine(Hash, GetTypeHash(InPackageParams.BakeFolder));
+
+	// The maps are not ordered, combine the hashes of their entries commutatively
+	uint32 AttributesHash = 0;
+	for (const auto& Pair : InOutputObject.CachedAttributes)
+		AttributesHash ^= HashCombine(GetTypeHash(Pair.Key), GetTypeHash(Pair.Value));
+	Hash = HashCombine(Hash, AttributesHash);
+
+	uint32 TokensHash = 0;
+	for (const auto& Pair : InOutputObject.CachedTokens)
+		TokensHash ^= HashCombine(GetTypeHash(Pair.Key), GetTypeHash(Pair.Value));
+	Hash = HashCombine(Hash, TokensHash);
+
+	return Hash;
+}
+
+bool
+FHoudiniEngineBakeUtils::GetBakedContentHashFromBakedAsset(const UObject* InAsset, uint32& OutContentHash)
+{
+	OutContentHash = 0;
+	if (!IsValid(InAsset))
+		return false;
+
+	UPackage* Package = InAsset->GetOutermost();
+	if (!IsValid(Package))
+		return false;
+
+	UMetaData* MetaData = Package->GetMetaData();
+	if (!IsValid(MetaData))
+		return false;
+
+	const FString* HashStr = MetaData->RootMetaDataMap.Find(HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH);
+	if (!HashStr || !HashStr->IsNumeric())
+		return false;
+
+	OutContentHash = (uint32)FCString::Strtoui64(**HashStr, nullptr, 10);
+	return true;
+}
+
+void
+FHoudiniEngineBakeUtils::SetBakedContentHashOnBakedAsset(UObject* InAsset, uint32 InContentHash)
+{
+	if (!IsValid(InAsset))
+		return;
+
+	UPackage* Package = InAsset->GetOutermost();
+	if (!IsValid(Package))
+		return;
+
+	UMetaData* MetaData = Package->GetMetaData();
+	if (IsValid(MetaData))
+		MetaData->RootMetaDataMap.Add(HAPI_UNREAL_PACKAGE_META_BAKE_CONTENT_HASH, FString::Printf(TEXT("%u"), InContentHash));
+}
+
+EHoudiniBakePlanAction
+FHoudiniEngineBakeUtils::PlanOutputObjectBake(
+	const FHoudiniBakedOutputObject& InPreviousBakedOutputObject,
+	uint32 InContentHash,
+	uint32 InTransformHash,
+	uint32 InAttributesHash,
+	bool bInReplaceActors,
+	bool bInReplaceAssets)
+{
+	// Incremental bakes always create new actors/assets
+	if (!bInReplaceActors || !bInReplaceAssets)
+		return EHoudiniBakePlanAction::Rebake;
+
+	// The asset or the attributes have changed
+	if (InContentHash == 0 || InPreviousBakedOutputObject.BakedContentHash != InContentHash)
+		return EHoudiniBakePlanAction::Rebake;
+
+	if (InPreviousBakedOutputObject.BakedAttributesHash != InAttributesHash)
+		return EHoudiniBakePlanAction::Rebake;
+
+	// Make sure the previous bake's asset is still the one we baked
+	UObject* PreviousBakedObject = InPreviousBakedOutputObject.GetBakedObjectIfValid();
+	uint32 PreviousContentHash = 0;
+	if (!GetBakedContentHashFromBakedAsset(PreviousBakedObject, PreviousContentHash) || PreviousContentHash != InContentHash)
+		return EHoudiniBakePlanAction::Rebake;
+
+	// ... and that its actor and component still exist
+	AActor* PreviousActor = InPreviousBakedOutputObject.GetActorIfValid();
+	UStaticMeshComponent* PreviousSMC = Cast<UStaticMeshComponent>(InPreviousBakedOutputObject.GetBakedComponentIfValid());
+	if (!IsValid(PreviousActor) || !IsValid(PreviousSMC) || PreviousSMC->GetOwner() != PreviousActor)
+		return EHoudiniBakePlanAction::Rebake;
+
+	if (PreviousSMC->GetStaticMesh() != PreviousBakedObject)
+		return EHoudiniBakePlanAction::Rebake;
+
+	if (InPreviousBakedOutputObject.BakedTransformHash != InTransformHash)
+		return EHoudiniBakePlanAction::UpdateTransform;
+
+	return EHoudiniBakePlanAction::Skip;
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
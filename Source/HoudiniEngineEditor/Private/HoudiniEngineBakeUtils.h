@@ -36,6 +36,7 @@ class ALandscapeProxy;
 class UStaticMesh;
 class USplineComponent;
 class UPackage;
+class UObjectRedirector;
 class UWorld;
 class AActor;
 class UHoudiniSplineComponent;
@@ -70,6 +71,17 @@ enum class EHoudiniInstancerComponentType : uint8
 	FoliageAsHierarchicalInstancedStaticMeshComponent
 };
 
+// What needs to be done for an output object when baking it again
+enum class EHoudiniBakePlanAction : uint8
+{
+	// The output object has changed: bake the asset and actor again
+	Rebake,
+	// Only the transform of the output object has changed: update the previously baked component's transform
+	UpdateTransform,
+	// Nothing has changed since the previous bake: keep the previously baked asset and actor
+	Skip
+};
+
 // Helper struct to track actors created/used when baking, with
 // the intended bake name (before making it unique), and their
 // output index and output object identifier.
@@ -138,6 +150,105 @@ struct HOUDINIENGINEEDITOR_API FHoudiniEngineBakedActor
 	
 };
 
+// While one of these is in scope, the temporary assets (meshes, materials, textures) of the HAC being baked
+// are moved (renamed) to their bake package instead of being duplicated, as long as no other HAC uses them.
+// This must only be used when the HAC's outputs are cleared after the bake (bake and replace / remove output).
+struct HOUDINIENGINEEDITOR_API FHoudiniBakePromotionScope
+{
+	FHoudiniBakePromotionScope(UHoudiniAssetComponent* InHAC);
+	~FHoudiniBakePromotionScope();
+
+	// Returns the active promotion scope, or null if temporary assets must be duplicated
+	static FHoudiniBakePromotionScope* GetActive() { return ActiveScope; };
+
+	// Returns true if InObject is not used by the outputs of other HACs
+	bool IsObjectShared(UObject* InObject) const { return SharedObjects.Contains(InObject); };
+
+	// Records an object that was moved to its bake package, and the redirector left in its place if any
+	void AddPromotedObject(UObject* InObject, UPackage* InSourcePackage, const FName& InSourceName, UObjectRedirector* InRedirector);
+
+	// Moves the promoted objects back to their temporary packages, called when the bake failed and the
+	// HAC keeps its outputs
+	void RevertPromotedObjects();
+
+private:
+
+	// Adds an object and the temporary objects it depends on (materials, textures) to the shared objects
+	void AddSharedObject(UObject* InObject);
+
+	// Objects used by the outputs of HACs other than the one we are baking
+	TSet<UObject*> SharedObjects;
+
+	struct FPromotedObject
+	{
+		TWeakObjectPtr<UObject> Object;
+		TWeakObjectPtr<UPackage> SourcePackage;
+		FName SourceName;
+		TWeakObjectPtr<UObjectRedirector> Redirector;
+	};
+
+	// Objects moved to their bake package, in promotion order
+	TArray<FPromotedObject> PromotedObjects;
+
+	// The previous active scope, scopes can be nested
+	FHoudiniBakePromotionScope* PreviousScope;
+
+	static FHoudiniBakePromotionScope* ActiveScope;
+};
+
+// Collects the packages to save and the garbage collection requests of all the bakes that happen while it
+// is active (multiple HACs, PDG work items...). When committed (or destroyed), all the packages are checked out
+// in one pass, saved with async file writes, and a single garbage collection is run.
+// Transactions can be nested, only the outermost one commits.
+struct HOUDINIENGINEEDITOR_API FHoudiniBakeTransaction
+{
+	FHoudiniBakeTransaction();
+	~FHoudiniBakeTransaction();
+
+	// Returns the outermost active transaction, if any
+	static FHoudiniBakeTransaction* GetActive() { return ActiveTransaction; };
+
+	// Returns the active transaction, or creates one that will be committed on the next editor tick.
+	// Used to batch the saves of bakes that are triggered by events (ie, PDG auto-bake).
+	static FHoudiniBakeTransaction* GetOrCreateDeferredTransaction();
+
+	// Adds packages to save when the transaction is committed
+	void AddPackagesToSave(const TArray<UPackage*>& InPackages, bool bInSaveCurrentWorld = false);
+
+	// Requests a garbage collection after the packages have been saved
+	void RequestGarbageCollection() { bCollectGarbage = true; };
+
+	// Last number suffix assigned to object names per outer/name during this transaction,
+	// see FHoudiniEngineBakeUtils::MakeUniqueObjectNameIfNeeded()
+	TMap<FString, int32>& GetLastAssignedNameNumbers() { return LastAssignedNameNumbers; };
+
+	// Saves the packages and runs the garbage collection if needed.
+	void Commit();
+
+private:
+
+	// Packages to save, in order. Weak pointers, as deferred transactions are only committed on the next
+	// tick and the packages might be garbage collected in the meantime.
+	TArray<TWeakObjectPtr<UPackage>> PackagesToSave;
+
+	// See GetLastAssignedNameNumbers()
+	TMap<FString, int32> LastAssignedNameNumbers;
+
+	// Indicates that the current world should be saved as well
+	bool bSaveCurrentWorld;
+
+	// Indicates that a garbage collection has been requested
+	bool bCollectGarbage;
+
+	// Indicates this is the outermost transaction
+	bool bIsOutermost;
+
+	// Indicates the transaction has been committed
+	bool bCommitted;
+
+	static FHoudiniBakeTransaction* ActiveTransaction;
+};
+
 struct HOUDINIENGINEEDITOR_API FHoudiniEngineBakeUtils
 {
 public:
@@ -281,6 +392,25 @@ public:
 		AActor* InFallbackActor=nullptr,
 		const FString& InFallbackWorldOutlinerFolder="");
 
+	// Bakes the ISMC/HISMC/MSIC output objects of an instancer output together (UHoudiniRuntimeSettings::bBulkBakeInstancers).
+	// The baked instanced components are built directly from the instance transforms, and the instancers that share the
+	// same baked mesh, materials and bake actor are merged in one component.
+	static bool BakeInstancerOutputToActors_Bulk(
+		const UHoudiniAssetComponent* HoudiniAssetComponent,
+		int32 InOutputIndex,
+		const TArray<UHoudiniOutput*>& InAllOutputs,
+		const TArray<FHoudiniOutputObjectIdentifier>& InOutputObjectIdentifiers,
+		TMap<FHoudiniBakedOutputObjectIdentifier, FHoudiniBakedOutputObject>& InBakedOutputObjects,
+		const FTransform& InTransform,
+		const FDirectoryPath& InBakeFolder,
+		const FDirectoryPath& InTempCookFolder,
+		bool bInReplaceActors,
+		bool bInReplaceAssets,
+		TArray<FHoudiniEngineBakedActor>& OutActors,
+		TArray<UPackage*>& OutPackagesToSave,
+		AActor* InFallbackActor=nullptr,
+		const FString& InFallbackWorldOutlinerFolder="");
+
 	static bool BakeInstancerOutputToActors_SMC(
 		const UHoudiniAssetComponent* HoudiniAssetComponent,
 		int32 InOutputIndex,
@@ -298,6 +428,13 @@ public:
 		AActor* InFallbackActor=nullptr,
 		const FString& InFallbackWorldOutlinerFolder="");
 
+	// Returns true if the temporary InObject can be moved to InPackage/InName instead of being duplicated.
+	static bool CanPromoteTemporaryObject(UObject* InObject, UPackage* InPackage, const FString& InName);
+
+	// Moves the temporary InObject to InPackage/InName, all references to the object are kept.
+	// If the object's previous package exists on disk and is referenced, a redirector is left in place.
+	static bool PromoteTemporaryObject(UObject* InObject, UPackage* InPackage, const FString& InName, TArray<UPackage*>& OutCreatedPackages);
+
 	static UStaticMesh * DuplicateStaticMeshAndCreatePackageIfNeeded(
 		UStaticMesh * InStaticMesh,
 		UStaticMesh * InPreviousBakeStaticMesh,
@@ -442,8 +579,15 @@ public:
 
 	static bool DeleteBakedHoudiniAssetActor(UHoudiniAssetComponent* HoudiniAssetComponent);
 
+	// Save the baked packages. If a bake transaction is active, the packages are saved when it is committed.
 	static void SaveBakedPackages(TArray<UPackage*> & PackagesToSave, bool bSaveCurrentWorld = false);
 
+	// Checks out the packages in one source control pass, then saves them using async file writes.
+	static void SavePackagesBatched(const TArray<UPackage*>& InPackagesToSave, bool bSaveCurrentWorld = false);
+
+	// Runs a garbage collection after a bake, or defers it to the end of the active bake transaction.
+	static void CollectGarbageAfterBake();
+
 	// Look for InObjectToFind among InOutputs. Return true if found and set OutOutputIndex and OutIdentifier.
 	static bool FindOutputObject(
 		const UObject* InObjectToFind, EHoudiniOutputType InOutputType, const TArray<UHoudiniOutput*> InOutputs, int32& OutOutputIndex, FHoudiniOutputObjectIdentifier &OutIdentifier);
@@ -634,6 +778,17 @@ protected:
 		const TArray<FHoudiniGeoPartObject>& InHGPOs,
 		FHoudiniGeoPartObject const*& OutHGPO);
 
+	// Reserves, in one batch, the package names of the temporary static meshes that a bake of InOutputs creates
+	// as new assets. The reserved names are claimed by CreatePackageForObject(), the unused ones must be released
+	// with FHoudiniPackageNameAllocator::ReleaseReservedCounters() once the outputs are baked.
+	static void ReserveStaticMeshBakePackageNames(
+		const UHoudiniAssetComponent* HoudiniAssetComponent,
+		const TArray<UHoudiniOutput*>& InOutputs,
+		const FString& InHoudiniAssetName,
+		const FDirectoryPath& InBakeFolder,
+		const FDirectoryPath& InTempCookFolder,
+		TArray<EHoudiniOutputType> const* InOutputTypesToBake);
+
 	// Set OutBakeName to the resolved output name of InMeshOutputObject / InObject. OutBakeName is set to the object's
 	// BakeName (the BakeName on the InMeshOutputObject, or if that is not set, the custom part name or finally the
 	// package name.
@@ -688,4 +843,27 @@ protected:
 		bool bInDestroyBakedComponent,
 		bool bInDestroyBakedInstancedActors,
 		bool bInDestroyBakedInstancedComponents);
+
+	// Fingerprint of a static mesh's LODs, collision, sockets, build settings and materials
+	static uint32 ComputeStaticMeshContentHash(UStaticMesh* InStaticMesh);
+
+	// Fingerprint of an array of transforms
+	static uint32 ComputeTransformsHash(const TArray<FTransform>& InTransforms);
+
+	// Fingerprint of the output object's attributes and of the resolved bake names/paths
+	static uint32 ComputeOutputObjectAttributesHash(const FHoudiniOutputObject& InOutputObject, const FHoudiniPackageParams& InPackageParams);
+
+	// Get/Set the content hash recorded in a baked asset's package metadata. Get returns false if there is none.
+	static bool GetBakedContentHashFromBakedAsset(const UObject* InAsset, uint32& OutContentHash);
+	static void SetBakedContentHashOnBakedAsset(UObject* InAsset, uint32 InContentHash);
+
+	// Compares the fingerprints of an output object with the ones recorded in its previous bake, and
+	// determines if it needs to be baked again. Only replace bakes (actors and assets) can skip output objects.
+	static EHoudiniBakePlanAction PlanOutputObjectBake(
+		const FHoudiniBakedOutputObject& InPreviousBakedOutputObject,
+		uint32 InContentHash,
+		uint32 InTransformHash,
+		uint32 InAttributesHash,
+		bool bInReplaceActors,
+		bool bInReplaceAssets);
 };
@@ -38,6 +38,7 @@
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniStaticMesh.h"
 #include "HoudiniOutput.h"
+#include "HoudiniTempPackageTracker.h"
 
 #include "DesktopPlatformModule.h"
 #include "Interfaces/IMainFrameModule.h"
@@ -46,7 +47,6 @@
 #include "Async/Async.h"
 #include "FileHelpers.h"
 #include "AssetRegistryModule.h"
-#include "Engine/ObjectLibrary.h"
 #include "ObjectTools.h"
 #include "CoreGlobals.h"
 #include "HoudiniEngineOutputStats.h"
@@ -249,139 +249,284 @@ FHoudiniEngineCommands::OnlineForum()
 	FPlatformProcess::LaunchURL(HAPI_UNREAL_ONLINE_FORUM_URL, nullptr, nullptr);
 }
 
-void
-FHoudiniEngineCommands::CleanUpTempFolder()
+// Deletes the temporary packages matched by InFilter that aren't reachable anymore, in a single pass over the
+// AssetRegistry's dependency graph.
+// The roots are the packages referenced from outside of the filtered set (levels, blueprints, baked assets...)
+// and the outputs of the live Houdini Asset Components, everything they depend on is kept.
+// The unreachable packages are then deleted in topological order (referencers first: meshes, then materials,
+// then textures...), one batch per dependency level. Packages still referenced in memory or by the undo buffer
+// are kept.
+// Returns the number of deleted assets.
+static int32
+DeleteUnreachableTempPackages(const FARFilter& InFilter)
 {
-	// TODO: Improve me! slow now that we also have SM saved in the temp directory
-	// Due to the ref, we probably iterate a little too much, and should maybe do passes following the order of refs:
-	// mesh first, then materials, then textures.
-	// have a look at UWrangleContentCommandlet as well
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
-	// Add a slate notification
-	FString Notification = TEXT("Cleaning up Houdini Engine temporary folder...");
-	FHoudiniEngineUtils::CreateSlateNotification(Notification);
+	// Gather all the temporary assets with a single registry query
+	TArray<FAssetData> TempAssetDataList;
+	AssetRegistry.GetAssets(InFilter, TempAssetDataList);
 
-	GWarn->BeginSlowTask(LOCTEXT("CleanUpTemp", "Cleaning up the Houdini Engine Temp Folder"), false, false);
+	TMap<FName, TArray<FAssetData>> TempPackages;
+	for (const FAssetData& Data : TempAssetDataList)
+		TempPackages.FindOrAdd(Data.PackageName).Add(Data);
 
-	// Get the default temp cook folder
-	FString TempCookFolder = FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder();
+	if (TempPackages.Num() <= 0)
+		return 0;
 
-	TArray<FString> TempCookFolders;
-	TempCookFolders.Add(FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder());
+	// Packages that are reachable from the roots
+	TSet<FName> LivePackages;
+	TArray<FName> LiveStack;
+	auto MarkLive = [&LivePackages, &LiveStack](const FName& InPackageName)
+	{
+		bool bAlreadyLive = false;
+		LivePackages.Add(InPackageName, &bAlreadyLive);
+		if (!bAlreadyLive)
+			LiveStack.Add(InPackageName);
+	};
+
+	// Build the reference graph between the temporary packages once.
+	// Any referencer that isn't a temporary package makes the package a root.
+	TMap<FName, TArray<FName>> TempReferencers;
+	TMap<FName, TArray<FName>> TempDependencies;
+	for (const auto& Pair : TempPackages)
+	{
+		const FName& PackageName = Pair.Key;
+
+		TArray<FName> Referencers;
+		AssetRegistry.GetReferencers(PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::All);
+		for (const FName& Referencer : Referencers)
+		{
+			if (Referencer == PackageName)
+				continue;
+
+			if (TempPackages.Contains(Referencer))
+			{
+				TempReferencers.FindOrAdd(PackageName).Add(Referencer);
+				TempDependencies.FindOrAdd(Referencer).Add(PackageName);
+			}
+			else
+			{
+				MarkLive(PackageName);
+			}
+		}
+	}
+
+	// The outputs of the live HACs are roots as well, even if their level hasn't been saved yet
 	for (TObjectIterator<UHoudiniAssetComponent> It; It; ++It)
 	{
-		FString CookFolder = It->TemporaryCookFolder.Path;
-		if (CookFolder.IsEmpty())
+		UHoudiniAssetComponent* HAC = *It;
+		if (!IsValid(HAC))
 			continue;
 
-		TempCookFolders.AddUnique(CookFolder);
+		for (UHoudiniOutput* Output : HAC->GetOutputs())
+		{
+			if (!IsValid(Output))
+				continue;
+
+			for (const auto& OutputObjectPair : Output->GetOutputObjects())
+			{
+				for (UObject* Object : { OutputObjectPair.Value.OutputObject, OutputObjectPair.Value.ProxyObject })
+				{
+					if (!IsValid(Object))
+						continue;
+
+					const FName PackageName = Object->GetOutermost()->GetFName();
+					if (TempPackages.Contains(PackageName))
+						MarkLive(PackageName);
+				}
+			}
+		}
 	}
 
-	// The Asset registry will help us finding if the content of the asset is referenced
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	// Propagate the liveness to everything the live packages depend on
+	while (LiveStack.Num() > 0)
+	{
+		const FName PackageName = LiveStack.Pop(false);
+		if (const TArray<FName>* Dependencies = TempDependencies.Find(PackageName))
+		{
+			for (const FName& Dependency : *Dependencies)
+				MarkLive(Dependency);
+		}
+	}
 
-	int32 DeletedCount = 0;
-	bool bDidDeleteAsset = true;
-	while (bDidDeleteAsset)
+	// Count, for each unreachable package, its unreachable referencers.
+	// Packages without any can be deleted first.
+	TMap<FName, int32> PendingReferencerCounts;
+	TArray<FName> CurrentLevel;
+	for (const auto& Pair : TempPackages)
 	{
-		// To correctly clean the temp folder, we need to iterate multiple times, because some of the temp assets
-		// might be referenced by other temp assets.. (ie Textures are referenced by Materials)
-		// We'll stop looking for assets to delete when no deletion occured.
-		bDidDeleteAsset = false;
+		if (LivePackages.Contains(Pair.Key))
+			continue;
 
-		TArray<FAssetData> AssetDataList;
-		for (auto& TempFolder : TempCookFolders)
+		int32 Count = 0;
+		if (const TArray<FName>* Referencers = TempReferencers.Find(Pair.Key))
 		{
-			// The Object library will list all UObjects found in the TempFolder
-			auto ObjectLibrary = UObjectLibrary::CreateLibrary(UObject::StaticClass(), false, true);
-			ObjectLibrary->LoadAssetDataFromPath(TempFolder);
+			for (const FName& Referencer : *Referencers)
+			{
+				if (!LivePackages.Contains(Referencer))
+					Count++;
+			}
+		}
 
-			// Get all the assets found in the TEMP folder
-			TArray<FAssetData> CurrentAssetDataList;
-			ObjectLibrary->GetAssetDataList(CurrentAssetDataList);
+		if (Count > 0)
+			PendingReferencerCounts.Add(Pair.Key, Count);
+		else
+			CurrentLevel.Add(Pair.Key);
+	}
 
-			AssetDataList.Append(CurrentAssetDataList);
+	// Packages that have to be kept, along with everything they depend on
+	TSet<FName> KeptPackages;
+	TFunction<void(const FName&)> KeepPackage = [&KeptPackages, &TempDependencies, &KeepPackage](const FName& InPackageName)
+	{
+		bool bAlreadyKept = false;
+		KeptPackages.Add(InPackageName, &bAlreadyKept);
+		if (bAlreadyKept)
+			return;
+
+		if (const TArray<FName>* Dependencies = TempDependencies.Find(InPackageName))
+		{
+			for (const FName& Dependency : *Dependencies)
+				KeepPackage(Dependency);
 		}
+	};
 
-		// All the assets we're going to delete
-		TArray<FAssetData> AssetDataToDelete;
-		for (FAssetData Data : AssetDataList)
+	// Returns true if one of the package's assets is referenced in memory (or by the undo buffer)
+	// by something that isn't going to be deleted
+	auto IsReferencedInMemory = [&TempPackages, &LivePackages, &KeptPackages](const FName& InPackageName)
+	{
+		for (const FAssetData& Data : TempPackages[InPackageName])
 		{
-			UPackage* CurrentPackage = Data.GetPackage();
-			if (!CurrentPackage || CurrentPackage->IsPendingKill())
+			// Assets that aren't loaded can only be referenced through the registry
+			if (!Data.IsAssetLoaded())
+				continue;
+
+			UObject* Asset = Data.GetAsset();
+			if (!IsValid(Asset))
 				continue;
 
-			// Do not  try to delete the package if it's referenced anywhere
-			TArray<FName> ReferenceNames;
-			//AssetRegistryModule.Get().GetReferencers(CurrentPackage->GetFName(), ReferenceNames, EAssetRegistryDependencyType::All);
-			AssetRegistryModule.Get().GetReferencers(CurrentPackage->GetFName(), ReferenceNames, UE::AssetRegistry::EDependencyCategory::All);
-			if (ReferenceNames.Num() > 0)
+			FReferencerInformationList ReferencesIncludingUndo;
+			if (!IsReferenced(Asset, GARBAGE_COLLECTION_KEEPFLAGS, EInternalObjectFlags::GarbageCollectionKeepFlags, true, &ReferencesIncludingUndo))
 				continue;
 
-			bool bAssetDataSafeToDelete = true;
-			TArray<FAssetData> AssetsInPackage;
-			AssetRegistryModule.Get().GetAssetsByPackageName(CurrentPackage->GetFName(), AssetsInPackage);
-			for (const auto& AssetInfo : AssetsInPackage)
+			for (const FReferencerInformation& ExtRef : ReferencesIncludingUndo.ExternalReferences)
 			{
-				// Check if the objects contained in the package are referenced by something that won't be garbage collected (*including* the undo buffer)                    
-				UObject* AssetInPackage = AssetInfo.GetAsset();
-				if (!AssetInPackage || AssetInPackage->IsPendingKill())
+				if (!ExtRef.Referencer)
 					continue;
 
-				FReferencerInformationList ReferencesIncludingUndo;
-				bool bReferencedInMemoryOrUndoStack = IsReferenced(AssetInPackage, GARBAGE_COLLECTION_KEEPFLAGS, EInternalObjectFlags::GarbageCollectionKeepFlags, true, &ReferencesIncludingUndo);
-				if (!bReferencedInMemoryOrUndoStack)
+				UPackage* ReferencerPackage = ExtRef.Referencer->GetOutermost();
+				if (!IsValid(ReferencerPackage))
 					continue;
 
-				// We do have external references, check if the external references are in our ObjectToDelete list
-				// If they are, we can delete the asset because its references are going to be deleted as well.
-				for (auto ExtRef : ReferencesIncludingUndo.ExternalReferences)
-				{
-					UObject* Outer = ExtRef.Referencer->GetOuter();
-					if (!Outer || Outer->IsPendingKill())
-						continue;
-
-					bool bOuterFound = false;
-					for (auto DataToDelete : AssetDataToDelete)
-					{
-						if (DataToDelete.GetPackage() == Outer)
-						{
-							bOuterFound = true;
-							break;
-						}
-						else if (DataToDelete.GetAsset() == Outer)
-						{
-							bOuterFound = true;
-							break;
-						}
-					}
+				// References from unreachable packages that are going to be deleted don't count
+				const FName ReferencerName = ReferencerPackage->GetFName();
+				if (ReferencerName == InPackageName)
+					continue;
 
-					// We have at least one reference that's not going to be deleted, we have to keep the asset
-					if (!bOuterFound)
-					{
-						bAssetDataSafeToDelete = false;
-						break;
-					}
-				}
+				if (!TempPackages.Contains(ReferencerName)
+					|| LivePackages.Contains(ReferencerName)
+					|| KeptPackages.Contains(ReferencerName))
+					return true;
 			}
+		}
 
-			if (bAssetDataSafeToDelete)
-				AssetDataToDelete.Add(Data);
+		return false;
+	};
+
+	int32 DeletedCount = 0;
+	while (CurrentLevel.Num() > 0 || PendingReferencerCounts.Num() > 0)
+	{
+		if (CurrentLevel.Num() <= 0)
+		{
+			// Only cycles are left, delete them together
+			PendingReferencerCounts.GenerateKeyArray(CurrentLevel);
+			PendingReferencerCounts.Empty();
 		}
 
-		// Nothing to delete
-		if (AssetDataToDelete.Num() <= 0)
-			break;
+		TArray<FAssetData> AssetDataToDelete;
+		for (const FName& PackageName : CurrentLevel)
+		{
+			if (KeptPackages.Contains(PackageName))
+				continue;
 
-		int32 CurrentDeleted = ObjectTools::DeleteAssets(AssetDataToDelete, false);
+			if (IsReferencedInMemory(PackageName))
+			{
+				KeepPackage(PackageName);
+				continue;
+			}
+
+			AssetDataToDelete.Append(TempPackages[PackageName]);
+		}
 
-		if (CurrentDeleted > 0)
+		// Delete the whole level at once, this also handles source control for all its packages
+		if (AssetDataToDelete.Num() > 0)
+			DeletedCount += ObjectTools::DeleteAssets(AssetDataToDelete, false);
+
+		TArray<FName> NextLevel;
+		for (const FName& PackageName : CurrentLevel)
 		{
-			DeletedCount += CurrentDeleted;
-			bDidDeleteAsset = true;
+			// Packages that couldn't be deleted still reference their dependencies
+			if (!KeptPackages.Contains(PackageName))
+			{
+				TArray<FAssetData> RemainingAssets;
+				AssetRegistry.GetAssetsByPackageName(PackageName, RemainingAssets);
+				if (RemainingAssets.Num() > 0)
+					KeepPackage(PackageName);
+			}
+
+			const TArray<FName>* Dependencies = TempDependencies.Find(PackageName);
+			if (!Dependencies)
+				continue;
+
+			for (const FName& Dependency : *Dependencies)
+			{
+				int32* Count = PendingReferencerCounts.Find(Dependency);
+				if (Count && --(*Count) <= 0)
+				{
+					PendingReferencerCounts.Remove(Dependency);
+					NextLevel.Add(Dependency);
+				}
+			}
 		}
+
+		CurrentLevel = MoveTemp(NextLevel);
 	}
 
+	return DeletedCount;
+}
+
+void
+FHoudiniEngineCommands::CleanUpTempFolder()
+{
+	// Add a slate notification
+	FString Notification = TEXT("Cleaning up Houdini Engine temporary folder...");
+	FHoudiniEngineUtils::CreateSlateNotification(Notification);
+
+	GWarn->BeginSlowTask(LOCTEXT("CleanUpTemp", "Cleaning up the Houdini Engine Temp Folder"), false, false);
+
+	// Get the default temp cook folder
+	FString TempCookFolder = FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder();
+
+	TArray<FString> TempCookFolders;
+	TempCookFolders.Add(FHoudiniEngineRuntime::Get().GetDefaultTemporaryCookFolder());
+	for (TObjectIterator<UHoudiniAssetComponent> It; It; ++It)
+	{
+		FString CookFolder = It->TemporaryCookFolder.Path;
+		if (CookFolder.IsEmpty())
+			continue;
+
+		TempCookFolders.AddUnique(CookFolder);
+	}
+
+	// Make sure the registry knows about everything that is on disk in the temp folders
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().ScanPathsSynchronous(TempCookFolders);
+
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	for (const FString& TempFolder : TempCookFolders)
+		Filter.PackagePaths.Add(FName(*TempFolder));
+
+	int32 DeletedCount = DeleteUnreachableTempPackages(Filter);
 
 	// Now, go through all the directories in the temp directories and delete all the empty ones
 	IFileManager& FM = IFileManager::Get();
@@ -459,6 +604,25 @@ FHoudiniEngineCommands::CleanUpTempFolder()
 	HOUDINI_LOG_MESSAGE(TEXT("Deleted %d temporary files and %d directories."), DeletedCount, DeletedDirectories);
 }
 
+void
+FHoudiniEngineCommands::CleanUpStaleTempPackages()
+{
+	FHoudiniTempPackageTracker& Tracker = FHoudiniTempPackageTracker::Get();
+	if (!Tracker.HasStalePackages())
+		return;
+
+	TSet<FName> StalePackages;
+	Tracker.ConsumeStalePackages(StalePackages);
+
+	// Only the stale packages are candidates for deletion: any other package referencing them keeps them alive
+	FARFilter Filter;
+	Filter.PackageNames = StalePackages.Array();
+
+	const int32 DeletedCount = DeleteUnreachableTempPackages(Filter);
+	if (DeletedCount > 0)
+		HOUDINI_LOG_MESSAGE(TEXT("Deleted %d stale temporary files."), DeletedCount);
+}
+
 void
 FHoudiniEngineCommands::BakeAllAssets()
 {
@@ -466,6 +630,9 @@ FHoudiniEngineCommands::BakeAllAssets()
 	FString Notification = TEXT("Baking all assets in the current level...");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification);
 
+	// Save the packages of all the bakes in one pass, once every HAC has been baked
+	FHoudiniBakeTransaction BakeTransaction;
+
 	// Bakes and replaces with blueprints all Houdini Assets in the current level
 	int32 BakedCount = 0;
 	for (TObjectIterator<UHoudiniAssetComponent> Itr; Itr; ++Itr)
@@ -547,6 +714,8 @@ FHoudiniEngineCommands::BakeAllAssets()
 			BakedCount++;
 	}
 
+	BakeTransaction.Commit();
+
 	// Add a slate notification
 	Notification = TEXT("Baked ") + FString::FromInt(BakedCount) + TEXT(" Houdini assets.");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification);
@@ -753,6 +922,9 @@ FHoudiniEngineCommands::BakeSelection()
 	FString Notification = TEXT("Baking selected Houdini Asset Actors in the current level...");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification);
 
+	// Save the packages of all the bakes in one pass, once every HAC has been baked
+	FHoudiniBakeTransaction BakeTransaction;
+
 	// Iterates over the selection and rebuilds the assets if they're in a valid state
 	int32 BakedCount = 0;
 	for (int32 Idx = 0; Idx < SelectedHoudiniAssets; Idx++)
@@ -815,6 +987,8 @@ FHoudiniEngineCommands::BakeSelection()
 		}
 	}
 
+	BakeTransaction.Commit();
+
 	// Add a slate notification
 	Notification = TEXT("Baked ") + FString::FromInt(BakedCount) + TEXT(" Houdini assets.");
 	FHoudiniEngineUtils::CreateSlateNotification(Notification);
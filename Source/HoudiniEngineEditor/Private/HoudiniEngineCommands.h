@@ -68,6 +68,9 @@ public:
 	// Menu action called to clean up all unused files in the cook temp folder
 	static void CleanUpTempFolder();
 
+	// Deletes the unreferenced temporary packages that are no longer used by the cooks that created them
+	static void CleanUpStaleTempPackages();
+
 	// Menu action to bake/replace all current Houdini Assets with blueprints
 	static void BakeAllAssets();
 
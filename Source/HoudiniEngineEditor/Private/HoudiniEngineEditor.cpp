@@ -50,6 +50,7 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniPDGAssetLink.h"
 #include "HoudiniPackageParams.h"
+#include "HoudiniGenericAttribute.h"
 
 #include "Modules/ModuleManager.h"
 #include "Interfaces/IPluginManager.h"
@@ -69,6 +70,7 @@
 #include "Engine/Selection.h"
 #include "Widgets/Input/SCheckBox.h"
 #include "Logging/LogMacros.h"
+#include "Containers/Ticker.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
@@ -91,6 +93,7 @@ FHoudiniEngineEditor::IsInitialized()
 }
 
 FHoudiniEngineEditor::FHoudiniEngineEditor()
+	: LastTempFolderCleanUpTime(0.0)
 {
 }
 
@@ -1310,6 +1313,9 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 
 	PreBeginPIEEditorDelegateHandle = FEditorDelegates::PreBeginPIE.AddLambda([](const bool bIsSimulating)
 	{
+		// The legacy data isn't duplicated to the PIE world, convert it now
+		FHoudiniEngineEditorUtils::ConvertPendingLegacyComponents(false);
+
 		const bool bSelectedOnly = false;
 		const bool bSilent = false;
 		const bool bRefineAll = false;
@@ -1321,6 +1327,24 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 
 	OnDeleteActorsBegin = FEditorDelegates::OnDeleteActorsBegin.AddLambda([this](){ this->HandleOnDeleteActorsBegin(); });
 	OnDeleteActorsEnd = FEditorDelegates::OnDeleteActorsEnd.AddLambda([this](){ this-> HandleOnDeleteActorsEnd(); });
+
+	// Selected legacy components are converted right away, so they can be copied/duplicated and display their details
+	OnSelectionChangedHandle = USelection::SelectionChangedEvent.AddLambda([](UObject* InSelection)
+	{
+		FHoudiniEngineEditorUtils::ConvertPendingLegacyComponents(true);
+	});
+
+	TempFolderCleanUpTickerHandle = FTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FHoudiniEngineEditor::TickTempFolderCleanUp), 1.0f);
+
+	// Compiling a blueprint changes its class' properties, the cached uproperty bindings are invalid
+	if (GEditor)
+	{
+		OnBlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddLambda([]()
+		{
+			FHoudiniGenericAttribute::ClearPropertyBindingCache();
+		});
+	}
 }
 
 void
@@ -1337,6 +1361,38 @@ FHoudiniEngineEditor::UnregisterEditorDelegates()
 
 	if (OnDeleteActorsEnd.IsValid())
 		FEditorDelegates::OnDeleteActorsEnd.Remove(OnDeleteActorsEnd);
+
+	if (OnSelectionChangedHandle.IsValid())
+		USelection::SelectionChangedEvent.Remove(OnSelectionChangedHandle);
+
+	if (TempFolderCleanUpTickerHandle.IsValid())
+		FTicker::GetCoreTicker().RemoveTicker(TempFolderCleanUpTickerHandle);
+	TempFolderCleanUpTickerHandle.Reset();
+
+	if (OnBlueprintCompiledHandle.IsValid() && GEditor)
+		GEditor->OnBlueprintCompiled().Remove(OnBlueprintCompiledHandle);
+	OnBlueprintCompiledHandle.Reset();
+}
+
+bool
+FHoudiniEngineEditor::TickTempFolderCleanUp(float DeltaTime)
+{
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bAutoCleanUpTempFolder)
+		return true;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastTempFolderCleanUpTime < HoudiniRuntimeSettings->TempFolderCleanUpInterval)
+		return true;
+
+	// Don't delete assets while playing in editor, or in the middle of a transaction / slow task
+	if (!GEditor || GEditor->PlayWorld || GEditor->IsTransactionActive() || GIsSlowTask)
+		return true;
+
+	LastTempFolderCleanUpTime = Now;
+	FHoudiniEngineCommands::CleanUpStaleTempPackages();
+
+	return true;
 }
 
 FString 
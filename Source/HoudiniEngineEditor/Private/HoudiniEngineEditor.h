@@ -235,6 +235,9 @@ class HOUDINIENGINEEDITOR_API FHoudiniEngineEditor : public IHoudiniEngineEditor
 		// Re-select AHoudiniAssetActors that were deselected (to avoid deletion) by HandleOnDeleteActorsBegin 
 		void HandleOnDeleteActorsEnd();
 
+		// Ticker for the automatic clean up of the temporary cook folder (see bAutoCleanUpTempFolder)
+		bool TickTempFolderCleanUp(float DeltaTime);
+
 	private:
 
 		// Singleton instance of Houdini Engine Editor.
@@ -339,6 +342,18 @@ class HOUDINIENGINEEDITOR_API FHoudiniEngineEditor : public IHoudiniEngineEditor
 		// Delegate handle for OnDeleteActorsEnd
 		FDelegateHandle OnDeleteActorsEnd;
 
+		// Delegate handle for USelection::SelectionChangedEvent
+		FDelegateHandle OnSelectionChangedHandle;
+
+		// Delegate handle for UEditorEngine::OnBlueprintCompiled
+		FDelegateHandle OnBlueprintCompiledHandle;
+
+		// Ticker handle for the automatic clean up of the temporary cook folder
+		FDelegateHandle TempFolderCleanUpTickerHandle;
+
+		// Time of the last automatic clean up of the temporary cook folder
+		double LastTempFolderCleanUpTime;
+
 		// List of actors that HandleOnDeleteActorsBegin marked to _not_ be deleted. This
 		// is used to re-select these actors in HandleOnDeleteActorsEnd.
 		TArray<AActor*> ActorsToReselectOnDeleteActorsEnd;
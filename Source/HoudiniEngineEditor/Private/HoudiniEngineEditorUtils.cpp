@@ -31,6 +31,8 @@
 #include "HoudiniEngineEditor.h"
 #include "HoudiniRuntimeSettings.h"
 #include "HoudiniAssetActor.h"
+#include "HoudiniAssetComponent.h"
+#include "HoudiniEngineUtils.h"
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniAsset.h"
 #include "HoudiniOutput.h"
@@ -649,4 +651,24 @@ FHoudiniEngineEditorUtils::NotifyPostEditChangeProperty(FName InPropertyPath, UO
 	}
 }
 
+void
+FHoudiniEngineEditorUtils::ConvertPendingLegacyComponents(const bool& bInSelectedOnly)
+{
+	for (TObjectIterator<UHoudiniAssetComponent> It; It; ++It)
+	{
+		UHoudiniAssetComponent* HAC = *It;
+		if (!IsValid(HAC) || !HAC->HasPendingLegacyConversion())
+			continue;
+
+		if (bInSelectedOnly && !HAC->IsOwnerSelected())
+			continue;
+
+		HAC->ConvertPendingLegacyData();
+
+		// The converted parameters/inputs need to be displayed
+		if (HAC->IsOwnerSelected())
+			FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -83,4 +83,8 @@ public:
 	// Call PostEditChangeChainProperty on InRootObject for the property at InPropertyPath relative to
 	// InRootObject.
 	static void NotifyPostEditChangeProperty(FName InPropertyPath, UObject* InRootObject);
+
+	// Immediately converts the legacy (v1) components that are still waiting for their deferred conversion.
+	// Used before the components are copied (selection) or duplicated (PIE), as the v1 data can't be duplicated.
+	static void ConvertPendingLegacyComponents(const bool& bInSelectedOnly);
 };
\ No newline at end of file
@@ -54,6 +54,9 @@
 #include "Widgets/Images/SImage.h"
 #include "Widgets/SBoxPanel.h"
 #include "Widgets/Layout/SSpacer.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/Views/STreeView.h"
 #include "Framework/SlateDelegates.h"
 #include "Templates/SharedPointer.h"
 
@@ -63,6 +66,418 @@
 
 #define HOUDINI_ENGINE_UI_SECTION_PDG_BAKE 2
 
+// Helper to summarize the load state of the result objects of a work result, for the TOP node tree view
+static void
+GetWorkResultStatusAndColor(const FTOPWorkResult& InWorkResult, FString& OutStatus, FLinearColor& OutStatusColor)
+{
+	int32 NumLoaded = 0;
+	int32 NumLoading = 0;
+	int32 NumDeleting = 0;
+	for (const FTOPWorkResultObject& ResultObject : InWorkResult.ResultObjects)
+	{
+		switch (ResultObject.State)
+		{
+			case EPDGWorkResultState::Loaded:
+				NumLoaded++;
+				break;
+			case EPDGWorkResultState::ToLoad:
+			case EPDGWorkResultState::Loading:
+				NumLoading++;
+				break;
+			case EPDGWorkResultState::ToDelete:
+			case EPDGWorkResultState::Deleting:
+				NumDeleting++;
+				break;
+			default:
+				break;
+		}
+	}
+
+	const int32 NumResultObjects = InWorkResult.ResultObjects.Num();
+	if (NumLoading > 0)
+	{
+		OutStatus = TEXT("Loading");
+		OutStatusColor = FLinearColor::Yellow;
+	}
+	else if (NumDeleting > 0)
+	{
+		OutStatus = TEXT("Unloading");
+		OutStatusColor = FLinearColor::Yellow;
+	}
+	else if (NumResultObjects > 0 && NumLoaded == NumResultObjects)
+	{
+		OutStatus = TEXT("Loaded");
+		OutStatusColor = FLinearColor::Green;
+	}
+	else if (NumLoaded > 0)
+	{
+		OutStatus = TEXT("Partially Loaded");
+		OutStatusColor = FLinearColor::Green;
+	}
+	else
+	{
+		OutStatus = NumResultObjects > 0 ? TEXT("Not Loaded") : FString();
+		OutStatusColor = FLinearColor::White;
+	}
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::Construct(const FArguments& InArgs)
+{
+	PDGAssetLink = InArgs._PDGAssetLink;
+
+	this->ChildSlot
+	[
+		SAssignNew(TreeView, STreeView<FTreeItemPtr>)
+		.TreeItemsSource(&RootItems)
+		.SelectionMode(ESelectionMode::Single)
+		.ItemHeight(20.0f)
+		.OnGenerateRow(this, &SHoudiniPDGTOPNodeTreeView::OnGenerateRow)
+		.OnGetChildren(this, &SHoudiniPDGTOPNodeTreeView::OnGetChildren)
+		.OnSelectionChanged(this, &SHoudiniPDGTOPNodeTreeView::OnSelectionChanged)
+	];
+
+	UHoudiniPDGAssetLink* const AssetLink = PDGAssetLink.Get();
+	if (IsValid(AssetLink))
+	{
+		OnTOPNodesChangedHandle = AssetLink->OnTOPNodesChanged.AddSP(
+			this, &SHoudiniPDGTOPNodeTreeView::OnTOPNodesChanged);
+	}
+
+	RebuildItems();
+}
+
+SHoudiniPDGTOPNodeTreeView::~SHoudiniPDGTOPNodeTreeView()
+{
+	UHoudiniPDGAssetLink* const AssetLink = PDGAssetLink.Get();
+	if (IsValid(AssetLink) && OnTOPNodesChangedHandle.IsValid())
+		AssetLink->OnTOPNodesChanged.Remove(OnTOPNodesChangedHandle);
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::RebuildItems()
+{
+	RootItems.Empty();
+	ItemsByTOPNode.Empty();
+
+	UHoudiniPDGAssetLink* const AssetLink = PDGAssetLink.Get();
+	UTOPNetwork* const Network = IsValid(AssetLink) ? AssetLink->GetSelectedTOPNetwork() : nullptr;
+	TOPNetwork = Network;
+	TOPNodesVersion = IsValid(AssetLink) ? AssetLink->GetTOPNodesVersion() : 0;
+
+	if (IsValid(Network))
+	{
+		// Create the items of the visible nodes first, then link them to the item of their nearest visible parent
+		TArray<FTreeItemPtr> NodeItems;
+		const int32 NumTOPNodes = Network->AllTOPNodes.Num();
+		for (int32 Idx = 0; Idx < NumTOPNodes; Idx++)
+		{
+			UTOPNode* const Node = Network->AllTOPNodes[Idx];
+			if (!IsValid(Node) || Node->bHidden)
+				continue;
+
+			FTreeItemPtr Item = MakeShared<FHoudiniPDGTOPNodeTreeItem>();
+			Item->TOPNode = Node;
+			Item->TOPNodeIndex = Idx;
+			UpdateItem(*Item);
+			ItemsByTOPNode.Add(Node, Item);
+			NodeItems.Add(Item);
+		}
+
+		for (const FTreeItemPtr& Item : NodeItems)
+		{
+			FTreeItemPtr ParentItem;
+			for (UTOPNode* Parent = Item->TOPNode->GetParentTOPNode(); IsValid(Parent) && !ParentItem.IsValid(); Parent = Parent->GetParentTOPNode())
+			{
+				if (FTreeItemPtr* FoundItem = ItemsByTOPNode.Find(Parent))
+					ParentItem = *FoundItem;
+			}
+
+			if (ParentItem.IsValid())
+			{
+				ParentItem->Children.Insert(Item, ParentItem->NumChildNodes);
+				ParentItem->NumChildNodes++;
+			}
+			else
+			{
+				RootItems.Add(Item);
+			}
+		}
+
+		for (const FTreeItemPtr& Item : NodeItems)
+		{
+			UpdateWorkResultItems(*Item);
+			// Show the nested nodes, but keep the work results collapsed
+			if (Item->NumChildNodes > 0)
+				TreeView->SetItemExpansion(Item, true);
+		}
+	}
+
+	TreeView->RequestTreeRefresh();
+	SyncSelection();
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::SyncSelection()
+{
+	UTOPNetwork* const Network = TOPNetwork.Get();
+	if (!IsValid(Network))
+		return;
+
+	TGuardValue<bool> SyncingSelectionGuard(bSyncingSelection, true);
+
+	UTOPNode* const SelectedNode = Network->AllTOPNodes.IsValidIndex(Network->SelectedTOPIndex)
+		? Network->AllTOPNodes[Network->SelectedTOPIndex]
+		: nullptr;
+	FTreeItemPtr* const SelectedItem = IsValid(SelectedNode) ? ItemsByTOPNode.Find(SelectedNode) : nullptr;
+	if (SelectedItem)
+	{
+		TreeView->SetSelection(*SelectedItem);
+		TreeView->RequestScrollIntoView(*SelectedItem);
+	}
+	else
+	{
+		TreeView->ClearSelection();
+	}
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::OnTOPNodesChanged(UHoudiniPDGAssetLink* InPDGAssetLink, const TArray<UTOPNode*>& InChangedTOPNodes)
+{
+	if (!IsValid(InPDGAssetLink) || InPDGAssetLink != PDGAssetLink.Get())
+		return;
+
+	// Rebuild if the nodes have been repopulated
+	if (InPDGAssetLink->GetSelectedTOPNetwork() != TOPNetwork.Get() || InPDGAssetLink->GetTOPNodesVersion() != TOPNodesVersion)
+	{
+		RebuildItems();
+		return;
+	}
+
+	bool bNeedsTreeRefresh = false;
+	for (UTOPNode* const Node : InChangedTOPNodes)
+	{
+		FTreeItemPtr* const FoundItem = ItemsByTOPNode.Find(Node);
+		if (!FoundItem)
+			continue;
+
+		FHoudiniPDGTOPNodeTreeItem& Item = **FoundItem;
+		UpdateItem(Item);
+		UpdateRow(Item);
+		if (UpdateWorkResultItems(Item) && TreeView->IsItemExpanded(*FoundItem))
+			bNeedsTreeRefresh = true;
+	}
+
+	if (bNeedsTreeRefresh)
+		TreeView->RequestTreeRefresh();
+}
+
+bool
+SHoudiniPDGTOPNodeTreeView::UpdateWorkResultItems(FHoudiniPDGTOPNodeTreeItem& InNodeItem)
+{
+	UTOPNode* const Node = InNodeItem.TOPNode.Get();
+	const int32 NumWorkResults = IsValid(Node) ? Node->WorkResult.Num() : 0;
+	const int32 OldNumChildren = InNodeItem.Children.Num();
+	const int32 NewNumChildren = InNodeItem.NumChildNodes + NumWorkResults;
+
+	if (NewNumChildren < OldNumChildren)
+	{
+		InNodeItem.Children.SetNum(NewNumChildren);
+	}
+	else if (NewNumChildren > OldNumChildren)
+	{
+		InNodeItem.Children.Reserve(NewNumChildren);
+		for (int32 Idx = OldNumChildren - InNodeItem.NumChildNodes; Idx < NumWorkResults; Idx++)
+		{
+			FTreeItemPtr Item = MakeShared<FHoudiniPDGTOPNodeTreeItem>();
+			Item->TOPNode = Node;
+			Item->TOPNodeIndex = InNodeItem.TOPNodeIndex;
+			Item->WorkResultIndex = Idx;
+			InNodeItem.Children.Add(Item);
+		}
+	}
+
+	// Work result items are only updated when displayed: update the visible ones now, and the others when their
+	// rows are generated
+	for (int32 Idx = InNodeItem.NumChildNodes; Idx < NewNumChildren; Idx++)
+	{
+		FHoudiniPDGTOPNodeTreeItem& Item = *InNodeItem.Children[Idx];
+		if (Item.StatusTextBlock.IsValid())
+		{
+			UpdateItem(Item);
+			UpdateRow(Item);
+		}
+		else
+		{
+			Item.bNeedsUpdate = true;
+		}
+	}
+
+	return NewNumChildren != OldNumChildren;
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::UpdateItem(FHoudiniPDGTOPNodeTreeItem& InItem)
+{
+	InItem.bNeedsUpdate = false;
+
+	UTOPNode* const Node = InItem.TOPNode.Get();
+	if (!IsValid(Node))
+	{
+		InItem.Status = FText();
+		InItem.Details = FText();
+		return;
+	}
+
+	if (!InItem.IsWorkResult())
+	{
+		InItem.Label = FText::FromString(Node->NodeName);
+		InItem.ToolTip = FText::FromString(!Node->NodePath.IsEmpty() ? Node->NodePath : Node->NodeName);
+		InItem.Status = FText::FromString(UHoudiniPDGAssetLink::GetTOPNodeStatus(Node));
+		InItem.StatusColor = UHoudiniPDGAssetLink::GetTOPNodeStatusColor(Node);
+
+		const FWorkItemTallyBase& WorkItemTally = Node->GetWorkItemTally();
+		InItem.Details = FText::FromString(FString::Printf(
+			TEXT("%d / %d"), WorkItemTally.NumCookedWorkItems(), WorkItemTally.NumWorkItems()));
+		return;
+	}
+
+	if (!Node->WorkResult.IsValidIndex(InItem.WorkResultIndex))
+	{
+		InItem.Status = FText();
+		InItem.Details = FText();
+		return;
+	}
+
+	const FTOPWorkResult& WorkResult = Node->WorkResult[InItem.WorkResultIndex];
+	InItem.Label = FText::FromString(FString::Printf(TEXT("Work Item %d"), WorkResult.WorkItemIndex));
+
+	FString ToolTip;
+	for (const FTOPWorkResultObject& ResultObject : WorkResult.ResultObjects)
+	{
+		if (!ToolTip.IsEmpty())
+			ToolTip += TEXT("\n");
+		ToolTip += ResultObject.FilePath;
+	}
+	InItem.ToolTip = FText::FromString(ToolTip);
+
+	FString Status;
+	GetWorkResultStatusAndColor(WorkResult, Status, InItem.StatusColor);
+	InItem.Status = FText::FromString(Status);
+	InItem.Details = FText::FromString(FString::Printf(
+		TEXT("%d result%s"), WorkResult.ResultObjects.Num(), WorkResult.ResultObjects.Num() == 1 ? TEXT("") : TEXT("s")));
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::UpdateRow(const FHoudiniPDGTOPNodeTreeItem& InItem)
+{
+	// Work result rows are reused for other work items when work items are removed
+	TSharedPtr<STextBlock> LabelTextBlock = InItem.LabelTextBlock.Pin();
+	if (LabelTextBlock.IsValid())
+	{
+		LabelTextBlock->SetText(InItem.Label);
+		LabelTextBlock->SetToolTipText(InItem.ToolTip);
+	}
+
+	TSharedPtr<STextBlock> StatusTextBlock = InItem.StatusTextBlock.Pin();
+	if (StatusTextBlock.IsValid())
+	{
+		StatusTextBlock->SetText(InItem.Status);
+		StatusTextBlock->SetColorAndOpacity(InItem.StatusColor);
+	}
+
+	TSharedPtr<STextBlock> DetailsTextBlock = InItem.DetailsTextBlock.Pin();
+	if (DetailsTextBlock.IsValid())
+		DetailsTextBlock->SetText(InItem.Details);
+}
+
+TSharedRef<ITableRow>
+SHoudiniPDGTOPNodeTreeView::OnGenerateRow(FTreeItemPtr InItem, const TSharedRef<STableViewBase>& InOwnerTable)
+{
+	if (InItem->bNeedsUpdate)
+		UpdateItem(*InItem);
+
+	TSharedPtr<STextBlock> LabelTextBlock;
+	TSharedPtr<STextBlock> StatusTextBlock;
+	TSharedPtr<STextBlock> DetailsTextBlock;
+
+	TSharedRef<ITableRow> Row = SNew(STableRow<FTreeItemPtr>, InOwnerTable)
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.FillWidth(1.0f)
+		.Padding(2.0f, 0.0f)
+		.VAlign(VAlign_Center)
+		[
+			SAssignNew(LabelTextBlock, STextBlock)
+			.Text(InItem->Label)
+			.ToolTipText(InItem->ToolTip)
+			.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+		]
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(5.0f, 0.0f)
+		.VAlign(VAlign_Center)
+		[
+			SAssignNew(StatusTextBlock, STextBlock)
+			.Text(InItem->Status)
+			.ColorAndOpacity(InItem->StatusColor)
+			.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+		]
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(5.0f, 0.0f)
+		.VAlign(VAlign_Center)
+		[
+			SAssignNew(DetailsTextBlock, STextBlock)
+			.Text(InItem->Details)
+			.ToolTipText(InItem->IsWorkResult()
+				? LOCTEXT("PDGTreeWorkResultDetailsTooltip", "Number of result files of this work item")
+				: LOCTEXT("PDGTreeTOPNodeDetailsTooltip", "Cooked / total work items"))
+			.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
+		]
+	];
+
+	InItem->LabelTextBlock = LabelTextBlock;
+	InItem->StatusTextBlock = StatusTextBlock;
+	InItem->DetailsTextBlock = DetailsTextBlock;
+
+	return Row;
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::OnGetChildren(FTreeItemPtr InItem, TArray<FTreeItemPtr>& OutChildren)
+{
+	if (InItem.IsValid())
+		OutChildren = InItem->Children;
+}
+
+void
+SHoudiniPDGTOPNodeTreeView::OnSelectionChanged(FTreeItemPtr InItem, ESelectInfo::Type InSelectInfo)
+{
+	if (bSyncingSelection || !InItem.IsValid())
+		return;
+
+	// Selecting a work result selects its TOP node
+	UTOPNetwork* const Network = TOPNetwork.Get();
+	if (!IsValid(Network) || !Network->AllTOPNodes.IsValidIndex(InItem->TOPNodeIndex))
+		return;
+
+	if (Network->SelectedTOPIndex == InItem->TOPNodeIndex)
+		return;
+
+	// Record a transaction for undo/redo
+	FScopedTransaction Transaction(
+		TEXT(HOUDINI_MODULE_RUNTIME),
+		LOCTEXT("HoudiniPDGAssetLinkParameterChange", "Houdini PDG Asset Link Parameter: Changing a value"),
+		Network);
+
+	Network->Modify();
+	Network->SelectedTOPIndex = InItem->TOPNodeIndex;
+	FHoudiniEngineEditorUtils::NotifyPostEditChangeProperty(
+		GET_MEMBER_NAME_STRING_CHECKED(UTOPNetwork, SelectedTOPIndex), Network);
+}
+
 void 
 FHoudiniPDGDetails::CreateWidget(
 	IDetailCategoryBuilder& HouPDGCategory,
@@ -491,6 +906,24 @@ FHoudiniPDGDetails::AddPDGAssetWidget(
 				TEXT("The PDG Output Actors will be created under this parent actor. If not set, then the PDG Output Actors will be created under a new folder.")));
 		}
 	}
+	// Work result load budget
+	{
+		IDetailPropertyRow* PDGMaxLoadedRow = InPDGCategory.AddExternalObjectProperty({ InPDGAssetLink }, "MaxLoadedWorkResultObjects");
+		if (PDGMaxLoadedRow)
+		{
+			PDGMaxLoadedRow->DisplayName(FText::FromString(TEXT("Max Loaded Work Results")));
+			PDGMaxLoadedRow->ToolTip(FText::FromString(
+				TEXT("Maximum number of work results loaded at the same time (0: no limit). When over budget, the least recently viewed results are unloaded, and reloaded once they are in the selected TOP node or close to the camera.")));
+		}
+
+		IDetailPropertyRow* PDGMaxMemoryRow = InPDGCategory.AddExternalObjectProperty({ InPDGAssetLink }, "MaxLoadedWorkResultsMemoryMB");
+		if (PDGMaxMemoryRow)
+		{
+			PDGMaxMemoryRow->DisplayName(FText::FromString(TEXT("Max Loaded Work Results Memory (MB)")));
+			PDGMaxMemoryRow->ToolTip(FText::FromString(
+				TEXT("Approximate memory budget of the loaded work result outputs, in MB (0: no limit).")));
+		}
+	}
 
 	// Add bake widgets for PDG output
 	CreatePDGBakeWidgets(InPDGCategory, InPDGAssetLink);
@@ -1346,38 +1779,11 @@ FHoudiniPDGDetails::AddTOPNodeWidget(
 	FString GroupLabel = TEXT("TOP Nodes");
 	IDetailGroup& TOPNodesGrp = InGroup.AddGroup(FName(*GroupLabel), FText::FromString(GroupLabel), true);
 
-	// Combobox: TOP Node
+	// Tree view: TOP Nodes and their work results
 	{
-		FDetailWidgetRow& PDGTOPNodeRow = TOPNodesGrp.AddWidgetRow();
-		// DisableIfPDGNotLinked(PDGTOPNodeRow, InPDGAssetLink);
-		PDGTOPNodeRow.NameWidget.Widget =
-			SNew(SHorizontalBox)
-			+ SHorizontalBox::Slot()
-			[
-				SNew(STextBlock)
-				.Text(FText::FromString(TEXT("TOP Node")))
-			];
-
-		// Update the TOP Node SharedString
-		TOPNodesPtr.Reset();
-		TOPNodesPtr.Add(MakeShareable(new FTextAndTooltip(INDEX_NONE, LOCTEXT("ComboBoxEntryNoSelectedTOPNode", "- Select -").ToString())));
 		const UTOPNetwork* const SelectedTOPNet = InPDGAssetLink->GetSelectedTOPNetwork();
-		if (IsValid(SelectedTOPNet))
-		{
-			const int32 NumTOPNodes = SelectedTOPNet->AllTOPNodes.Num();
-			for (int32 Idx = 0; Idx < NumTOPNodes; Idx++)
-			{
-				const UTOPNode* const Node = SelectedTOPNet->AllTOPNodes[Idx]; 
-				if (!IsValid(Node) || Node->bHidden)
-					continue;
-				
-				TOPNodesPtr.Add(MakeShareable(new FTextAndTooltip(
-                    Idx,
-                    FHoudiniEngineEditorUtils::GetNodeNamePaddedByPathDepth(Node->NodeName, Node->NodePath),
-                    Node->NodePath
-                )));
-			}
-		}
+		const bool bHasVisibleTOPNode = IsValid(SelectedTOPNet) && SelectedTOPNet->AllTOPNodes.ContainsByPredicate(
+			[](const UTOPNode* InNode) { return IsValid(InNode) && !InNode->bHidden; });
 
 		FString NodeErrorText = FString();
 		FString NodeErrorTooltip = FString();
@@ -1388,135 +1794,51 @@ FHoudiniPDGDetails::AddTOPNodeWidget(
 			NodeErrorTooltip = TEXT("There is no valid TOP Node found in the selected TOP Network!");
 			NodeErrorColor = FLinearColor::Red;
 		}
-		else if(TOPNodesPtr.Num() <= 0)
+		else if (!bHasVisibleTOPNode)
 		{
 			NodeErrorText = TEXT("No visible TOP Node found!");
 			NodeErrorTooltip = TEXT("No visible TOP Node found, all nodes in this network are hidden. Please update your TOP Node Filter.");
 			NodeErrorColor = FLinearColor::Yellow;
 		}
 
-		// Lambda for selecting a TOPNode
-		auto OnTOPNodeChanged = [InPDGAssetLink](TSharedPtr<FTextAndTooltip> InNewChoice)
-		{
-			UTOPNetwork* const TOPNetwork = InPDGAssetLink->GetSelectedTOPNetwork();
-			if (!InNewChoice.IsValid() || !IsValid(TOPNetwork))
-				return;
-
-			const int32 NewChoice = InNewChoice->Value;
-			int32 NewSelectedIndex = INDEX_NONE;
-			if (TOPNetwork->AllTOPNodes.IsValidIndex(NewChoice))
-				NewSelectedIndex = NewChoice;
-
-			if (TOPNetwork->SelectedTOPIndex != NewSelectedIndex)
-			{
-				// Record a transaction for undo/redo
-				FScopedTransaction Transaction(
-					TEXT(HOUDINI_MODULE_RUNTIME),
-					LOCTEXT("HoudiniPDGAssetLinkParameterChange", "Houdini PDG Asset Link Parameter: Changing a value"),
-					TOPNetwork);
-				
-				TOPNetwork->Modify();
-				TOPNetwork->SelectedTOPIndex = NewSelectedIndex;
-				FHoudiniEngineEditorUtils::NotifyPostEditChangeProperty(
-					GET_MEMBER_NAME_STRING_CHECKED(UTOPNetwork, SelectedTOPIndex), TOPNetwork);
-			}
-		};
-		
-		TSharedPtr<SHorizontalBox, ESPMode::NotThreadSafe> HorizontalBoxTOPNode;
-		TSharedPtr<SComboBox<TSharedPtr<FTextAndTooltip>>> ComboBoxTOPNode;
-		int32 SelectedIndex = 0;
-		UTOPNetwork* const SelectedTOPNetwork = InPDGAssetLink->GetSelectedTOPNetwork();
-		if (IsValid(SelectedTOPNetwork) && SelectedTOPNetwork->SelectedTOPIndex >= 0)
+		if (!NodeErrorText.IsEmpty())
 		{
-			//SelectedIndex = InPDGAssetLink->GetSelectedTOPNetwork()->SelectedTOPIndex;
-
-			// We need to match the selection by the index in the AllTopNodes array
-			// Because of the nodefilter, it is possible that the selected index does not match the index in TOPNodesPtr
-			const int32 SelectedTOPNodeIndex = SelectedTOPNetwork->SelectedTOPIndex;
-			// Find the matching UI index
-			for (int32 UIIndex = 0; UIIndex < TOPNodesPtr.Num(); UIIndex++)
-			{
-				if (TOPNodesPtr[UIIndex] && TOPNodesPtr[UIIndex]->Value == SelectedTOPNodeIndex)
-				{
-					// We found the UI Index that matches the current TOP Node!
-					SelectedIndex = UIIndex;
-					break;
-				}
-			}
-		}
-
-		TSharedPtr<STextBlock> ErrorText;
+			FDetailWidgetRow& PDGTOPNodeRow = TOPNodesGrp.AddWidgetRow();
+			PDGTOPNodeRow.NameWidget.Widget =
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(TEXT("TOP Node")))
+				];
 
-		PDGTOPNodeRow.ValueWidget.Widget = 
-			SNew(SHorizontalBox)
-			+ SHorizontalBox::Slot()
-			.Padding(2, 2, 5, 2)
-			.FillWidth(300.f)
-			.MaxWidth(300.f)
-			[
-				SAssignNew(ComboBoxTOPNode, SComboBox<TSharedPtr<FTextAndTooltip>>)
-				.OptionsSource(&TOPNodesPtr)
-				.InitiallySelectedItem(TOPNodesPtr[SelectedIndex])
-				.OnGenerateWidget_Lambda([](TSharedPtr<FTextAndTooltip> ChoiceEntry)
-				{
-					const FText ChoiceEntryText = FText::FromString(ChoiceEntry->Text);
-					const FText ChoiceEntryToolTip = FText::FromString(ChoiceEntry->ToolTip);
-					return SNew(STextBlock)
-					.Text(ChoiceEntryText)
-					.ToolTipText(ChoiceEntryToolTip)
-					.Margin(2.0f)
-					.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")));
-				})
-				.OnSelectionChanged_Lambda([OnTOPNodeChanged](TSharedPtr<FTextAndTooltip> NewChoice, ESelectInfo::Type SelectType)
-				{
-					return OnTOPNodeChanged(NewChoice);
-				})
+			PDGTOPNodeRow.ValueWidget.Widget =
+				SNew(SHorizontalBox)
+				+ SHorizontalBox::Slot()
+				.Padding(2, 2, 5, 2)
+				.AutoWidth()
 				[
 					SNew(STextBlock)
-					.Text_Lambda([InPDGAssetLink, ComboBoxTOPNode, Options = TOPNodesPtr]()
-					{
-						if (IsValid(InPDGAssetLink))
-							return FText::FromString(InPDGAssetLink->GetSelectedTOPNodeName());
-						else
-							return FText();
-					})
-					.ToolTipText_Lambda([InPDGAssetLink]()
-					{
-						UTOPNode const * const TOPNode = InPDGAssetLink->GetSelectedTOPNode();
-						if (IsValid(TOPNode))
-						{
-							if (!TOPNode->NodePath.IsEmpty())
-								return FText::FromString(TOPNode->NodePath);
-							else
-								return FText::FromString(TOPNode->NodeName);
-						}
-						else
-						{
-							return FText();
-						}
-					})
+					.Text(FText::FromString(NodeErrorText))
+					.ToolTipText(FText::FromString(NodeErrorTooltip))
 					.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
-				]
-			]
-			+ SHorizontalBox::Slot()
-			.Padding(2, 2, 5, 2)
-			.AutoWidth()
+					.ColorAndOpacity(NodeErrorColor)
+				];
+		}
+		else
+		{
+			// The tree only generates the rows of visible items, and updates them when the PDG manager reports changes
+			TOPNodesGrp.AddWidgetRow()
+			.WholeRowContent()
 			[
-				SAssignNew(ErrorText, STextBlock)
-				.Text(FText::FromString(NodeErrorText))
-				.ToolTipText(FText::FromString(NodeErrorText))
-				.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
-				.ColorAndOpacity(FLinearColor::Red)
-				//.ShadowColorAndOpacity(FLinearColor::Black)
+				SNew(SBox)
+				.MaxDesiredHeight(300.0f)
+				[
+					SNew(SHoudiniPDGTOPNodeTreeView)
+					.PDGAssetLink(InPDGAssetLink)
+				]
 			];
-
-		// Update the error text if needed
-		ErrorText->SetText(FText::FromString(NodeErrorText));
-		ErrorText->SetToolTipText(FText::FromString(NodeErrorTooltip));
-		ErrorText->SetColorAndOpacity(NodeErrorColor);
-
-		// Hide the combobox if we have an error
-		ComboBoxTOPNode->SetVisibility(NodeErrorText.IsEmpty() ? EVisibility::Visible : EVisibility::Hidden);
+		}
 	}
 
 	// TOP Node State
@@ -29,11 +29,17 @@
 #include "CoreMinimal.h"
 #include "Templates/SharedPointer.h"
 #include "DetailWidgetRow.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
 
 #include "HoudiniPDGAssetLink.h"
 
 class IDetailGroup;
 class IDetailCategoryBuilder;
+class ITableRow;
+class STableViewBase;
+class STextBlock;
 
 struct FWorkItemTally;
 enum class EPDGLinkState : uint8;
@@ -55,6 +61,98 @@ public:
 	int32 Value;
 };
 
+// An item of the TOP node tree view: a TOP node, or a work result of a TOP node.
+struct FHoudiniPDGTOPNodeTreeItem
+{
+public:
+	bool IsWorkResult() const { return WorkResultIndex != INDEX_NONE; };
+
+	// The TOP node, or the TOP node of the work result
+	TWeakObjectPtr<UTOPNode> TOPNode;
+	// Index of the TOP node in its network's AllTOPNodes
+	int32 TOPNodeIndex = INDEX_NONE;
+	// Index of the work result in the TOP node's WorkResult array (INDEX_NONE for TOP node items)
+	int32 WorkResultIndex = INDEX_NONE;
+
+	// Display values, cached when the TOP node changes so that rows don't re-evaluate them every paint
+	FText Label;
+	FText ToolTip;
+	FText Status;
+	FLinearColor StatusColor = FLinearColor::White;
+	FText Details;
+	// True if the display values must be updated before being displayed
+	bool bNeedsUpdate = true;
+
+	// Child TOP nodes, followed by the work results of the node
+	TArray<TSharedPtr<FHoudiniPDGTOPNodeTreeItem>> Children;
+	int32 NumChildNodes = 0;
+
+	// The text blocks of the row currently displaying this item (invalid if the item is not visible)
+	TWeakPtr<STextBlock> LabelTextBlock;
+	TWeakPtr<STextBlock> StatusTextBlock;
+	TWeakPtr<STextBlock> DetailsTextBlock;
+};
+
+// Virtualized tree of the TOP nodes (and their work results) of the selected TOP network of a PDG asset link.
+// Rows are only generated for visible items, and are updated from the asset link's OnTOPNodesChanged notifications.
+class SHoudiniPDGTOPNodeTreeView : public SCompoundWidget
+{
+public:
+	typedef TSharedPtr<FHoudiniPDGTOPNodeTreeItem> FTreeItemPtr;
+
+	SLATE_BEGIN_ARGS(SHoudiniPDGTOPNodeTreeView)
+		: _PDGAssetLink(nullptr)
+	{}
+
+	SLATE_ARGUMENT(UHoudiniPDGAssetLink*, PDGAssetLink)
+	SLATE_END_ARGS()
+
+	/** Widget construct. **/
+	void Construct(const FArguments& InArgs);
+
+	virtual ~SHoudiniPDGTOPNodeTreeView();
+
+protected:
+	// Rebuild all the items from the selected TOP network
+	void RebuildItems();
+
+	// Select the item of the selected TOP node
+	void SyncSelection();
+
+	// Handler for the asset link's OnTOPNodesChanged
+	void OnTOPNodesChanged(UHoudiniPDGAssetLink* InPDGAssetLink, const TArray<UTOPNode*>& InChangedTOPNodes);
+
+	TSharedRef<ITableRow> OnGenerateRow(FTreeItemPtr InItem, const TSharedRef<STableViewBase>& InOwnerTable);
+	void OnGetChildren(FTreeItemPtr InItem, TArray<FTreeItemPtr>& OutChildren);
+	void OnSelectionChanged(FTreeItemPtr InItem, ESelectInfo::Type InSelectInfo);
+
+	// Resize the work result items of a TOP node item to match its TOP node, and update the visible ones.
+	// Returns true if the number of children changed.
+	bool UpdateWorkResultItems(FHoudiniPDGTOPNodeTreeItem& InNodeItem);
+
+	// Update the display values of an item
+	static void UpdateItem(FHoudiniPDGTOPNodeTreeItem& InItem);
+
+	// Push the display values of an item to its row, if it is visible
+	static void UpdateRow(const FHoudiniPDGTOPNodeTreeItem& InItem);
+
+	TWeakObjectPtr<UHoudiniPDGAssetLink> PDGAssetLink;
+
+	// The TOP network and TOP nodes version the items were built for
+	TWeakObjectPtr<UTOPNetwork> TOPNetwork;
+	uint32 TOPNodesVersion = 0;
+
+	TArray<FTreeItemPtr> RootItems;
+	TMap<TWeakObjectPtr<UTOPNode>, FTreeItemPtr> ItemsByTOPNode;
+
+	TSharedPtr<STreeView<FTreeItemPtr>> TreeView;
+
+	FDelegateHandle OnTOPNodesChangedHandle;
+
+	// Set while the selection is changed from code
+	bool bSyncingSelection = false;
+};
+
 class FHoudiniPDGDetails : public TSharedFromThis<FHoudiniPDGDetails>
 {
 	public:
@@ -135,6 +233,4 @@ class FHoudiniPDGDetails : public TSharedFromThis<FHoudiniPDGDetails>
 
 		TArray<TSharedPtr<FTextAndTooltip>> TOPNetworksPtr;
 
-		TArray<TSharedPtr<FTextAndTooltip>> TOPNodesPtr;
-
 };
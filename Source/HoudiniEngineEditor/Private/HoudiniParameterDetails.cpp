@@ -3243,7 +3243,13 @@ FHoudiniParameterDetails::CreateWidgetString( IDetailCategoryBuilder & HouParame
 					[
 						SAssignNew(MultiLineEditableTextBox, SMultiLineEditableTextBox)
 						.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
-						.Text(FText::FromString(MainParam->GetValueAt(Idx)))
+						.Text_Lambda([MainParam, Idx]()
+						{
+							// Bound to the value so cooks update the text without rebuilding the details
+							if (!MainParam || MainParam->IsPendingKill())
+								return FText::GetEmpty();
+							return FText::FromString(MainParam->GetValueAt(Idx));
+						})
 						.OnTextCommitted_Lambda([=](const FText& Val, ETextCommit::Type TextCommitType) { ChangeStringValueAt(Val.ToString(), nullptr, Idx, true, StringParams); })
 					]
 					+ SHorizontalBox::Slot()
@@ -3298,7 +3304,12 @@ FHoudiniParameterDetails::CreateWidgetString( IDetailCategoryBuilder & HouParame
 					[
 						SAssignNew(EditableTextBox, SEditableTextBox)
 						.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
-						.Text(FText::FromString(MainParam->GetValueAt(Idx)))
+						.Text_Lambda([MainParam, Idx]()
+						{
+							if (!MainParam || MainParam->IsPendingKill())
+								return FText::GetEmpty();
+							return FText::FromString(MainParam->GetValueAt(Idx));
+						})
 						.OnTextCommitted_Lambda([=](const FText& Val, ETextCommit::Type TextCommitType) 
 							{ ChangeStringValueAt(Val.ToString(), nullptr, Idx, true, StringParams); })
 					]
@@ -3374,7 +3385,13 @@ FHoudiniParameterDetails::CreateWidgetColor(IDetailCategoryBuilder & HouParamete
 	VerticalBox->AddSlot().Padding(2, 2, 5, 2)
 	[
 		SAssignNew(ColorBlock, SColorBlock)
-		.Color(MainParam->GetColorValue())
+		.Color_Lambda([MainParam]()
+		{
+			// Bound to the value so cooks update the color without rebuilding the details
+			if (!MainParam || MainParam->IsPendingKill())
+				return FLinearColor::White;
+			return MainParam->GetColorValue();
+		})
 		.ShowBackgroundForAlpha(bHasAlpha)
 		.OnMouseButtonDown(FPointerEventHandler::CreateLambda(
 		[MainParam, ColorParams, ColorBlock, bHasAlpha](const FGeometry & MyGeometry, const FPointerEvent & MouseEvent)
@@ -3819,7 +3836,13 @@ void FHoudiniParameterDetails::CreateWidgetFile(IDetailCategoryBuilder & HouPara
 				.BrowseButtonToolTip(BrowseTooltip)
 				.BrowseDirectory(FileWidgetBrowsePath)
 				.BrowseTitle(LOCTEXT("PropertyEditorTitle", "File picker..."))
-				.FilePath(FileWidgetPath)
+				.FilePath_Lambda([MainParam, Idx]()
+				{
+					// Bound to the value so cooks update the path without rebuilding the details
+					if (!MainParam || MainParam->IsPendingKill() || MainParam->GetNumValues() <= Idx)
+						return FString();
+					return MainParam->GetValueAt(Idx);
+				})
 				.FileTypeFilter(FileTypeWidgetFilter)
 				.IsNewFile(bIsNewFile)
 				.IsDirectoryPicker(IsDirectoryPicker)
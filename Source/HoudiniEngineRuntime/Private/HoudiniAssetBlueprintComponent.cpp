@@ -1494,6 +1494,41 @@ UHoudiniAssetBlueprintComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
 	Super::OnComponentDestroyed(bDestroyingHierarchy);
 }
 
+uint64
+UHoudiniAssetBlueprintComponent::GetInputSnapshotStamp(UHoudiniInput* InInput)
+{
+	if (!IsValid(InInput))
+		return 0;
+
+	// Applying the snapshot of inputs referencing components reads the state of those components,
+	// which can change without the input changing: these snapshots can't be shared.
+	TArray<UHoudiniInputSceneComponent*> SceneComponentObjects;
+	InInput->GetAllHoudiniInputSceneComponents(SceneComponentObjects);
+	TArray<UHoudiniInputHoudiniSplineComponent*> SplineComponentObjects;
+	InInput->GetAllHoudiniInputSplineComponents(SplineComponentObjects);
+	if (SceneComponentObjects.Num() > 0 || SplineComponentObjects.Num() > 0)
+		return 0;
+
+	return InInput->GetChangeStamp();
+}
+
+UHoudiniInput*
+UHoudiniAssetBlueprintComponent::GetReusableInputSnapshot(int32 InInputIndex) const
+{
+	if (!InputSnapshots.IsValidIndex(InInputIndex) || !InputSnapshotStamps.IsValidIndex(InInputIndex))
+		return nullptr;
+
+	UHoudiniInput* Snapshot = InputSnapshots[InInputIndex];
+	if (!IsValid(Snapshot))
+		return nullptr;
+
+	const uint64 SnapshotStamp = InputSnapshotStamps[InInputIndex];
+	if (SnapshotStamp == 0 || SnapshotStamp != GetInputSnapshotStamp(Inputs[InInputIndex]))
+		return nullptr;
+
+	return Snapshot;
+}
+
 TStructOnScope<FActorComponentInstanceData> 
 UHoudiniAssetBlueprintComponent::GetComponentInstanceData() const
 {
@@ -1521,11 +1556,17 @@ UHoudiniAssetBlueprintComponent::GetComponentInstanceData() const
 
 	InstanceData->Inputs.Empty();
 
-	for (UHoudiniInput* Input : Inputs)
+	for (int32 InputIdx = 0; InputIdx < Inputs.Num(); InputIdx++)
 	{
+		UHoudiniInput* Input = Inputs[InputIdx];
 		if (!Input)
 			continue;
-		UHoudiniInput* TransientInput = Input->DuplicateAndCopyState(GetTransientPackage(), false);
+
+		// Only duplicate the inputs that changed since the last reconstruction, 
+		// the others can share the snapshot that was applied to this component.
+		UHoudiniInput* TransientInput = GetReusableInputSnapshot(InputIdx);
+		if (!TransientInput)
+			TransientInput = Input->DuplicateAndCopyState(GetTransientPackage(), false);
 		InstanceData->Inputs.Add(TransientInput);
 	}
 
@@ -1537,7 +1578,7 @@ UHoudiniAssetBlueprintComponent::GetComponentInstanceData() const
 		if (!Output)
 			continue;
 
-		TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> OutputObjects = Output->GetOutputObjects();
+		const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = Output->GetOutputObjects();
 		for (auto& Entry : OutputObjects)
 		{
 			FHoudiniAssetBlueprintOutput OutputObjectData;
@@ -1608,6 +1649,13 @@ UHoudiniAssetBlueprintComponent::ApplyComponentInstanceData(FHoudiniAssetBluepri
 			Inputs[i] = ToInput;
 		}
 
+		// Keep the snapshots so the next reconstruction can share them if the inputs don't change in the meantime.
+		// The stamps need to be recorded before the template's state is copied to the inputs.
+		InputSnapshots = InstanceData->Inputs;
+		InputSnapshotStamps.SetNum(NumInputs);
+		for (int32 InputIdx = 0; InputIdx < NumInputs; InputIdx++)
+			InputSnapshotStamps[InputIdx] = GetInputSnapshotStamp(Inputs[InputIdx]);
+
 		// We need to update FHoudiniOutputObject SceneComponent references to
 		// the newly created components. Since we cached a map of Output Object IDs to
 		// SCSNodes (during CopyStateToTemplateComponent), we can the SCSNode that corresponds to this output objects and find
@@ -193,6 +193,14 @@ protected:
 
 	USimpleConstructionScript* GetSCS() const;
 
+	// Change stamp of an input, used to detect if it changed since its snapshot was applied (see UHoudiniInput::GetChangeStamp()).
+	// Returns 0 if the input's snapshot can't be shared (its input objects reference components of the actor).
+	static uint64 GetInputSnapshotStamp(UHoudiniInput* InInput);
+
+	// Returns the snapshot of the input at InInputIndex applied by the last ApplyComponentInstanceData(),
+	// if the input hasn't changed since then. Null if a new snapshot is needed.
+	UHoudiniInput* GetReusableInputSnapshot(int32 InInputIndex) const;
+
 	//// The output translation has finished.
 	//void OnOutputProcessingCompletedHandler(UHoudiniAssetComponent * InComponent);
 
@@ -237,6 +245,15 @@ protected:
 	// input objects.
 	UPROPERTY()
 	TMap<FGuid, FGuid> CachedInputNodes;
+
+	// The (transient and immutable) input snapshots of the instance data last applied to this component.
+	// They are shared with the next instance data as long as the corresponding input doesn't change,
+	// so reconstructions don't duplicate inputs that haven't changed.
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TArray<UHoudiniInput*> InputSnapshots;
+
+	// Change stamp of each input right after its snapshot was applied, see GetInputSnapshotStamp()
+	TArray<uint64> InputSnapshotStamps;
 };
 
 
@@ -715,6 +715,9 @@ UHoudiniAssetComponent::UHoudiniAssetComponent(const FObjectInitializer & Object
 
 	LastTickTime = 0.0;
 
+	Version1CompatibilityHAC = nullptr;
+	bConvertedFromLegacyData = false;
+
 	// Initialize the default SM Build settings with the plugin's settings default values
 	StaticMeshBuildSettings = FHoudiniEngineRuntimeUtils::GetDefaultMeshBuildSettings();
 }
@@ -1431,6 +1434,58 @@ void UHoudiniAssetComponent::MarkAsBlueprintModified()
 	bBlueprintModified = true;
 }
 
+bool
+UHoudiniAssetComponent::ConvertPendingLegacyData()
+{
+	if (!Version1CompatibilityHAC)
+		return false;
+
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	bool bAutomaticLegacyHDARebuild = HoudiniRuntimeSettings->bAutomaticLegacyHDARebuild;
+
+	bool bConverted = ConvertLegacyData();
+	if (!bConverted)
+	{
+		HOUDINI_LOG_WARNING(TEXT("Failed to convert the legacy data of %s."), *GetPathName());
+
+		// Don't try to convert this component again
+		if (Version1CompatibilityHAC)
+		{
+			Version1CompatibilityHAC->MarkPendingKill();
+			Version1CompatibilityHAC = nullptr;
+		}
+	}
+
+	bConvertedFromLegacyData = bConverted;
+
+	if (bConverted && bAutomaticLegacyHDARebuild)
+		MarkAsNeedRebuild();
+	else
+		MarkAsNeedInstantiation();
+
+	return bConverted;
+}
+
+void
+UHoudiniAssetComponent::PreSave(const class ITargetPlatform* TargetPlatform)
+{
+	// Make sure deferred legacy data gets saved in the v2 format
+	if (HasPendingLegacyConversion())
+		ConvertPendingLegacyData();
+
+	Super::PreSave(TargetPlatform);
+}
+
+void
+UHoudiniAssetComponent::PreDuplicate(FObjectDuplicationParameters& DupParams)
+{
+	// The v1 data can't be duplicated, convert it first so the copy doesn't lose it
+	if (HasPendingLegacyConversion())
+		ConvertPendingLegacyData();
+
+	Super::PreDuplicate(DupParams);
+}
+
 void
 UHoudiniAssetComponent::PostLoad()
 {
@@ -1438,18 +1493,15 @@ UHoudiniAssetComponent::PostLoad()
 
 	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
 	bool bEnableBackwardCompatibility = HoudiniRuntimeSettings->bEnableBackwardCompatibility;
-	bool bAutomaticLegacyHDARebuild = HoudiniRuntimeSettings->bAutomaticLegacyHDARebuild;
 
 	// Legacy serialization: either try to convert or skip depending the setting value
 	if (bEnableBackwardCompatibility && Version1CompatibilityHAC != nullptr)
 	{
-		// If we have deserialized legacy v1 data, attempt to convert it now
-		ConvertLegacyData();
-
-		if(bAutomaticLegacyHDARebuild)
-			MarkAsNeedRebuild();
-		else
-			MarkAsNeedInstantiation();
+		// If we have deserialized legacy v1 data, the Houdini Engine Manager will convert it in batches.
+		// Nothing will convert it in commandlets or outside of the editor, and templates (blueprints)
+		// are never registered to the manager, so convert those now.
+		if (IsRunningCommandlet() || !GIsEditor || IsTemplate())
+			ConvertPendingLegacyData();
 	}
 	else
 	{
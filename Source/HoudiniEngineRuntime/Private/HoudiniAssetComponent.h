@@ -165,6 +165,18 @@ public:
 
 	virtual bool ConvertLegacyData();
 
+	// Returns true if this component has deserialized v1 data that hasn't been converted yet.
+	// The conversion is deferred after PostLoad() so that loading levels with many legacy components
+	// doesn't stall, the Houdini Engine Manager converts them in batches over several ticks.
+	bool HasPendingLegacyConversion() const { return Version1CompatibilityHAC != nullptr; };
+
+	// Converts the pending v1 data (if any) and marks the component as needing instantiation / rebuild.
+	// Returns true if legacy data was converted.
+	bool ConvertPendingLegacyData();
+
+	// Returns true if this component has been converted from v1 data since it was loaded.
+	bool WasConvertedFromLegacyData() const { return bConvertedFromLegacyData; };
+
 	// Called after the C++ constructor and after the properties have been initialized, including those loaded from config.
 	// This is called before any serialization or other setup has happened.
 	virtual void PostInitProperties() override;
@@ -469,6 +481,12 @@ protected:
 	// This is not called for newly - created objects, and by default will always execute on the game thread.
 	virtual void PostLoad() override;
 
+	// Called before the object is saved, pending legacy data is converted so it isn't lost.
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+
+	// Called before the object is duplicated, pending legacy data is converted so the copy gets it.
+	virtual void PreDuplicate(FObjectDuplicationParameters& DupParams) override;
+
 	// Called after importing property values for this object (paste, duplicate or .t3d import)
 	// Allow the object to perform any cleanup for properties which shouldn't be duplicated or
 	// Are unsupported by the script serialization
@@ -741,8 +759,14 @@ protected:
 	USimpleConstructionScript* GetSCS() const;
 
 	// Object used to convert V1 HAC to V2 HAC
+	// The v1 data isn't duplicated: pending data is converted in PreDuplicate() instead.
+	UPROPERTY(Transient, NonTransactional)
 	UHoudiniAssetComponent_V1* Version1CompatibilityHAC;
 
+	// Indicates this component was converted from v1 data since it was loaded.
+	UPROPERTY(Transient, DuplicateTransient)
+	bool bConvertedFromLegacyData;
+
 	// The last timestamp this component was ticked
 	// used to prioritize/limit the number of HAC processed per tick
 	UPROPERTY(Transient)
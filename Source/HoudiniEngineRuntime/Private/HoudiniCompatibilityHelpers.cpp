@@ -75,6 +75,45 @@ UHoudiniAssetComponent_V1::UHoudiniAssetComponent_V1(const FObjectInitializer &
 {
 }
 
+void
+UHoudiniAssetComponent_V1::AddReferencedObjects(UObject * InThis, FReferenceCollector & Collector)
+{
+	UHoudiniAssetComponent_V1 * HAC = Cast<UHoudiniAssetComponent_V1>(InThis);
+	if (HAC && !HAC->IsPendingKill())
+	{
+		Collector.AddReferencedObject(HAC->HoudiniAsset, InThis);
+		Collector.AddReferencedObject(HAC->HoudiniAssetComponentMaterials, InThis);
+
+		for (auto& Pair : HAC->Parameters)
+			Collector.AddReferencedObject(Pair.Value, InThis);
+
+		for (auto& Pair : HAC->ParameterByName)
+			Collector.AddReferencedObject(Pair.Value, InThis);
+
+		Collector.AddReferencedObjects(HAC->Inputs, InThis);
+		Collector.AddReferencedObjects(HAC->InstanceInputs, InThis);
+
+		for (auto& Pair : HAC->StaticMeshes)
+			Collector.AddReferencedObject(Pair.Value, InThis);
+
+		for (auto& Pair : HAC->StaticMeshComponents)
+		{
+			// Keys can't be modified, the static meshes are referenced through StaticMeshes as well.
+			UStaticMesh* StaticMesh = Pair.Key;
+			Collector.AddReferencedObject(StaticMesh, InThis);
+			Collector.AddReferencedObject(Pair.Value, InThis);
+		}
+
+		for (auto& Pair : HAC->HandleComponents)
+			Collector.AddReferencedObject(Pair.Value, InThis);
+
+		for (auto& Pair : HAC->SplineComponents)
+			Collector.AddReferencedObject(Pair.Value, InThis);
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
 
 void
 UHoudiniAssetComponent_V1::Serialize(FArchive & Ar)
@@ -956,6 +956,9 @@ public:
 
 	virtual void Serialize(FArchive & Ar) override;
 
+	// The legacy data isn't made of UPROPERTYs, keep it alive until the deferred conversion.
+	static void AddReferencedObjects(UObject * InThis, FReferenceCollector & Collector);
+
 	/** Houdini Asset associated with this component. **/
 	UHoudiniAsset* HoudiniAsset;
 
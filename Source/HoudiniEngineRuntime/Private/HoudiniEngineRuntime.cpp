@@ -29,6 +29,7 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniGenericAttribute.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -65,6 +66,18 @@ void FHoudiniEngineRuntime::StartupModule()
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 	// Store the instance.
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = this;
+
+#if WITH_EDITOR
+	// The cached uproperty bindings point to the properties of the old classes after a reload/reinstancing
+	OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([](const TMap<UObject*, UObject*>& InReplacementMap)
+	{
+		FHoudiniGenericAttribute::ClearPropertyBindingCache();
+	});
+	OnReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason InReason)
+	{
+		FHoudiniGenericAttribute::ClearPropertyBindingCache();
+	});
+#endif
 }
 
 
@@ -72,6 +85,18 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+#if WITH_EDITOR
+	if (OnObjectsReplacedHandle.IsValid())
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove(OnObjectsReplacedHandle);
+	OnObjectsReplacedHandle.Reset();
+
+	if (OnReloadCompleteHandle.IsValid())
+		FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(OnReloadCompleteHandle);
+	OnReloadCompleteHandle.Reset();
+#endif
+
+	FHoudiniGenericAttribute::ClearPropertyBindingCache();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
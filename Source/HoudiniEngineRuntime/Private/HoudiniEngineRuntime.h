@@ -104,4 +104,8 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		TArray<int32> NodeIdsPendingDelete;
 
 		TArray<int32> NodeIdsParentPendingDelete;
+
+		// Delegate handles used to clear the uproperty binding cache when classes are reloaded/reinstanced
+		FDelegateHandle OnObjectsReplacedHandle;
+		FDelegateHandle OnReloadCompleteHandle;
 };
\ No newline at end of file
@@ -36,6 +36,21 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "EditorFramework/AssetImportData.h"
 #include "AI/Navigation/NavCollisionBase.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+	// Cache of property bindings, keyed by class and uproperty attribute name
+	typedef TPair<TWeakObjectPtr<UClass>, FString> FHoudiniPropertyBindingKey;
+	TMap<FHoudiniPropertyBindingKey, FHoudiniPropertyBinding> PropertyBindingCache;
+	FCriticalSection PropertyBindingCacheLock;
+
+	// Properties that UpdatePropertyAttributeOnObject() modifies manually instead of via reflection
+	bool IsPropertyHandledManually(const FString& InPropertyName)
+	{
+		return InPropertyName == "CollisionProfileName" || InPropertyName.Contains("Tags");
+	}
+}
 
 double
 FHoudiniGenericAttribute::GetDoubleValue(int32 index) const
@@ -195,7 +210,7 @@ FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(
 	if (PropertyName.IsEmpty())
 		return false;
 
-	// Some Properties need to be handle and modified manually...
+	// Some Properties need to be handle and modified manually... (see IsPropertyHandledManually)
 	if (PropertyName == "CollisionProfileName")
 	{
 		UPrimitiveComponent* PC = Cast<UPrimitiveComponent>(InObject);
@@ -246,6 +261,53 @@ FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(
 	return true;
 }
 
+int32
+FHoudiniGenericAttribute::UpdatePropertyAttributeOnObjects(
+	const TArray<UObject*>& InObjects, const FHoudiniGenericAttribute& InPropertyAttribute, const int32& InStartIndex)
+{
+	if (InPropertyAttribute.AttributeName.IsEmpty())
+		return 0;
+
+	const FString& PropertyName = InPropertyAttribute.AttributeName;
+	const bool bHandledManually = IsPropertyHandledManually(PropertyName);
+
+	// Resolve the binding once per class, objects usually all share the same class
+	UClass* LastClass = nullptr;
+	FHoudiniPropertyBinding LastBinding;
+
+	int32 NumSuccess = 0;
+	for (int32 ObjIdx = 0; ObjIdx < InObjects.Num(); ObjIdx++)
+	{
+		UObject* Object = InObjects[ObjIdx];
+		if (!Object || Object->IsPendingKill())
+			continue;
+
+		const int32 AtIndex = InStartIndex + ObjIdx;
+		if (!bHandledManually)
+		{
+			UClass* ObjectClass = Object->GetClass();
+			if (ObjectClass != LastClass)
+			{
+				LastClass = ObjectClass;
+				LastBinding = FindPropertyBindingOnClass(ObjectClass, PropertyName);
+			}
+
+			if (LastBinding.IsValid())
+			{
+				if (ModifyPropertyValueOnObject(Object, InPropertyAttribute, LastBinding.Property, LastBinding.GetContainer(Object), AtIndex))
+					NumSuccess++;
+				continue;
+			}
+		}
+
+		// Manually handled properties, or properties nested in the object's components/subobjects
+		if (UpdatePropertyAttributeOnObject(Object, InPropertyAttribute, AtIndex))
+			NumSuccess++;
+	}
+
+	return NumSuccess;
+}
+
 
 bool
 FHoudiniGenericAttribute::FindPropertyOnObject(
@@ -271,14 +333,14 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 	OutFoundProperty = nullptr;
 	OutFoundPropertyObject = InObject;
 
-	bool bPropertyHasBeenFound = false;
-	FHoudiniGenericAttribute::TryToFindProperty(
-		InObject,
-		ObjectClass,
-		InPropertyName,
-		OutFoundProperty,
-		bPropertyHasBeenFound,
-		OutContainer);
+	// Look for the property on the object's class (cached)
+	const FHoudiniPropertyBinding Binding = FindPropertyBindingOnClass(ObjectClass, InPropertyName);
+	if (Binding.IsValid())
+	{
+		OutFoundProperty = Binding.Property;
+		OutContainer = Binding.GetContainer(InObject);
+		return true;
+	}
 
 	/*
 	// TODO: Parsing needs to be made recursively!
@@ -355,18 +417,6 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 		return true;
 	*/
 
-	// Try with FindField??
-	if (!OutFoundProperty)
-		OutFoundProperty = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
-
-	// Try with FindPropertyByName ??
-	if (!OutFoundProperty)
-		OutFoundProperty = ObjectClass->FindPropertyByName(*InPropertyName);
-
-	// We found the Property we were looking for
-	if (OutFoundProperty)
-		return true;
-
 	// Handle common properties nested in classes
 	// Static Meshes
 	UStaticMesh* SM = Cast<UStaticMesh>(InObject);
@@ -421,6 +471,66 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 }
 
 
+FHoudiniPropertyBinding
+FHoudiniGenericAttribute::FindPropertyBindingOnClass(
+	UClass* InClass,
+	const FString& InPropertyName)
+{
+	FHoudiniPropertyBinding Binding;
+#if WITH_EDITOR
+	if (!InClass || InClass->IsPendingKill() || InPropertyName.IsEmpty())
+		return Binding;
+
+	const FHoudiniPropertyBindingKey Key(InClass, InPropertyName);
+	{
+		FScopeLock ScopeLock(&PropertyBindingCacheLock);
+		if (const FHoudiniPropertyBinding* CachedBinding = PropertyBindingCache.Find(Key))
+			return *CachedBinding;
+	}
+
+	// Not in the cache, do the full search.
+	// Use the class default object as the container base to compute the offset of the found property's container.
+	UObject* CDO = InClass->GetDefaultObject();
+	if (CDO)
+	{
+		void* FoundContainer = nullptr;
+		bool bPropertyHasBeenFound = false;
+		TryToFindProperty(
+			CDO,
+			InClass,
+			InPropertyName,
+			Binding.Property,
+			bPropertyHasBeenFound,
+			FoundContainer);
+
+		if (Binding.Property && FoundContainer)
+			Binding.ContainerOffset = (int32)(reinterpret_cast<uint8*>(FoundContainer) - reinterpret_cast<uint8*>(CDO));
+	}
+
+	// Try with FindField??
+	if (!Binding.Property)
+		Binding.Property = FindFProperty<FProperty>(InClass, *InPropertyName);
+
+	// Try with FindPropertyByName ??
+	if (!Binding.Property)
+		Binding.Property = InClass->FindPropertyByName(*InPropertyName);
+
+	// Failed searches are cached as well, so we don't repeat them for every object
+	{
+		FScopeLock ScopeLock(&PropertyBindingCacheLock);
+		PropertyBindingCache.Add(Key, Binding);
+	}
+#endif
+	return Binding;
+}
+
+void
+FHoudiniGenericAttribute::ClearPropertyBindingCache()
+{
+	FScopeLock ScopeLock(&PropertyBindingCacheLock);
+	PropertyBindingCache.Empty();
+}
+
 bool
 FHoudiniGenericAttribute::TryToFindProperty(
 	void* InContainer,
@@ -501,7 +611,7 @@ FHoudiniGenericAttribute::TryToFindProperty(
 bool
 FHoudiniGenericAttribute::ModifyPropertyValueOnObject(
 	UObject* InObject,
-	FHoudiniGenericAttribute InGenericAttribute,
+	const FHoudiniGenericAttribute& InGenericAttribute,
 	FProperty* FoundProperty,
 	void* InContainer,
 	const int32& InAtIndex)
@@ -920,4 +1030,4 @@ FHoudiniEngineUtils::TryToFindInArrayProperty(
 
 	return false;
 }
-*/
\ No newline at end of file
+*/
\ No newline at end of file
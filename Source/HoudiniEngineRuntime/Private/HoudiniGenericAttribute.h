@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include "UObject/WeakObjectPtr.h"
+
 #include "HoudiniGenericAttribute.generated.h"
 
 UENUM()
@@ -51,6 +53,26 @@ enum class EAttribOwner : int8
 	Detail,
 };
 
+// Result of a property search by name/label on a given class.
+// Since nested struct properties are stored inline, the container of the found property
+// is always at the same offset from the object's base address for every object of that class.
+struct HOUDINIENGINERUNTIME_API FHoudiniPropertyBinding
+{
+	// The property that was found, null if the search failed
+	FProperty* Property = nullptr;
+
+	// Byte offset of the property's container from the object, INDEX_NONE if the object itself is the container
+	int32 ContainerOffset = INDEX_NONE;
+
+	bool IsValid() const { return Property != nullptr; };
+
+	// Returns the container to use for this binding on a given object
+	void* GetContainer(UObject* InObject) const
+	{
+		return ContainerOffset == INDEX_NONE ? nullptr : reinterpret_cast<uint8*>(InObject) + ContainerOffset;
+	};
+};
+
 USTRUCT()
 struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 {
@@ -94,6 +116,11 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 	static bool UpdatePropertyAttributeOnObject(
 		UObject* InObject, const FHoudiniGenericAttribute& InPropertyAttribute, const int32& AtIndex = 0);
 
+	// Applies the attribute to multiple objects, InObjects[n] receives the tuple at (InStartIndex + n).
+	// The property is only resolved once per class. Returns the number of objects that were successfully modified.
+	static int32 UpdatePropertyAttributeOnObjects(
+		const TArray<UObject*>& InObjects, const FHoudiniGenericAttribute& InPropertyAttribute, const int32& InStartIndex = 0);
+
 	// Tries to find a Uproperty by name/label on an object
 	// FoundPropertyObject will be the object that actually contains the property
 	// and can be different from InObject if the property is nested.
@@ -107,7 +134,7 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 	// Modifies the value of a found Property
 	static bool ModifyPropertyValueOnObject(
 		UObject* InObject,
-		FHoudiniGenericAttribute InGenericAttribute,
+		const FHoudiniGenericAttribute& InGenericAttribute,
 		FProperty* FoundProperty,
 		void* InContainer,
 		const int32& AtIndex = 0 );
@@ -120,4 +147,16 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 		FProperty*& OutFoundProperty,
 		bool& bOutPropertyHasBeenFound,
 		void*& OutContainer);
-};
\ No newline at end of file
+
+	// Returns the (cached) binding for a property name/label on a class.
+	// The first lookup for a given class/name pair does the full reflection search,
+	// subsequent lookups (including failed ones) are resolved from the cache.
+	static FHoudiniPropertyBinding FindPropertyBindingOnClass(
+		UClass* InClass,
+		const FString& InPropertyName);
+
+	// Empties the property binding cache.
+	// Called when classes are reloaded/reinstanced (hot reload, blueprint compilation) as the cached
+	// properties and offsets become invalid.
+	static void ClearPropertyBindingCache();
+};
\ No newline at end of file
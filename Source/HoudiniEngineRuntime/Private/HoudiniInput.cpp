@@ -57,6 +57,8 @@
 #endif
 
 //
+uint64 UHoudiniInput::LastChangeStamp = 0;
+
 UHoudiniInput::UHoudiniInput()
 	: Type(EHoudiniInputType::Invalid)
 	, PreviousType(EHoudiniInputType::Invalid)
@@ -86,6 +88,7 @@ UHoudiniInput::UHoudiniInput()
 	, bLandscapeExportLighting(false)
 	, bLandscapeExportNormalizedUVs(false)
 	, bLandscapeExportTileUVs(false)
+	, ChangeStamp(++LastChangeStamp)
 {
 	Name = TEXT("");
 	Label = TEXT("");
@@ -639,6 +642,8 @@ UHoudiniInput::GetKeepWorldTransform() const
 void
 UHoudiniInput::SetKeepWorldTransform(const bool& bInKeepWorldTransform)
 {
+	UpdateChangeStamp();
+
 	if (bInKeepWorldTransform)
 	{
 		KeepWorldTransform = EHoudiniXformType::IntoThisObject;
@@ -655,6 +660,7 @@ UHoudiniInput::SetInputType(const EHoudiniInputType& InInputType, bool& bOutBlue
 	if (InInputType == Type)
 		return;
 
+	UpdateChangeStamp();
 	SetPreviousInputType(Type);
 
 	// Mark this input as changed
@@ -940,6 +946,7 @@ UHoudiniInput * UHoudiniInput::DuplicateAndCopyState(UObject * DestOuter, bool b
 
 void UHoudiniInput::CopyStateFrom(UHoudiniInput* InInput, bool bCopyAllProperties, bool bInCanDeleteHoudiniNodes)
 {
+	UpdateChangeStamp();
 
 	// Preserve the current input objects before the copy to ensure we don't lose 
 	// access to input objects and have them end up in the garbage.
@@ -1555,6 +1562,8 @@ UHoudiniInput::DeleteInputObjectAt(const int32& AtIndex)
 void
 UHoudiniInput::DeleteInputObjectAt(const EHoudiniInputType& InType, const int32& AtIndex)
 {
+	UpdateChangeStamp();
+
 	TArray<UHoudiniInputObject*>* InputObjectsPtr = GetHoudiniInputObjectArray(InType);
 	if (!InputObjectsPtr)
 		return;
@@ -1737,6 +1746,8 @@ UHoudiniInput::SetInputObjectAt(const int32& AtIndex, UObject* InObject)
 void
 UHoudiniInput::SetInputObjectAt(const EHoudiniInputType& InType, const int32& AtIndex, UObject* InObject)
 {
+	UpdateChangeStamp();
+
 	// Start by making sure we have the proper number of input objects
 	int32 NumIntObject = GetNumberOfInputObjects(InType);
 	if (NumIntObject <= AtIndex)
@@ -1813,6 +1824,8 @@ UHoudiniInput::SetInputObjectAt(const EHoudiniInputType& InType, const int32& At
 void
 UHoudiniInput::SetInputObjectsNumber(const EHoudiniInputType& InType, const int32& InNewCount)
 {
+	UpdateChangeStamp();
+
 	TArray<UHoudiniInputObject*>* InputObjectsPtr = GetHoudiniInputObjectArray(InType);
 	if (!InputObjectsPtr)
 		return;
@@ -1871,6 +1884,8 @@ UHoudiniInput::SetBoundSelectorObjectsNumber(const int32& InNewCount)
 		return;
 	}
 
+	UpdateChangeStamp();
+
 	if (InNewCount > WorldInputBoundSelectorObjects.Num())
 	{
 		// Simply add new default InputObjects
@@ -1900,6 +1915,8 @@ UHoudiniInput::SetBoundSelectorObjectsNumber(const int32& InNewCount)
 void
 UHoudiniInput::SetBoundSelectorObjectAt(const int32& AtIndex, AActor* InActor)
 {
+	UpdateChangeStamp();
+
 	// Start by making sure we have the proper number of objects
 	int32 NumIntObject = GetNumberOfBoundSelectorObjects();
 	if (NumIntObject <= AtIndex)
@@ -2165,6 +2182,8 @@ UHoudiniInput::SetTransformOffsetAt(const float& Value, const int32& AtIndex, co
 	if (!Transform)
 		return false;
 
+	UpdateChangeStamp();
+
 	if (PosRotScaleIndex == 0)
 	{
 		FVector Position = Transform->GetLocation();
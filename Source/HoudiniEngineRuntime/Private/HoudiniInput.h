@@ -208,6 +208,10 @@ public:
 	// Remove all instances of this input object from all object arrays.
 	void RemoveHoudiniInputObject(UHoudiniInputObject* InInputObject);
 
+	// Returns a stamp that changes every time this input or one of its input objects is marked as changed.
+	// Stamps are unique across all inputs, so comparing them also detects that the input was replaced.
+	uint64 GetChangeStamp() const { return ChangeStamp; };
+
 	bool IsAddRotAndScaleAttributesEnabled() const { return bAddRotAndScaleAttributesOnCurves; };
 
 	//------------------------------------------------------------------------------------------------
@@ -218,7 +222,11 @@ public:
 	{
 		bHasChanged = bInChanged;
 		SetNeedsToTriggerUpdate(bInChanged);
+		if (bInChanged)
+			UpdateChangeStamp();
 	};
+	// Gives a new change stamp to this input, see GetChangeStamp()
+	void UpdateChangeStamp() { ChangeStamp = ++LastChangeStamp; };
 	void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	void MarkDataUploadNeeded(const bool& bInDataUploadNeeded) { bDataUploadNeeded = bInDataUploadNeeded; };
 	void MarkAllInputObjectsChanged(const bool& bInChanged);
@@ -396,6 +404,12 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient)
 	bool bNeedsToTriggerUpdate;
 
+	// Current change stamp of this input, see GetChangeStamp()
+	uint64 ChangeStamp;
+
+	// Last change stamp given to an input
+	static uint64 LastChangeStamp;
+
 	// Indicates data for this input needs to be uploaded
 	// If this is false but the input has changed, we may have just updated in input parameter,
 	// and don't need to resend all the input data
@@ -70,6 +70,33 @@ UHoudiniInputObject::UHoudiniInputObject(const FObjectInitializer& ObjectInitial
 	Guid = FGuid::NewGuid();
 }
 
+void
+UHoudiniInputObject::MarkChanged(const bool& bInChanged)
+{
+	bHasChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+	if (bInChanged)
+		UpdateOuterInputChangeStamp();
+}
+
+void
+UHoudiniInputObject::MarkTransformChanged(const bool& bInChanged)
+{
+	bTransformChanged = bInChanged;
+	SetNeedsToTriggerUpdate(bInChanged);
+	if (bInChanged)
+		UpdateOuterInputChangeStamp();
+}
+
+void
+UHoudiniInputObject::UpdateOuterInputChangeStamp()
+{
+	// Changes to input objects are changes to the input that owns them
+	UHoudiniInput* OuterInput = Cast<UHoudiniInput>(GetOuter());
+	if (IsValid(OuterInput))
+		OuterInput->UpdateChangeStamp();
+}
+
 //
 UHoudiniInputStaticMesh::UHoudiniInputStaticMesh(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
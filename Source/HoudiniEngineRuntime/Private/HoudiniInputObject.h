@@ -120,8 +120,8 @@ public:
 	// Indicates if this input needs to trigger an update
 	virtual bool NeedsToTriggerUpdate() const { return bNeedsToTriggerUpdate; };
 
-	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
-	void MarkTransformChanged(const bool& bInChanged) { bTransformChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
+	virtual void MarkChanged(const bool& bInChanged);
+	void MarkTransformChanged(const bool& bInChanged);
 	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 
 	void SetImportAsReference(const bool& bInImportAsRef) { bImportAsReference = bInImportAsRef; };
@@ -178,6 +178,9 @@ public:
 
 protected:
 
+	// Gives a new change stamp to the input owning this input object
+	void UpdateOuterInputChangeStamp();
+
 	// Indicates this input object has changed
 	UPROPERTY(DuplicateTransient)
 	bool bHasChanged;
@@ -321,6 +321,19 @@ struct HOUDINIENGINERUNTIME_API FHoudiniBakedOutputObject
 		// In the case of mesh split instancer baking: this is the array of instance components
 		UPROPERTY()
 		TArray<FString> InstancedComponents;
+
+		// Fingerprints of the output object at the time of the bake, used to only rebake what changed.
+		// Hash of the baked asset's content (geometry, materials)
+		UPROPERTY()
+		uint32 BakedContentHash = 0;
+
+		// Hash of the transform(s) of the baked component
+		UPROPERTY()
+		uint32 BakedTransformHash = 0;
+
+		// Hash of the output object's attributes/tokens used for the bake
+		UPROPERTY()
+		uint32 BakedAttributesHash = 0;
 };
 
 // Container to hold the map of baked objects. There should be one of
@@ -37,6 +37,8 @@
 
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
 
 #if WITH_EDITOR
 	#include "FileHelpers.h"
@@ -44,6 +46,14 @@
 	#include "EditorModes.h"
 #endif
 
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePDGMaxVisibilityUpdatesPerFrame(
+	TEXT("HoudiniEngine.PDGMaxVisibilityUpdatesPerFrame"),
+	256,
+	TEXT("Maximum number of PDG work result actors whose visibility is changed per frame, for each PDG asset link.\n")
+	TEXT("<= 0: No Limit\n")
+	TEXT("256: Default\n")
+);
+
 //
 UHoudiniPDGAssetLink::UHoudiniPDGAssetLink(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -60,6 +70,11 @@ UHoudiniPDGAssetLink::UHoudiniPDGAssetLink(const FObjectInitializer& ObjectIniti
 	, OutputCachePath()
 	, bNeedsUIRefresh(false)
 	, OutputParentActor(nullptr)
+	, MaxLoadedWorkResultObjects(0)
+	, MaxLoadedWorkResultsMemoryMB(0)
+	, bLoadBudgetDirty(true)
+	, bHasResultsWaitingForLoadBudget(false)
+	, LastLoadBudgetTime(0.0)
 {
 	TOPNodeFilter = HAPI_UNREAL_PDG_DEFAULT_TOP_FILTER;
 	TOPOutputFilter = HAPI_UNREAL_PDG_DEFAULT_TOP_OUTPUT_FILTER;
@@ -87,6 +102,13 @@ FTOPWorkResultObject::FTOPWorkResultObject()
 	FilePath = FString();
 	State = EPDGWorkResultState::None;
 	WorkItemResultInfoIndex = INDEX_NONE;
+	LoadedResourceSize = 0;
+	LastViewedTime = 0.0;
+	LastKnownLocation = FVector::ZeroVector;
+	bHasLastKnownLocation = false;
+	bWaitingForLoadBudget = false;
+	bAppliedVisibility = false;
+	bHasAppliedVisibility = false;
 }
 
 FTOPWorkResultObject::~FTOPWorkResultObject()
@@ -206,94 +228,42 @@ FWorkItemTallyBase::ProgressRatio() const
 
 FWorkItemTally::FWorkItemTally()
 {
-	AllWorkItems.Empty();
-	WaitingWorkItems.Empty();
-	ScheduledWorkItems.Empty();
-	CookingWorkItems.Empty();
-	CookedWorkItems.Empty();
-	ErroredWorkItems.Empty();
-	CookCancelledWorkItems.Empty();
+	ZeroAll();
 }
 
 void
 FWorkItemTally::ZeroAll()
 {
-	AllWorkItems.Empty();
-	WaitingWorkItems.Empty();
-	ScheduledWorkItems.Empty();
-	CookingWorkItems.Empty();
-	CookedWorkItems.Empty();
-	ErroredWorkItems.Empty();
-	CookCancelledWorkItems.Empty();
-}
-
-void 
-FWorkItemTally::RemoveWorkItem(int32 InWorkItemID)
-{
-	RemoveWorkItemFromAllStateSets(InWorkItemID);
-	AllWorkItems.Remove(InWorkItemID);
-}
-
-void 
-FWorkItemTally::RecordWorkItemAsWaiting(int32 InWorkItemID)
-{
-	RemoveWorkItemFromAllStateSets(InWorkItemID);
-	WaitingWorkItems.Add(InWorkItemID);
-	AllWorkItems.Add(InWorkItemID);
-}
-
-void 
-FWorkItemTally::RecordWorkItemAsScheduled(int32 InWorkItemID)
-{
-	RemoveWorkItemFromAllStateSets(InWorkItemID);
-	ScheduledWorkItems.Add(InWorkItemID);
-	AllWorkItems.Add(InWorkItemID);
-}
-
-void 
-FWorkItemTally::RecordWorkItemAsCooking(int32 InWorkItemID)
-{
-	RemoveWorkItemFromAllStateSets(InWorkItemID);
-	CookingWorkItems.Add(InWorkItemID);
-	AllWorkItems.Add(InWorkItemID);
-}
-
-void 
-FWorkItemTally::RecordWorkItemAsCooked(int32 InWorkItemID)
-{
-	RemoveWorkItemFromAllStateSets(InWorkItemID);
-	CookedWorkItems.Add(InWorkItemID);
-	AllWorkItems.Add(InWorkItemID);
+	WorkItemStates.Empty();
+	FMemory::Memzero(StateCounts);
 }
 
-void 
-FWorkItemTally::RecordWorkItemAsErrored(int32 InWorkItemID)
+EWorkItemTallyState
+FWorkItemTally::SetWorkItemState(int32 InWorkItemID, EWorkItemTallyState InState)
 {
-	RemoveWorkItemFromAllStateSets(InWorkItemID);
-	ErroredWorkItems.Add(InWorkItemID);
-	AllWorkItems.Add(InWorkItemID);
-}
+	EWorkItemTallyState PreviousState = EWorkItemTallyState::None;
+	if (InState == EWorkItemTallyState::None)
+	{
+		WorkItemStates.RemoveAndCopyValue(InWorkItemID, PreviousState);
+	}
+	else
+	{
+		EWorkItemTallyState& State = WorkItemStates.FindOrAdd(InWorkItemID, EWorkItemTallyState::None);
+		PreviousState = State;
+		State = InState;
+	}
 
-void 
-FWorkItemTally::RecordWorkItemAsCookCancelled(int32 InWorkItemID)
-{
-	RemoveWorkItemFromAllStateSets(InWorkItemID);
-	CookCancelledWorkItems.Add(InWorkItemID);
-	AllWorkItems.Add(InWorkItemID);
-}
+	if (PreviousState != InState)
+	{
+		if (PreviousState != EWorkItemTallyState::None)
+			StateCounts[(uint8)PreviousState]--;
+		if (InState != EWorkItemTallyState::None)
+			StateCounts[(uint8)InState]++;
+	}
 
-void
-FWorkItemTally::RemoveWorkItemFromAllStateSets(int32 InWorkItemID)
-{
-	WaitingWorkItems.Remove(InWorkItemID);
-	ScheduledWorkItems.Remove(InWorkItemID);
-	CookingWorkItems.Remove(InWorkItemID);
-	CookedWorkItems.Remove(InWorkItemID);
-	ErroredWorkItems.Remove(InWorkItemID);
-	CookCancelledWorkItems.Remove(InWorkItemID);
+	return PreviousState;
 }
 
-
 FAggregatedWorkItemTally::FAggregatedWorkItemTally()
 {
 	TotalWorkItems = 0;
@@ -341,6 +311,48 @@ FAggregatedWorkItemTally::Subtract(const FWorkItemTallyBase& InWorkItemTally)
 	CookCancelledWorkItems -= InWorkItemTally.NumCookCancelledWorkItems();
 }
 
+void
+FAggregatedWorkItemTally::ApplyWorkItemStateChange(EWorkItemTallyState InPreviousState, EWorkItemTallyState InNewState)
+{
+	if (InPreviousState == InNewState)
+		return;
+
+	if (InPreviousState == EWorkItemTallyState::None)
+		TotalWorkItems++;
+	else if (InNewState == EWorkItemTallyState::None)
+		TotalWorkItems--;
+
+	int32* PreviousCounter = GetStateCounter(InPreviousState);
+	if (PreviousCounter)
+		(*PreviousCounter)--;
+
+	int32* NewCounter = GetStateCounter(InNewState);
+	if (NewCounter)
+		(*NewCounter)++;
+}
+
+int32*
+FAggregatedWorkItemTally::GetStateCounter(EWorkItemTallyState InState)
+{
+	switch (InState)
+	{
+		case EWorkItemTallyState::Waiting:
+			return &WaitingWorkItems;
+		case EWorkItemTallyState::Scheduled:
+			return &ScheduledWorkItems;
+		case EWorkItemTallyState::Cooking:
+			return &CookingWorkItems;
+		case EWorkItemTallyState::Cooked:
+			return &CookedWorkItems;
+		case EWorkItemTallyState::Errored:
+			return &ErroredWorkItems;
+		case EWorkItemTallyState::CookCancelled:
+			return &CookCancelledWorkItems;
+		default:
+			return nullptr;
+	}
+}
+
 
 UTOPNode::UTOPNode()
 {
@@ -351,6 +363,9 @@ UTOPNode::UTOPNode()
 
 	WorkResultParent = nullptr;
 	WorkResult.SetNum(0);
+	NumIndexedWorkResults = INDEX_NONE;
+	bAppliedVisibility = false;
+	bHasAppliedVisibility = false;
 
 	bHidden = false;
 	bAutoLoad = false;
@@ -360,6 +375,7 @@ UTOPNode::UTOPNode()
 	bCachedHaveNotLoadedWorkResults = false;
 	bCachedHaveLoadedWorkResults = false;
 	bHasChildNodes = false;
+	ParentTOPNode = nullptr;
 	
 	bShow = false;
 
@@ -385,8 +401,37 @@ void
 UTOPNode::Reset()
 {
 	NodeState = EPDGNodeState::None;
+	ZeroWorkItemTally();
+}
+
+void
+UTOPNode::ZeroWorkItemTally()
+{
+	// Remove our work items from the aggregated tallies of our parents
+	if (!bHasChildNodes && WorkItemTally.NumWorkItems() > 0)
+	{
+		for (UTOPNode* Parent = ParentTOPNode; IsValid(Parent); Parent = Parent->ParentTOPNode)
+		{
+			Parent->AggregatedWorkItemTally.Subtract(WorkItemTally);
+		}
+	}
+
 	WorkItemTally.ZeroAll();
-	AggregatedWorkItemTally.ZeroAll();
+	// Nodes with children have their aggregated tallies updated by their child nodes
+	if (!bHasChildNodes)
+		AggregatedWorkItemTally.ZeroAll();
+}
+
+void
+UTOPNode::PropagateWorkItemStateChange(EWorkItemTallyState InPreviousState, EWorkItemTallyState InNewState)
+{
+	if (InPreviousState == InNewState || bHasChildNodes)
+		return;
+
+	for (UTOPNode* Parent = ParentTOPNode; IsValid(Parent); Parent = Parent->ParentTOPNode)
+	{
+		Parent->AggregatedWorkItemTally.ApplyWorkItemStateChange(InPreviousState, InNewState);
+	}
 }
 
 void UTOPNode::OnWorkItemWaiting(int32 InWorkItemID)
@@ -400,7 +445,7 @@ void UTOPNode::OnWorkItemWaiting(int32 InWorkItemID)
 			WRO.SetAutoBakedSinceLastLoad(false);
 		}
 	}
-	WorkItemTally.RecordWorkItemAsWaiting(InWorkItemID);
+	PropagateWorkItemStateChange(WorkItemTally.RecordWorkItemAsWaiting(InWorkItemID), EWorkItemTallyState::Waiting);
 }
 
 void
@@ -412,7 +457,7 @@ UTOPNode::OnWorkItemCooked(int32 InWorkItemID)
 		// all the work items are being recooked.
 		InvalidateLandscapeCache();
 	}
-	WorkItemTally.RecordWorkItemAsCooked(InWorkItemID);
+	PropagateWorkItemStateChange(WorkItemTally.RecordWorkItemAsCooked(InWorkItemID), EWorkItemTallyState::Cooked);
 }
 
 void
@@ -426,28 +471,63 @@ UTOPNode::SetVisibleInLevel(bool bInVisible)
 }
 
 void
-UTOPNode::UpdateOutputVisibilityInLevel()
+UTOPNode::UpdateOutputVisibilityInLevel(const bool bInApplyNow)
 {
-	AActor* Actor = OutputActorOwner.GetOutputActor();
-	if (IsValid(Actor))
+	// Let the asset link apply the visibility over the next frames,
+	// so showing/hiding nodes with many results doesn't stall a single frame
+	UHoudiniPDGAssetLink* AssetLink = Cast<UHoudiniPDGAssetLink>(GetOuter());
+	if (!bInApplyNow && IsValid(AssetLink))
+	{
+		AssetLink->QueueOutputVisibilityUpdate(this);
+		return;
+	}
+
+	int32 Budget = MAX_int32;
+	ApplyOutputVisibilityInLevel(Budget);
+}
+
+bool
+UTOPNode::ApplyOutputVisibilityInLevel(int32& InOutBudget)
+{
+	// Changing the actor's hidden flags marks its components' render state dirty,
+	// the render states are then recreated once at the end of the frame
+	auto SetActorVisibility = [this, &InOutBudget](AActor* InActor)
 	{
-		Actor->SetHidden(!bShow);
+		InActor->SetHidden(!bShow);
 #if WITH_EDITOR
-		Actor->SetIsTemporarilyHiddenInEditor(!bShow);
+		InActor->SetIsTemporarilyHiddenInEditor(!bShow);
 #endif
+		// A single work result can update several actors (its landscapes), don't go below 0
+		InOutBudget = FMath::Max(InOutBudget - 1, 0);
+	};
+
+	AActor* Actor = OutputActorOwner.GetOutputActor();
+	if (!bHasAppliedVisibility || bAppliedVisibility != bShow || VisibilityAppliedToActor.Get() != Actor)
+	{
+		if (InOutBudget <= 0)
+			return false;
+
+		if (IsValid(Actor))
+			SetActorVisibility(Actor);
+
+		VisibilityAppliedToActor = Actor;
+		bAppliedVisibility = bShow;
+		bHasAppliedVisibility = true;
 	}
+
 	for (FTOPWorkResult& WorkItem : WorkResult)
 	{
 		for (FTOPWorkResultObject& WRO : WorkItem.ResultObjects)
 		{
 			AActor* WROActor = WRO.GetOutputActorOwner().GetOutputActor();
+			if (WRO.IsVisibilityApplied(WROActor, bShow))
+				continue;
+
+			if (InOutBudget <= 0)
+				return false;
+
 			if (IsValid(WROActor))
-			{
-				WROActor->SetHidden(!bShow);
-#if WITH_EDITOR
-				WROActor->SetIsTemporarilyHiddenInEditor(!bShow);
-#endif
-			}
+				SetActorVisibility(WROActor);
 
 			// We need to manually handle child landscape's visiblity
 			for (UHoudiniOutput* ResultOutput : WRO.GetResultOutputs())
@@ -466,14 +546,34 @@ UTOPNode::UpdateOutputVisibilityInLevel()
 					if (!Landscape || Landscape->IsPendingKill())
 						continue;
 
-					Landscape->SetHidden(!bShow);
+					// The landscape is shared by the tiles of multiple work results
+					bool bLandscapeUpToDate = Landscape->IsHidden() == !bShow;
 #if WITH_EDITOR
-					Landscape->SetIsTemporarilyHiddenInEditor(!bShow);
+					bLandscapeUpToDate = bLandscapeUpToDate && Landscape->IsTemporarilyHiddenInEditor() == !bShow;
 #endif
+					if (bLandscapeUpToDate)
+						continue;
+
+					SetActorVisibility(Landscape);
 				}
 			}
+
+			WRO.SetVisibilityApplied(WROActor, bShow);
 		}
-	}	
+	}
+
+	return true;
+}
+
+void
+UTOPNode::InvalidateAppliedOutputVisibility()
+{
+	bHasAppliedVisibility = false;
+	for (FTOPWorkResult& WorkItem : WorkResult)
+	{
+		for (FTOPWorkResultObject& WRO : WorkItem.ResultObjects)
+			WRO.InvalidateAppliedVisibility();
+	}
 }
 
 void
@@ -488,6 +588,10 @@ UTOPNode::SetNotLoadedWorkResultsToLoad(bool bInAlsoSetDeletedToLoad)
 				WRO.State = EPDGWorkResultState::ToLoad;
 		}
     }	
+
+	UHoudiniPDGAssetLink* AssetLink = Cast<UHoudiniPDGAssetLink>(GetOuter());
+	if (IsValid(AssetLink))
+		AssetLink->MarkLoadBudgetDirty();
 }
 
 void
@@ -499,6 +603,9 @@ UTOPNode::SetLoadedWorkResultsToDelete()
 		{
 			if (WRO.State == EPDGWorkResultState::Loaded)
 				WRO.State = EPDGWorkResultState::ToDelete;
+
+			// Unloaded by the user: don't let the load budget bring it back
+			WRO.bWaitingForLoadBudget = false;
 		}
     }	
 }
@@ -518,9 +625,15 @@ UTOPNode::DeleteWorkResultOutputObjects()
 				WRO.GetOutputActorOwner().DestroyOutputActor();
 				WRO.State = EPDGWorkResultState::Deleted;
 			}
+			WRO.bWaitingForLoadBudget = false;
 		}
     }
 	bCachedHaveLoadedWorkResults = false;
+
+	// Results were unloaded
+	UHoudiniPDGAssetLink* AssetLink = Cast<UHoudiniPDGAssetLink>(GetOuter());
+	if (IsValid(AssetLink))
+		AssetLink->MarkLoadBudgetDirty();
 }
 
 FString
@@ -576,9 +689,41 @@ UTOPNode::GetBakedWorkResultObjectOutputs(int32 InWorkResultArrayIndex, int32 In
 	return true;
 }
 
+void
+UTOPNode::UpdateWorkResultLookup()
+{
+	const int32 NumEntries = WorkResult.Num();
+	if (NumIndexedWorkResults == NumEntries)
+		return;
+
+	WorkResultIndexByID.Empty(NumEntries);
+	WorkResultIndexByHAPIIndex.Empty(NumEntries);
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		const FTOPWorkResult& CurResult = WorkResult[Index];
+		if (!WorkResultIndexByID.Contains(CurResult.WorkItemID))
+			WorkResultIndexByID.Add(CurResult.WorkItemID, Index);
+		if (!WorkResultIndexByHAPIIndex.Contains(CurResult.WorkItemIndex))
+			WorkResultIndexByHAPIIndex.Add(CurResult.WorkItemIndex, Index);
+	}
+
+	NumIndexedWorkResults = NumEntries;
+}
+
 int32
 UTOPNode::IndexOfWorkResultByID(const int32& InWorkItemID)
 {
+	UpdateWorkResultLookup();
+
+	const int32* FoundIndex = WorkResultIndexByID.Find(InWorkItemID);
+	if (!FoundIndex)
+		return INDEX_NONE;
+
+	if (WorkResult.IsValidIndex(*FoundIndex) && WorkResult[*FoundIndex].WorkItemID == InWorkItemID)
+		return *FoundIndex;
+
+	// The lookup is stale (an entry was modified directly), search the array and rebuild the lookup
+	InvalidateWorkResultLookup();
 	const int32 NumEntries = WorkResult.Num();
 	for (int32 Index = 0; Index < NumEntries; ++Index)
 	{
@@ -605,6 +750,20 @@ UTOPNode::GetWorkResultByID(const int32& InWorkItemID)
 int32
 UTOPNode::IndexOfWorkResultByHAPIIndex(const int32& InWorkItemIndex, bool bInWithInvalidWorkItemID)
 {
+	UpdateWorkResultLookup();
+
+	const int32* FoundIndex = WorkResultIndexByHAPIIndex.Find(InWorkItemIndex);
+	if (!FoundIndex)
+		return INDEX_NONE;
+
+	if (WorkResult.IsValidIndex(*FoundIndex))
+	{
+		const FTOPWorkResult& FoundResult = WorkResult[*FoundIndex];
+		if (FoundResult.WorkItemIndex == InWorkItemIndex && (!bInWithInvalidWorkItemID || FoundResult.WorkItemID == INDEX_NONE))
+			return *FoundIndex;
+	}
+
+	// The first entry with this index doesn't match (or the lookup is stale): search the array
 	const int32 NumEntries = WorkResult.Num();
 	for (int32 Index = 0; Index < NumEntries; ++Index)
 	{
@@ -635,6 +794,65 @@ UTOPNode::GetWorkResultByArrayIndex(const int32& InArrayIndex)
 	return &WorkResult[InArrayIndex];
 }
 
+int32
+UTOPNode::AddWorkResult(const FTOPWorkResult& InWorkResult)
+{
+	UpdateWorkResultLookup();
+
+	const int32 Index = WorkResult.Add(InWorkResult);
+	if (!WorkResultIndexByID.Contains(InWorkResult.WorkItemID))
+		WorkResultIndexByID.Add(InWorkResult.WorkItemID, Index);
+	if (!WorkResultIndexByHAPIIndex.Contains(InWorkResult.WorkItemIndex))
+		WorkResultIndexByHAPIIndex.Add(InWorkResult.WorkItemIndex, Index);
+	NumIndexedWorkResults = WorkResult.Num();
+
+	return Index;
+}
+
+void
+UTOPNode::RemoveWorkResultAt(const int32& InArrayIndex)
+{
+	if (!WorkResult.IsValidIndex(InArrayIndex))
+		return;
+
+	WorkResult.RemoveAt(InArrayIndex);
+	// The following entries have moved, rebuild the lookups on the next search
+	InvalidateWorkResultLookup();
+}
+
+void
+UTOPNode::EmptyWorkResults()
+{
+	WorkResult.Empty();
+	WorkResultIndexByID.Empty();
+	WorkResultIndexByHAPIIndex.Empty();
+	NumIndexedWorkResults = 0;
+}
+
+void
+UTOPNode::SetWorkResultID(const int32& InArrayIndex, const int32& InWorkItemID)
+{
+	if (!WorkResult.IsValidIndex(InArrayIndex))
+		return;
+
+	const int32 PreviousID = WorkResult[InArrayIndex].WorkItemID;
+	WorkResult[InArrayIndex].WorkItemID = InWorkItemID;
+	if (PreviousID == InWorkItemID)
+		return;
+
+	// Other entries could share the previous ID (INDEX_NONE when loaded from disk), rebuild if this one was indexed
+	const int32* PreviousIndex = WorkResultIndexByID.Find(PreviousID);
+	if (PreviousIndex && *PreviousIndex == InArrayIndex)
+	{
+		InvalidateWorkResultLookup();
+		return;
+	}
+
+	const int32* FoundIndex = WorkResultIndexByID.Find(InWorkItemID);
+	if (!FoundIndex || *FoundIndex > InArrayIndex)
+		WorkResultIndexByID.Add(InWorkItemID, InArrayIndex);
+}
+
 bool
 UTOPNode::IsParentTOPNetwork(UTOPNetwork const * const InNetwork) const
 {
@@ -669,6 +887,10 @@ UTOPNode::PostTransacted(const FTransactionObjectEvent& TransactionEvent)
 	if (TransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
 		return;
 
+	InvalidateWorkResultLookup();
+	// The actors' visibility may have been restored along with the node, don't trust what was last applied
+	InvalidateAppliedOutputVisibility();
+
 	bool bUpdateVisibility = false;
 	for (const FName& PropName : TransactionEvent.GetChangedProperties())
 	{
@@ -764,6 +986,119 @@ UTOPNetwork::AnyWorkItemsPending() const
 	return false;
 }
 
+void
+UTOPNetwork::UpdateTOPNodeHierarchy()
+{
+	// Find the nodes with child nodes, by path
+	TMap<FString, UTOPNode*> ParentNodesByPath;
+	for (UTOPNode* Node : AllTOPNodes)
+	{
+		if (!IsValid(Node) || !Node->bHasChildNodes)
+			continue;
+
+		FString Path = Node->NodePath;
+		Path.RemoveFromEnd(TEXT("/"));
+		ParentNodesByPath.Add(Path, Node);
+		Node->AggregatedWorkItemTally.ZeroAll();
+	}
+
+	// Link each node to its nearest parent by stripping components from the end of its path
+	for (UTOPNode* Node : AllTOPNodes)
+	{
+		if (!IsValid(Node))
+			continue;
+
+		Node->ParentTOPNode = nullptr;
+		if (ParentNodesByPath.Num() <= 0)
+			continue;
+
+		FString Path = Node->NodePath;
+		Path.RemoveFromEnd(TEXT("/"));
+		int32 SeparatorIndex = INDEX_NONE;
+		while (Path.FindLastChar(TEXT('/'), SeparatorIndex) && SeparatorIndex > 0)
+		{
+			Path.LeftInline(SeparatorIndex, false);
+			UTOPNode** const ParentNode = ParentNodesByPath.Find(Path);
+			if (ParentNode)
+			{
+				Node->ParentTOPNode = *ParentNode;
+				break;
+			}
+		}
+	}
+
+	// Rebuild the aggregated tallies of the parents from the current tallies of the leaf nodes
+	for (UTOPNode* Node : AllTOPNodes)
+	{
+		if (!IsValid(Node) || Node->bHasChildNodes)
+			continue;
+
+		for (UTOPNode* Parent = Node->ParentTOPNode; IsValid(Parent); Parent = Parent->ParentTOPNode)
+		{
+			Parent->AggregatedWorkItemTally.Add(Node->WorkItemTally);
+		}
+	}
+}
+
+// Priority of a node state when determining the state of a parent node from its child nodes
+static int8
+GetNodeStatePriority(const EPDGNodeState InState)
+{
+	switch (InState)
+	{
+		case EPDGNodeState::Cook_Complete:
+			return 1;
+		case EPDGNodeState::Dirtied:
+			return 2;
+		case EPDGNodeState::Cook_Failed:
+			return 3;
+		case EPDGNodeState::Dirtying:
+			return 4;
+		case EPDGNodeState::Cooking:
+			return 5;
+		case EPDGNodeState::None:
+		default:
+			return 0;
+	}
+}
+
+void
+UTOPNetwork::UpdateParentTOPNodeStates()
+{
+	for (UTOPNode* Node : AllTOPNodes)
+	{
+		if (IsValid(Node) && Node->bHasChildNodes)
+			Node->NodeState = EPDGNodeState::None;
+	}
+
+	for (const UTOPNode* Node : AllTOPNodes)
+	{
+		if (!IsValid(Node) || Node->bHasChildNodes)
+			continue;
+
+		const int8 NodeStatePriority = GetNodeStatePriority(Node->NodeState);
+		for (UTOPNode* Parent = Node->ParentTOPNode; IsValid(Parent); Parent = Parent->ParentTOPNode)
+		{
+			if (NodeStatePriority > GetNodeStatePriority(Parent->NodeState))
+				Parent->NodeState = Node->NodeState;
+		}
+	}
+}
+
+#if WITH_EDITOR
+void
+UTOPNetwork::PostTransacted(const FTransactionObjectEvent& TransactionEvent)
+{
+	Super::PostTransacted(TransactionEvent);
+
+	if (TransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
+		return;
+
+	// AllTOPNodes could have been restored, relink the nodes and rebuild the aggregated tallies
+	UpdateTOPNodeHierarchy();
+}
+#endif
+
 
 void
 UHoudiniPDGAssetLink::SelectTOPNetwork(const int32& AtIndex)
@@ -785,6 +1120,9 @@ UHoudiniPDGAssetLink::SelectTOPNode(UTOPNetwork* InTOPNetwork, const int32& AtIn
 		return;
 
 	InTOPNetwork->SelectedTOPIndex = AtIndex;
+
+	// Results of the selected TOP node have priority
+	MarkLoadBudgetDirty();
 }
 
 
@@ -974,7 +1312,7 @@ UHoudiniPDGAssetLink::ClearTOPNodeWorkItemResults(UTOPNode* TOPNode)
 	{
 		DestroyWorkItemResultData(CurrentWorkResult);
 	}
-	TOPNode->WorkResult.Empty();
+	TOPNode->EmptyWorkResults();
 
 	FOutputActorOwner& OutputActorOwner = TOPNode->GetOutputActorOwner();
 	AActor* OutputActor = OutputActorOwner.GetOutputActor();
@@ -1029,10 +1367,9 @@ UHoudiniPDGAssetLink::DestroyWorkItemByID(const int32& InWorkItemID, UTOPNode* I
 	// so that we don't have to find its index again to remove it from the array
 	ClearWorkItemResultByID(InWorkItemID, InTOPNode);
 	// Find the index of the FTOPWorkResult for InWorkItemID in InTOPNode.WorkResult and remove it
-	const int32 Index = InTOPNode->WorkResult.IndexOfByPredicate(
-		[InWorkItemID](const FTOPWorkResult& InWorkItem) { return InWorkItem.WorkItemID == InWorkItemID; });
+	const int32 Index = InTOPNode->IndexOfWorkResultByID(InWorkItemID);
 	if (Index != INDEX_NONE && Index >= 0)
-		InTOPNode->WorkResult.RemoveAt(Index);
+		InTOPNode->RemoveWorkResultAt(Index);
 }
 
 FTOPWorkResult*
@@ -1099,39 +1436,9 @@ UHoudiniPDGAssetLink::UpdateTOPNodeWithChildrenWorkItemTallyAndState(UTOPNode* I
 	if (!InNode->bHasChildNodes)
 		return;
 
-	FString PrefixPath = InNode->NodePath;
-	if (!PrefixPath.EndsWith("/"))
-		PrefixPath += "/";
-	InNode->ZeroWorkItemTally();
-	InNode->NodeState = EPDGNodeState::None;
-
-	TMap<EPDGNodeState, int8> NodeStateOrder;
-	NodeStateOrder.Add(EPDGNodeState::None, 0);
-	NodeStateOrder.Add(EPDGNodeState::Cook_Complete, 1);
-	NodeStateOrder.Add(EPDGNodeState::Dirtied, 2);
-	NodeStateOrder.Add(EPDGNodeState::Cook_Failed, 3);
-	NodeStateOrder.Add(EPDGNodeState::Dirtying, 4);
-	NodeStateOrder.Add(EPDGNodeState::Cooking, 5);
-
-	int8 CurrentState = 0;
-	
-	for (const UTOPNode* Node : InNetwork->AllTOPNodes)
-	{
-		if (!IsValid(Node))
-			continue;
-		
-		if (Node->NodePath.StartsWith(PrefixPath) && !Node->bHasChildNodes)
-		{
-			InNode->AggregateTallyFromChildNode(Node);
-			const int8 VisitedNodeState = NodeStateOrder.FindChecked(Node->NodeState);
-			if (VisitedNodeState > CurrentState)
-				CurrentState = VisitedNodeState;
-		}
-	}
-
-	EPDGNodeState const* const NewState = NodeStateOrder.FindKey(CurrentState);
-	if (NewState)
-		InNode->NodeState = *NewState;
+	// The aggregated tallies are maintained incrementally via the node hierarchy: only the state has to be updated.
+	// This updates the state of all parent nodes of the network.
+	InNetwork->UpdateParentTOPNodeStates();
 }
 
 void
@@ -1149,15 +1456,12 @@ UHoudiniPDGAssetLink::UpdateWorkItemTally()
 				continue;
 			
 			// Only add up the tallys from nodes without children (since parent's aggregate the child work items counts)
-			if (CurrentTOPNode->bHasChildNodes)
-			{
-				UpdateTOPNodeWithChildrenWorkItemTallyAndState(CurrentTOPNode, CurrentTOPNet);
-			}
-			else
-			{
+			if (!CurrentTOPNode->bHasChildNodes)
 				WorkItemTally.Add(CurrentTOPNode->GetWorkItemTally());
-			}
 		}
+
+		// The parents' aggregated tallies are kept up to date as work items change state, only update their state
+		CurrentTOPNet->UpdateParentTOPNodeStates();
 	}
 }
 
@@ -1177,6 +1481,118 @@ UHoudiniPDGAssetLink::ResetTOPNetworkWorkItemTally(UTOPNetwork* TOPNetwork)
 	}
 }
 
+void
+UHoudiniPDGAssetLink::MarkTOPNodeChanged(UTOPNode* InTOPNode)
+{
+	// The aggregated tallies and states of the parents change with the node's
+	for (UTOPNode* Node = InTOPNode; IsValid(Node); Node = Node->GetParentTOPNode())
+	{
+		bool bAlreadyMarked = false;
+		ChangedTOPNodes.Add(Node, &bAlreadyMarked);
+		if (bAlreadyMarked)
+			break;
+	}
+}
+
+bool
+UHoudiniPDGAssetLink::ShouldApplyLoadBudget(double InNow) const
+{
+	// Results waiting for the budget are re-prioritized at most that often
+	const double WaitingResultsRefreshInterval = 0.5;
+
+	if (bLoadBudgetDirty)
+		return true;
+
+	return bHasResultsWaitingForLoadBudget && (InNow - LastLoadBudgetTime) >= WaitingResultsRefreshInterval;
+}
+
+void
+UHoudiniPDGAssetLink::OnLoadBudgetApplied(double InNow, bool bInHasResultsWaitingForBudget)
+{
+	bLoadBudgetDirty = false;
+	bHasResultsWaitingForLoadBudget = bInHasResultsWaitingForBudget;
+	LastLoadBudgetTime = InNow;
+}
+
+void
+UHoudiniPDGAssetLink::QueueOutputVisibilityUpdate(UTOPNode* InTOPNode)
+{
+	if (!IsValid(InTOPNode))
+		return;
+
+	PendingVisibilityTOPNodes.AddUnique(InTOPNode);
+
+	if (!VisibilityTickerHandle.IsValid())
+	{
+		VisibilityTickerHandle = FTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UHoudiniPDGAssetLink::TickOutputVisibilityUpdates));
+	}
+}
+
+bool
+UHoudiniPDGAssetLink::TickOutputVisibilityUpdates(float DeltaTime)
+{
+	if (!ProcessOutputVisibilityUpdates(CVarHoudiniEnginePDGMaxVisibilityUpdatesPerFrame.GetValueOnGameThread()))
+		return true;
+
+	// Nothing left to update, remove the ticker
+	VisibilityTickerHandle.Reset();
+	return false;
+}
+
+void
+UHoudiniPDGAssetLink::BeginDestroy()
+{
+	if (VisibilityTickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(VisibilityTickerHandle);
+		VisibilityTickerHandle.Reset();
+	}
+	PendingVisibilityTOPNodes.Empty();
+
+	Super::BeginDestroy();
+}
+
+bool
+UHoudiniPDGAssetLink::ProcessOutputVisibilityUpdates(int32 InMaxActorsToUpdate)
+{
+	int32 Budget = InMaxActorsToUpdate > 0 ? InMaxActorsToUpdate : MAX_int32;
+	int32 NumProcessed = 0;
+	for (; NumProcessed < PendingVisibilityTOPNodes.Num(); NumProcessed++)
+	{
+		UTOPNode* TOPNode = PendingVisibilityTOPNodes[NumProcessed].Get();
+		if (!IsValid(TOPNode))
+			continue;
+
+		// Out of budget: this node, and the ones after it, will continue on the next update
+		if (!TOPNode->ApplyOutputVisibilityInLevel(Budget))
+			break;
+	}
+
+	PendingVisibilityTOPNodes.RemoveAt(0, NumProcessed);
+	return PendingVisibilityTOPNodes.Num() <= 0;
+}
+
+void
+UHoudiniPDGAssetLink::BroadcastTOPNodeChanges()
+{
+	if (ChangedTOPNodes.Num() <= 0)
+		return;
+
+	TArray<UTOPNode*> TOPNodes;
+	TOPNodes.Reserve(ChangedTOPNodes.Num());
+	for (const TWeakObjectPtr<UTOPNode>& NodePtr : ChangedTOPNodes)
+	{
+		UTOPNode* const Node = NodePtr.Get();
+		if (IsValid(Node))
+			TOPNodes.Add(Node);
+	}
+	ChangedTOPNodes.Reset();
+
+	if (TOPNodes.Num() > 0)
+		OnTOPNodesChanged.Broadcast(this, TOPNodes);
+}
+
 
 FString 
 UHoudiniPDGAssetLink::GetAssetLinkStatus(const EPDGLinkState& InLinkState)
@@ -1440,6 +1856,12 @@ UHoudiniPDGAssetLink::PostEditChangeChainProperty(FPropertyChangedChainEvent& In
 			 PropertyName == GET_MEMBER_NAME_STRING_CHECKED(UHoudiniPDGAssetLink, bBakeMenuExpanded))
 	{
 		bNeedsUIRefresh = true;
+		MarkLoadBudgetDirty();
+	}
+	else if (PropertyName == GET_MEMBER_NAME_STRING_CHECKED(UHoudiniPDGAssetLink, MaxLoadedWorkResultObjects) ||
+			 PropertyName == GET_MEMBER_NAME_STRING_CHECKED(UHoudiniPDGAssetLink, MaxLoadedWorkResultsMemoryMB))
+	{
+		MarkLoadBudgetDirty();
 	}
 }
 
@@ -1454,6 +1876,9 @@ UHoudiniPDGAssetLink::PostTransacted(const FTransactionObjectEvent& TransactionE
 	if (TransactionEvent.GetEventType() != ETransactionObjectEventType::UndoRedo)
 		return;
 
+	// The TOP networks could have been restored to a previous state
+	NotifyTOPNodesChanged();
+
 	bool bDoFilterTOPNodesAndOutputs = false;
 	for (const FName& PropName : TransactionEvent.GetChangedProperties())
 	{
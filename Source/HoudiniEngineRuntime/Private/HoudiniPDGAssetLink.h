@@ -157,6 +157,13 @@ public:
 	// Setter for bAutoBakedSinceLastLoad
 	void SetAutoBakedSinceLastLoad(bool bInAutoBakedSinceLastLoad) { bAutoBakedSinceLastLoad = bInAutoBakedSinceLastLoad; }
 
+	// Indicates if bInVisible is the visibility that was last applied to InActor, the output actor of this work result object.
+	bool IsVisibilityApplied(const AActor* InActor, bool bInVisible) const { return bHasAppliedVisibility && bAppliedVisibility == bInVisible && VisibilityAppliedToActor.Get() == InActor; };
+	// Records the visibility applied to the output actor (and child landscapes) of this work result object.
+	void SetVisibilityApplied(AActor* InActor, bool bInVisible) { VisibilityAppliedToActor = InActor; bAppliedVisibility = bInVisible; bHasAppliedVisibility = true; };
+	// Forces the visibility to be applied again by the next visibility update.
+	void InvalidateAppliedVisibility() { bHasAppliedVisibility = false; };
+
 public:
 
 	UPROPERTY(NonTransactional)
@@ -169,6 +176,17 @@ public:
 	UPROPERTY(NonTransactional)
 	int32					WorkItemResultInfoIndex;
 
+	// Load budget bookkeeping, see UHoudiniPDGAssetLink::MaxLoadedWorkResultObjects.
+	// Estimated size in bytes of the output objects, when last loaded
+	int64					LoadedResourceSize;
+	// Last time (FPlatformTime::Seconds()) the output actor was rendered on screen, or loaded
+	double					LastViewedTime;
+	// Center of the outputs' bounds when last loaded, to prioritize the results close to the camera
+	FVector					LastKnownLocation;
+	bool					bHasLastKnownLocation;
+	// Set if the result was unloaded, or not loaded, to respect the budget: it is loaded again once it has priority
+	bool					bWaitingForLoadBudget;
+
 protected:
 	// UPROPERTY()
 	// TArray<UObject*>		ResultObjects;
@@ -187,6 +205,12 @@ private:
 
 	UPROPERTY(NonTransactional)
 	FOutputActorOwner OutputActorOwner;
+
+	// The output actor and visibility last applied by UTOPNode::ApplyOutputVisibilityInLevel(),
+	// used to skip the actors whose visibility doesn't change.
+	TWeakObjectPtr<AActor> VisibilityAppliedToActor;
+	bool bAppliedVisibility;
+	bool bHasAppliedVisibility;
 };
 
 USTRUCT()
@@ -235,6 +259,20 @@ public:
 	*/
 };
 
+// The state of a work item in a FWorkItemTally
+enum class EWorkItemTallyState : uint8
+{
+	None,
+	Waiting,
+	Scheduled,
+	Cooking,
+	Cooked,
+	Errored,
+	CookCancelled,
+
+	Num
+};
+
 USTRUCT()
 struct HOUDINIENGINERUNTIME_API FWorkItemTallyBase
 {
@@ -283,52 +321,44 @@ public:
 	// Mutators
 	//
 
-	// Empty all state sets, as well as AllWorkItems.
+	// Forget all work items and zero all counts.
 	virtual void ZeroAll() override;
 	
-	// Remove a work item from all state sets and AllWorkItems.
-	void RemoveWorkItem(int32 InWorkItemID);
+	// Remove a work item from the tally. Returns the previous state of the work item.
+	EWorkItemTallyState RemoveWorkItem(int32 InWorkItemID) { return SetWorkItemState(InWorkItemID, EWorkItemTallyState::None); };
+
+	// Record the new state of a work item. Returns its previous state.
+	EWorkItemTallyState RecordWorkItemAsWaiting(int32 InWorkItemID) { return SetWorkItemState(InWorkItemID, EWorkItemTallyState::Waiting); };
+	EWorkItemTallyState RecordWorkItemAsScheduled(int32 InWorkItemID) { return SetWorkItemState(InWorkItemID, EWorkItemTallyState::Scheduled); };
+	EWorkItemTallyState RecordWorkItemAsCooking(int32 InWorkItemID) { return SetWorkItemState(InWorkItemID, EWorkItemTallyState::Cooking); };
+	EWorkItemTallyState RecordWorkItemAsCooked(int32 InWorkItemID) { return SetWorkItemState(InWorkItemID, EWorkItemTallyState::Cooked); };
+	EWorkItemTallyState RecordWorkItemAsErrored(int32 InWorkItemID) { return SetWorkItemState(InWorkItemID, EWorkItemTallyState::Errored); };
+	EWorkItemTallyState RecordWorkItemAsCookCancelled(int32 InWorkItemID) { return SetWorkItemState(InWorkItemID, EWorkItemTallyState::CookCancelled); };
 
-	void RecordWorkItemAsWaiting(int32 InWorkItemID);
-	void RecordWorkItemAsScheduled(int32 InWorkItemID);
-	void RecordWorkItemAsCooking(int32 InWorkItemID);
-	void RecordWorkItemAsCooked(int32 InWorkItemID);
-	void RecordWorkItemAsErrored(int32 InWorkItemID);
-	void RecordWorkItemAsCookCancelled(int32 InWorkItemID);
+	// Set the state of a work item (None removes it from the tally). Returns its previous state.
+	EWorkItemTallyState SetWorkItemState(int32 InWorkItemID, EWorkItemTallyState InState);
 
 	//
 	// Accessors
 	//
 
-	virtual int32 NumWorkItems() const override { return AllWorkItems.Num(); }
-	virtual int32 NumWaitingWorkItems() const override { return WaitingWorkItems.Num(); }
-	virtual int32 NumScheduledWorkItems() const override { return ScheduledWorkItems.Num(); }
-	virtual int32 NumCookingWorkItems() const override { return CookingWorkItems.Num(); }
-	virtual int32 NumCookedWorkItems() const override { return CookedWorkItems.Num(); }
-	virtual int32 NumErroredWorkItems() const override { return ErroredWorkItems.Num(); }
-	virtual int32 NumCookCancelledWorkItems() const override { return CookCancelledWorkItems.Num(); }
+	virtual int32 NumWorkItems() const override { return WorkItemStates.Num(); }
+	virtual int32 NumWaitingWorkItems() const override { return GetStateCount(EWorkItemTallyState::Waiting); }
+	virtual int32 NumScheduledWorkItems() const override { return GetStateCount(EWorkItemTallyState::Scheduled); }
+	virtual int32 NumCookingWorkItems() const override { return GetStateCount(EWorkItemTallyState::Cooking); }
+	virtual int32 NumCookedWorkItems() const override { return GetStateCount(EWorkItemTallyState::Cooked); }
+	virtual int32 NumErroredWorkItems() const override { return GetStateCount(EWorkItemTallyState::Errored); }
+	virtual int32 NumCookCancelledWorkItems() const override { return GetStateCount(EWorkItemTallyState::CookCancelled); }
 	
 protected:
 
-	// Removes the work item id from all state sets (but not from AllWorkItems -- use RemoveWorkItem for that).
-	void RemoveWorkItemFromAllStateSets(int32 InWorkItemID);
+	int32 GetStateCount(EWorkItemTallyState InState) const { return StateCounts[(uint8)InState]; };
 
-	// We use sets to keep track of in what state a work item is. The set stores the WorkItemID.
-	
-	UPROPERTY()
-	TSet<int32> AllWorkItems;
-	UPROPERTY()
-	TSet<int32> WaitingWorkItems;
-	UPROPERTY()
-	TSet<int32> ScheduledWorkItems;
-	UPROPERTY()
-	TSet<int32> CookingWorkItems;
-	UPROPERTY()
-	TSet<int32> CookedWorkItems;
-	UPROPERTY()
-	TSet<int32> ErroredWorkItems;
-	UPROPERTY()
-	TSet<int32> CookCancelledWorkItems;
+	// The state of each work item, by WorkItemID
+	TMap<int32, EWorkItemTallyState> WorkItemStates;
+
+	// Number of work items in each state
+	int32 StateCounts[(uint8)EWorkItemTallyState::Num];
 };
 
 USTRUCT()
@@ -347,14 +377,21 @@ public:
 
 	void Subtract(const FWorkItemTallyBase& InWorkItemTally);
 
+	// Apply the change of state of one work item (None for added / removed work items).
+	void ApplyWorkItemStateChange(EWorkItemTallyState InPreviousState, EWorkItemTallyState InNewState);
+
 	virtual int32 NumWorkItems() const override { return TotalWorkItems; }
 	virtual int32 NumWaitingWorkItems() const override { return WaitingWorkItems; }
 	virtual int32 NumScheduledWorkItems() const override { return ScheduledWorkItems; }
 	virtual int32 NumCookingWorkItems() const override { return CookingWorkItems; }
 	virtual int32 NumCookedWorkItems() const override { return CookedWorkItems; }
 	virtual int32 NumErroredWorkItems() const override { return ErroredWorkItems; }
+	virtual int32 NumCookCancelledWorkItems() const override { return CookCancelledWorkItems; }
 
 protected:
+
+	int32* GetStateCounter(EWorkItemTallyState InState);
+
 	UPROPERTY()
 	int32 TotalWorkItems;
 	UPROPERTY()
@@ -417,11 +454,13 @@ public:
 	bool AreAllWorkItemsComplete() const { return GetWorkItemTally().AreAllWorkItemsComplete(); };
 	bool AnyWorkItemsFailed() const { return GetWorkItemTally().AnyWorkItemsFailed(); };
 	bool AnyWorkItemsPending() const { return GetWorkItemTally().AnyWorkItemsPending(); };
-	void ZeroWorkItemTally()
-	{
-		WorkItemTally.ZeroAll();
-		AggregatedWorkItemTally.ZeroAll();
-	}
+
+	// Zero this node's own work item tally (and remove its work items from its parents' aggregated tallies).
+	// The aggregated tally of a node with children is only maintained from its child nodes.
+	void ZeroWorkItemTally();
+
+	// The nearest parent node (with child nodes) of this node in its TOP network
+	UTOPNode* GetParentTOPNode() const { return ParentTOPNode; };
 
 	// Called by PDG manager when work item events are received
 	
@@ -429,29 +468,37 @@ public:
 	void OnWorkItemCreated(int32 InWorkItemID) { };
 
 	// Notification that a work item has been removed.
-	void OnWorkItemRemoved(int32 InWorkItemID) { WorkItemTally.RemoveWorkItem(InWorkItemID); };
+	void OnWorkItemRemoved(int32 InWorkItemID) { PropagateWorkItemStateChange(WorkItemTally.RemoveWorkItem(InWorkItemID), EWorkItemTallyState::None); };
 
 	// Notification that a work item has moved to the waiting state.
 	void OnWorkItemWaiting(int32 InWorkItemID);
 
 	// Notification that a work item has been scheduled.
-	void OnWorkItemScheduled(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsScheduled(InWorkItemID); };
+	void OnWorkItemScheduled(int32 InWorkItemID) { PropagateWorkItemStateChange(WorkItemTally.RecordWorkItemAsScheduled(InWorkItemID), EWorkItemTallyState::Scheduled); };
 
 	// Notification that a work item has started cooking.
-	void OnWorkItemCooking(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsCooking(InWorkItemID); };
+	void OnWorkItemCooking(int32 InWorkItemID) { PropagateWorkItemStateChange(WorkItemTally.RecordWorkItemAsCooking(InWorkItemID), EWorkItemTallyState::Cooking); };
 
 	// Notification that a work item has been cooked.
 	void OnWorkItemCooked(int32 InWorkItemID);
 	
 	// Notification that a work item has errored.
-	void OnWorkItemErrored(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsErrored(InWorkItemID); };
+	void OnWorkItemErrored(int32 InWorkItemID) { PropagateWorkItemStateChange(WorkItemTally.RecordWorkItemAsErrored(InWorkItemID), EWorkItemTallyState::Errored); };
 
 	// Notification that a work item cook has been cancelled.
-	void OnWorkItemCookCancelled(int32 InWorkItemID) { WorkItemTally.RecordWorkItemAsCookCancelled(InWorkItemID); };
+	void OnWorkItemCookCancelled(int32 InWorkItemID) { PropagateWorkItemStateChange(WorkItemTally.RecordWorkItemAsCookCancelled(InWorkItemID), EWorkItemTallyState::CookCancelled); };
 
 	bool IsVisibleInLevel() const { return bShow; }
 	void SetVisibleInLevel(bool bInVisible);
-	void UpdateOutputVisibilityInLevel();
+	// Queues the visibility of the output actors to be updated by the PDG asset link, a number of actors per frame.
+	// If bInApplyNow is true, the visibility is applied to all the output actors immediately instead.
+	void UpdateOutputVisibilityInLevel(const bool bInApplyNow=false);
+	// Applies the node's visibility to its output actors, changing the visibility of at most InOutBudget actors.
+	// Actors whose visibility hasn't changed since it was last applied are skipped and don't count against the budget.
+	// Returns true if all the output actors are up to date.
+	bool ApplyOutputVisibilityInLevel(int32& InOutBudget);
+	// Forces the next visibility update to be applied to all the output actors.
+	void InvalidateAppliedOutputVisibility();
 
 	// Sets all WorkResultObjects that are in the NotLoaded state to ToLoad.
 	void SetNotLoadedWorkResultsToLoad(bool bInAlsoSetDeletedToLoad=false);
@@ -497,6 +544,16 @@ public:
 	// Return the FTOPWorkResult at InArrayIndex in the WorkResult array, or nullptr if InArrayIndex is not a valid index.
 	FTOPWorkResult* GetWorkResultByArrayIndex(const int32& InArrayIndex);
 
+	// Add / remove entries of the WorkResult array while keeping the ID / HAPI index lookups up to date.
+	// Returns the array index of the new entry.
+	int32 AddWorkResult(const FTOPWorkResult& InWorkResult);
+	void RemoveWorkResultAt(const int32& InArrayIndex);
+	void EmptyWorkResults();
+	// Set the WorkItemID of the entry at InArrayIndex (relinking an entry loaded from disk to a PDG work item).
+	void SetWorkResultID(const int32& InArrayIndex, const int32& InWorkItemID);
+	// Force the lookups to be rebuilt on the next search (WorkResult was modified directly).
+	void InvalidateWorkResultLookup() { NumIndexedWorkResults = INDEX_NONE; };
+
 	// Returns true if InNetwork is the parent TOP Net of this node.
 	bool IsParentTOPNetwork(UTOPNetwork const * const InNetwork) const;
 
@@ -559,7 +616,12 @@ public:
 	FHoudiniLandscapeTileSizeInfo& GetLandscapeSizeInfo() { return LandscapeSizeInfo; }
 
 protected:
+	friend class UTOPNetwork;
+
 	void InvalidateLandscapeCache();
+
+	// Applies the change of state of one of this node's work items to the aggregated tallies of its parent nodes
+	void PropagateWorkItemStateChange(EWorkItemTallyState InPreviousState, EWorkItemTallyState InNewState);
 	
 	// Value caches used during landscape tile creation.
 	FHoudiniLandscapeReferenceLocation LandscapeReferenceLocation;
@@ -581,6 +643,24 @@ protected:
 	UPROPERTY(Transient, NonTransactional)
 	FAggregatedWorkItemTally	AggregatedWorkItemTally;
 
+	// The nearest parent node with child nodes in the network, set by UTOPNetwork::UpdateTOPNodeHierarchy()
+	UPROPERTY(Transient, NonTransactional)
+	UTOPNode*				ParentTOPNode;
+
+	// Rebuilds the work result lookups if they are invalid, or if entries were added / removed directly
+	void UpdateWorkResultLookup();
+
+	// WorkResult array index of the first entry for each WorkItemID / WorkItemIndex
+	TMap<int32, int32>		WorkResultIndexByID;
+	TMap<int32, int32>		WorkResultIndexByHAPIIndex;
+	// Number of WorkResult entries when the lookups were built, INDEX_NONE if they need to be rebuilt
+	int32					NumIndexedWorkResults;
+
+	// The output actor and visibility last applied by ApplyOutputVisibilityInLevel()
+	TWeakObjectPtr<AActor>	VisibilityAppliedToActor;
+	bool					bAppliedVisibility;
+	bool					bHasAppliedVisibility;
+
 private:
 	UPROPERTY()
 	FOutputActorOwner OutputActorOwner;
@@ -611,6 +691,17 @@ public:
 	// Returns true if any node in this TOP net has pending (waiting, scheduled, cooking) work items.
 	bool AnyWorkItemsPending() const;
 
+	// Links each node to its nearest parent node, and rebuilds the aggregated work item tallies of the parent nodes.
+	// Must be called when AllTOPNodes is (re)built: the aggregated tallies are then updated as work items change state.
+	void UpdateTOPNodeHierarchy();
+
+	// Sets the state of the nodes with child nodes from the state of their child nodes.
+	void UpdateParentTOPNodeStates();
+
+#if WITH_EDITOR
+	void PostTransacted(const FTransactionObjectEvent& TransactionEvent) override;
+#endif
+
 public:
 
 	UPROPERTY(Transient, NonTransactional)
@@ -641,6 +732,7 @@ public:
 
 class UHoudiniPDGAssetLink;
 DECLARE_MULTICAST_DELEGATE_FourParams(FHoudiniPDGAssetLinkWorkResultObjectLoaded, UHoudiniPDGAssetLink*, UTOPNode*, int32 /*WorkItemHAPIIndex*/, int32 /*WorkItemResultInfoIndex*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FHoudiniPDGAssetLinkTOPNodesChanged, UHoudiniPDGAssetLink*, const TArray<UTOPNode*>& /*ChangedTOPNodes*/);
 
 UCLASS()
 class HOUDINIENGINERUNTIME_API UHoudiniPDGAssetLink : public UObject
@@ -673,6 +765,33 @@ public:
 	UTOPNode* GetTOPNode(const int32& InNodeID);
 	UTOPNetwork* GetTOPNetwork(const int32& AtIndex);
 
+	// Incremented whenever the TOP networks / nodes are rebuilt or restored by undo/redo, so that lookups of TOP nodes
+	// by node id cached outside of the asset link can be invalidated.
+	uint32 GetTOPNodesVersion() const { return TOPNodesVersion; };
+	void NotifyTOPNodesChanged() { TOPNodesVersion++; };
+
+	// Record that the state, work items or work results of a TOP node (and so of its parent nodes) have changed.
+	// The changes are broadcast with OnTOPNodesChanged by BroadcastTOPNodeChanges().
+	void MarkTOPNodeChanged(UTOPNode* InTOPNode);
+	// Broadcast OnTOPNodesChanged with the TOP nodes marked as changed since the last broadcast, if any.
+	void BroadcastTOPNodeChanges();
+
+	// Requests the work result load budget to be enforced again (see MaxLoadedWorkResultObjects):
+	// called when work results are added, requested to load, loaded, or when the budget/selection changes.
+	void MarkLoadBudgetDirty() { bLoadBudgetDirty = true; };
+	// Indicates if the load budget needs to be enforced at InNow: something changed since it was last applied,
+	// or results are waiting for the budget and their priority (camera proximity) might have changed.
+	bool ShouldApplyLoadBudget(double InNow) const;
+	// Records that the load budget has been enforced at InNow.
+	void OnLoadBudgetApplied(double InNow, bool bInHasResultsWaitingForBudget);
+
+	// Queues the output visibility of a TOP node to be applied by ProcessOutputVisibilityUpdates().
+	// The queue is processed by a ticker owned by the asset link, so it doesn't require a Houdini Engine session.
+	void QueueOutputVisibilityUpdate(UTOPNode* InTOPNode);
+	// Applies the queued output visibility changes, changing the visibility of at most InMaxActorsToUpdate actors
+	// (<= 0: no limit). The nodes that couldn't be completed stay queued. Returns true if the queue is now empty.
+	bool ProcessOutputVisibilityUpdates(int32 InMaxActorsToUpdate);
+
 	// Find the node with relative path 'InNodePath' from its topnet.
 	static UTOPNode* GetTOPNodeByNodePath(const FString& InNodePath, const TArray<UTOPNode*>& InTOPNodes, int32& OutIndex);
 	// Find the network with relative path 'InNetPath' from the HDA
@@ -728,14 +847,35 @@ public:
 	void PostTransacted(const FTransactionObjectEvent& TransactionEvent) override;
 #endif
 
+	virtual void BeginDestroy() override;
+
 private:
 
 	void ClearAllTOPData();
+
+	// Ticker callback processing the queued output visibility updates, removed once the queue is empty
+	bool TickOutputVisibilityUpdates(float DeltaTime);
 	
 	static void DestroyWorkItemResultData(FTOPWorkResult& Result);
 
 	static void DestoryWorkResultObjectData(FTOPWorkResultObject& ResultObject);
 
+	uint32 TOPNodesVersion = 0;
+
+	// TOP nodes marked as changed since the last call to BroadcastTOPNodeChanges()
+	TSet<TWeakObjectPtr<UTOPNode>> ChangedTOPNodes;
+
+	// TOP nodes whose output visibility still needs to be applied, in the order they were queued
+	TArray<TWeakObjectPtr<UTOPNode>> PendingVisibilityTOPNodes;
+
+	// Handle of the ticker processing PendingVisibilityTOPNodes
+	FDelegateHandle VisibilityTickerHandle;
+
+	// Load budget bookkeeping, see ShouldApplyLoadBudget()
+	bool bLoadBudgetDirty;
+	bool bHasResultsWaitingForLoadBudget;
+	double LastLoadBudgetTime;
+
 public:
 
 	//UPROPERTY()
@@ -791,6 +931,16 @@ public:
 	UPROPERTY(EditAnywhere, Category="Output")
 	AActor*					 	OutputParentActor;
 
+	// Maximum number of work result objects loaded at the same time (0: no limit).
+	// When over budget, the least recently viewed results are unloaded, and reloaded from their
+	// files once they have priority again (in the selected TOP node, or close to the camera).
+	UPROPERTY(EditAnywhere, Category="Output", meta=(ClampMin="0"))
+	int32						MaxLoadedWorkResultObjects;
+
+	// Approximate memory budget of the loaded work result outputs, in MB (0: no limit).
+	UPROPERTY(EditAnywhere, Category="Output", meta=(ClampMin="0"))
+	int32						MaxLoadedWorkResultsMemoryMB;
+
 	// Folder used for baking PDG outputs
 	UPROPERTY()
 	FDirectoryPath BakeFolder;
@@ -802,6 +952,9 @@ public:
 	// Delegate that is broadcast when a work result object has been loaded
 	FHoudiniPDGAssetLinkWorkResultObjectLoaded OnWorkResultObjectLoaded;
 
+	// Delegate that is broadcast (at most once per PDG manager update) with the TOP nodes that have changed
+	FHoudiniPDGAssetLinkTOPNodesChanged OnTOPNodesChanged;
+
 	//
 	// End: Notifications
 	//
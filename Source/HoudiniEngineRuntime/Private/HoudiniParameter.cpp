@@ -26,6 +26,9 @@
 
 #include "HoudiniParameter.h"
 
+//
+uint64 UHoudiniParameter::LastChangeStamp = 0;
+
 UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 	, ParmType(EHoudiniParameterType::Invalid)
@@ -47,6 +50,7 @@ UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitialize
 	, ValueIndex(-1)
 	, bHasExpression(false)
 	, bShowExpression(false)
+	, ChangeStamp(++LastChangeStamp)
 {
 	Name = TEXT("");
 	Label = TEXT("");
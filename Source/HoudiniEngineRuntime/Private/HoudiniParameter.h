@@ -118,6 +118,10 @@ public:
 	virtual bool IsDisabled() const { return bIsDisabled; };
 	virtual bool HasChanged() const { return bHasChanged; };
 	virtual bool NeedsToTriggerUpdate() const { return bNeedsToTriggerUpdate; };
+
+	// Returns a stamp that changes every time this parameter is marked as changed.
+	// Stamps are unique across all parameters, so comparing them also detects that the parameter was replaced.
+	uint64 GetChangeStamp() const { return ChangeStamp; };
 	virtual bool IsDefault() const { return true; };
 	virtual bool IsSpare() const { return bIsSpare; };
 	virtual bool GetJoinNext() const { return bJoinNext; };
@@ -168,7 +172,13 @@ public:
 	virtual void SetTagCount(const uint32& InTagCount) { TagCount = InTagCount; };
 	virtual void SetValueIndex(const uint32& InValueIndex) { ValueIndex = InValueIndex; };
 
-	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
+	virtual void MarkChanged(const bool& bInChanged)
+	{
+		bHasChanged = bInChanged;
+		SetNeedsToTriggerUpdate(bInChanged);
+		if (bInChanged)
+			ChangeStamp = ++LastChangeStamp;
+	};
 	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	virtual void RevertToDefault();
 	virtual void RevertToDefault(const int32& TupleIndex);
@@ -319,6 +329,12 @@ protected:
 	UPROPERTY()
 	bool bAutoUpdate = true;
 
+	// Current change stamp of this parameter, see GetChangeStamp()
+	uint64 ChangeStamp;
+
+	// Last change stamp given to a parameter
+	static uint64 LastChangeStamp;
+
 
 };
 
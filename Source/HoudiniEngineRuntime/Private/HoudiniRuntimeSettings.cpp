@@ -79,7 +79,14 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	bPauseCookingOnStart = false;
 	bDisplaySlateCookingNotifications = true;
 	DefaultTemporaryCookFolder = HAPI_UNREAL_DEFAULT_TEMP_COOK_FOLDER;
+	bAutoCleanUpTempFolder = false;
+	TempFolderCleanUpInterval = 30.0f;
+	bInterruptCookOnChange = true;
+	CookInterruptMinDuration = 0.25f;
+	CookDebounceDelay = 0.0f;
 	DefaultBakeFolder = HAPI_UNREAL_DEFAULT_BAKE_FOLDER;
+	bBulkBakeInstancers = false;
+	BulkBakeActorSpawnBatchSize = 256;
 
 	// Parameter options
 	//bTreatRampParametersAsMultiparms = false;
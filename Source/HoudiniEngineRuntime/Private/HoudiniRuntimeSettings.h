@@ -236,10 +236,43 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		FString DefaultTemporaryCookFolder;
 
+		// Periodically delete the temporary cook packages that are no longer used by the cooks that created them.
+		// Only the packages that aren't referenced anymore are deleted (see Houdini.Clean for a full clean up).
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Automatically Clean Up Temporary Cook Folder"))
+		bool bAutoCleanUpTempFolder;
+
+		// Interval (in seconds) between two automatic clean ups of the temporary cook folder.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (EditCondition = "bAutoCleanUpTempFolder", ClampMin = "1.0", Units = "s"))
+		float TempFolderCleanUpInterval;
+
+		// Interrupt the current cook of an asset when its parameters or inputs are modified, and cook the latest changes instead.
+		// The results of the interrupted cook are discarded.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Interrupt Cooks On Change"))
+		bool bInterruptCookOnChange;
+
+		// Cooks that have been running for less than this duration (in seconds) are not interrupted, but left to finish.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (EditCondition = "bInterruptCookOnChange", ClampMin = "0.0", Units = "s"))
+		float CookInterruptMinDuration;
+
+		// Delay (in seconds) without any new modification of an asset before its cook starts.
+		// Every change restarts the delay, so successive changes are cooked together. 0 starts the cook immediately.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (ClampMin = "0.0", Units = "s"))
+		float CookDebounceDelay;
+
 		// Default content folder used when baking houdini asset data to native unreal objects
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		FString DefaultBakeFolder;
 
+		// When baking instancers to actors, build the baked instanced static mesh components directly from the instance
+		// transforms, and merge the instancers that share the same mesh and materials in one component.
+		// Mesh split instancers are baked to a single instanced component instead of one static mesh component per instance.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (DisplayName = "Bulk Bake Instancers"))
+		bool bBulkBakeInstancers;
+
+		// Number of instanced actors spawned before their construction is finished when bulk baking instancers.
+		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = Cooking, meta = (EditCondition = "bBulkBakeInstancers", ClampMin = "1"))
+		int32 BulkBakeActorSpawnBatchSize;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Parameter options.
 		//-------------------------------------------------------------------------------------------------------------